@@ -0,0 +1,167 @@
+# ==========================================
+#   Unity Project - A Test Framework for C
+#   Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+#   [Released under MIT License. Please refer to license.txt for details]
+# ==========================================
+
+# This script converts a CSV file of test vectors into the table format read by
+# TEST_DATA_FILE, and can write the C struct that describes one row of it.
+#
+# The first line of the CSV names the columns and gives each a type, as name:type
+#   i8 u8 i16 u16 i32 u32 i64 u64   integers (decimal, or 0x.. hex)
+#   f32 f64                         floats (nan, inf and -inf are accepted)
+#   charN                           a string of up to N bytes, padded with zeros
+#
+# The table is a 16 byte header of little-endian 32-bit words (the magic "UDT1", the
+# row count, the row size and the offset of the first row), then the CSV header line,
+# then the rows.  Each field sits at its natural alignment and rows are padded to the
+# widest field, which is how C lays out the generated struct on most targets, so Unity
+# can hand a row to the test without copying it.  Some ABIs align 8-byte fields to 4
+# inside a struct (i386 SysV, for one); there the struct comes out smaller than the row,
+# and it is the size check in TEST_DATA_ROW that fails the test before any field is read
+# from the wrong place.
+
+require 'csv'
+
+class UnityTableConverter
+
+  TYPES = {
+    'i8'  => ['c',  1, 'int8_t',   -(2**7),  2**7 - 1],
+    'u8'  => ['C',  1, 'uint8_t',  0,        2**8 - 1],
+    'i16' => ['s<', 2, 'int16_t',  -(2**15), 2**15 - 1],
+    'u16' => ['S<', 2, 'uint16_t', 0,        2**16 - 1],
+    'i32' => ['l<', 4, 'int32_t',  -(2**31), 2**31 - 1],
+    'u32' => ['L<', 4, 'uint32_t', 0,        2**32 - 1],
+    'i64' => ['q<', 8, 'int64_t',  -(2**63), 2**63 - 1],
+    'u64' => ['Q<', 8, 'uint64_t', 0,        2**64 - 1],
+    'f32' => ['e',  4, 'float'],
+    'f64' => ['E',  8, 'double'],
+  }
+
+  MAGIC       = 'UDT1'
+  HEADER_SIZE = 16
+
+  def initialize(csv_file)
+    @rows = CSV.read(csv_file)
+    raise "#{csv_file} has no header line" if @rows.empty?
+    @spec = @rows.shift.map { |column| column.strip }
+    @columns = @spec.map { |column| parse_column(column) }
+    layout
+  end
+
+  def parse_column(column)
+    raise "Column '#{column}' should be name:type" unless column =~ /^([A-Za-z_]\w*)\s*:\s*(\w+)$/
+    name, type = $1, $2
+    if type =~ /^char(\d+)$/
+      length = $1.to_i
+      raise "Column '#{column}' needs at least one char" if length < 1
+      { :name => name, :type => type, :pack => "a#{length}", :size => length, :align => 1, :c_type => 'char', :length => length }
+    elsif TYPES[type]
+      pack, size, c_type, min, max = TYPES[type]
+      { :name => name, :type => type, :pack => pack, :size => size, :align => size, :c_type => c_type, :min => min, :max => max }
+    else
+      raise "Column '#{column}' has an unknown type"
+    end
+  end
+
+  # Give each column its offset, and the row its size, the way a C compiler would
+  def layout
+    offset = 0
+    @columns.each do |column|
+      offset += (column[:align] - offset % column[:align]) % column[:align]
+      column[:offset] = offset
+      offset += column[:size]
+    end
+    align = @columns.map { |column| column[:align] }.max || 1
+    @row_size = offset + (align - offset % align) % align
+    raise "Rows need at least one column" if @row_size == 0
+  end
+
+  def value(column, text, line)
+    text = (text || '').strip
+    if column[:length]
+      raise "Line #{line}: '#{text}' is longer than #{column[:type]}" if text.bytesize > column[:length]
+      return text
+    end
+    if column[:type] =~ /^f/
+      case text.downcase
+        when 'nan'            then return Float::NAN
+        when 'inf', '+inf'    then return Float::INFINITY
+        when '-inf'           then return -Float::INFINITY
+        else                  return Float(text)
+      end
+    end
+    number = Integer(text)
+    raise "Line #{line}: #{text} does not fit in #{column[:type]}" if (number < column[:min]) or (number > column[:max])
+    number
+  rescue ArgumentError
+    raise "Line #{line}: '#{text}' is not a valid #{column[:type]}"
+  end
+
+  def pack_row(row, line)
+    raise "Line #{line}: expected #{@columns.size} values but found #{row.size}" if row.size != @columns.size
+    packed = "\0".b * @row_size
+    @columns.each_with_index do |column, i|
+      field = [value(column, row[i], line)].pack(column[:pack])
+      packed[column[:offset], field.bytesize] = field
+    end
+    packed
+  end
+
+  def write_table(table_file)
+    spec = (@spec.join(',') + "\0").b
+    spec << "\0" while (HEADER_SIZE + spec.bytesize) % 8 != 0
+    File.open(table_file, 'wb') do |output|
+      output << MAGIC << [@rows.size, @row_size, HEADER_SIZE + spec.bytesize].pack('L<3') << spec
+      @rows.each_with_index { |row, i| output << pack_row(row, i + 2) }
+    end
+  end
+
+  def write_header(header_file, struct_name)
+    guard = File.basename(header_file).upcase.gsub(/\W/, '_')
+    File.open(header_file, 'w') do |output|
+      output.puts("/* AUTOGENERATED FILE. DO NOT EDIT. */")
+      output.puts("#ifndef #{guard}")
+      output.puts("#define #{guard}")
+      output.puts("")
+      output.puts("#include <stdint.h>")
+      output.puts("")
+      output.puts("typedef struct #{struct_name}")
+      output.puts("{")
+      @columns.each do |column|
+        output.puts("    #{column[:c_type]} #{column[:name]}#{column[:length] ? "[#{column[:length]}]" : ''};")
+      end
+      output.puts("} #{struct_name}_t;")
+      output.puts("")
+      output.puts("#endif")
+    end
+  end
+end
+
+if ($0 == __FILE__)
+  header_file = nil
+  struct_name = nil
+
+  ARGV.reject! do |arg|
+    case(arg)
+      when /^--header=(.+)$/ then header_file = $1; true
+      when /^--struct=(\w+)$/ then struct_name = $1; true
+      else false
+    end
+  end
+
+  if ARGV.size != 2
+    puts ["usage: ruby #{__FILE__} (options) input.csv output.bin",
+          "    --header=\"\"  - also write a C header with the struct of one row",
+          "    --struct=\"\"  - name of that struct (the output file name by default)"
+          ].join("\n")
+    exit 1
+  end
+
+  converter = UnityTableConverter.new(ARGV[0])
+  converter.write_table(ARGV[1])
+  unless header_file.nil?
+    struct_name ||= File.basename(ARGV[1], '.*').gsub(/\W/, '_')
+    converter.write_header(header_file, struct_name)
+  end
+end
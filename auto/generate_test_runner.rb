@@ -57,6 +57,7 @@ class UnityTestRunnerGenerator
     end
 
     #build runner file
+    find_corpus(tests)
     generate(input_file, output_file, tests, used_mocks)
 
     #determine which files were used to return them
@@ -68,11 +69,12 @@ class UnityTestRunnerGenerator
 
   def generate(input_file, output_file, tests, used_mocks)
     File.open(output_file, 'w') do |output|
-      create_header(output, used_mocks)
+      create_header(output, input_file, used_mocks)
       create_suite_setup_and_teardown(output)
       create_externs(output, tests, used_mocks)
       create_mock_management(output, used_mocks)
       create_reset(output, used_mocks)
+      create_fuzz(output, input_file, tests, used_mocks)
       create_main(output, input_file, tests, used_mocks)
     end
   end
@@ -103,6 +105,14 @@ class UnityTestRunnerGenerator
         tests_and_line_numbers << { :test => name, :args => args, :call => call, :line_number => 0 }
         tests_args = []
       end
+      #TEST_PROPERTY(test_Name), TEST_DATA_FILE(test_Name, path), TEST_CONCURRENT(test_Name, threads, iterations) and TEST_INTERLEAVED(test_Name, schedules) define test_Name themselves, so it never appears as "void test_Name(void)"
+      if line =~ /^\s*TEST_(?:PROPERTY(?:_ITERATIONS)?|DATA_FILE|CONCURRENT(?:_PINNED)?|INTERLEAVED(?:_ALL)?)\s*\(\s*(test\w*)/
+        tests_and_line_numbers << { :test => $1, :args => nil, :call => 'void', :line_number => 0 }
+      end
+      #TEST_FUZZ(test_Name, data, size) takes the input as its arguments, so it gets a runner of its own
+      if line =~ /^\s*TEST_FUZZ\s*\(\s*(test\w*)/
+        tests_and_line_numbers << { :test => $1, :args => nil, :call => 'const unsigned char* data, size_t size', :line_number => 0, :fuzz => true }
+      end
     end
 
     #determine line numbers and create tests to run
@@ -136,6 +146,20 @@ class UnityTestRunnerGenerator
     return source.scan(/^\s*#include\s+\"\s*(.+)\.[hH]\s*\"/).flatten
   end
 
+  # Stored fuzzer inputs are compiled into the runner, so replaying them needs no file system
+  # on the target. They are read from <fuzz_corpus>/<test name>/, the layout libFuzzer uses
+  # when it is given one corpus directory per target.
+  def find_corpus(tests)
+    tests.each do |test|
+      next unless test[:fuzz]
+      test[:corpus] = []
+      next if @options[:fuzz_corpus].nil?
+      Dir.glob(File.join(@options[:fuzz_corpus], test[:test], '*')).sort.each do |path|
+        test[:corpus] << { :name => File.basename(path), :data => File.binread(path) } if File.file?(path)
+      end
+    end
+  end
+
   def find_mocks(includes)
     mock_headers = []
     includes.each do |include_file|
@@ -144,9 +168,10 @@ class UnityTestRunnerGenerator
     return mock_headers
   end
 
-  def create_header(output, mocks)
+  def create_header(output, input_file, mocks)
     output.puts('/* AUTOGENERATED FILE. DO NOT EDIT. */')
     create_runtest(output, mocks)
+    create_amalgamation(output, input_file) if @options[:amalgamate]
     output.puts("\n//=======Automagically Detected Files To Include=====")
     output.puts("#include \"#{@options[:framework].to_s}.h\"")
     output.puts('#include "cmock.h"') unless (mocks.empty?)
@@ -174,6 +199,25 @@ class UnityTestRunnerGenerator
     end
   end
 
+  # A "unity build": the framework and the test file are compiled in the same translation
+  # unit as the runner, so the compiler can inline the assertions into the test bodies.
+  # The test file is found through the include path, like the framework itself. Both come
+  # before the runner's own includes, with _GNU_SOURCE ahead of them: a feature-test macro
+  # only counts before the first system header, so the one in the test file would be too late.
+  def create_amalgamation(output, input_file)
+    source = File.read(input_file).gsub(/\/\*.*?\*\//m, '').gsub(/\/\/.*$/, '')
+    output.puts("\n//=======Amalgamated Build=====")
+    output.puts('#if defined(__linux__) && !defined(_GNU_SOURCE)')
+    output.puts('#define _GNU_SOURCE')
+    output.puts('#endif')
+    output.puts("#define UNITY_AMALGAMATED")
+    output.puts("#include \"#{@options[:framework].to_s}.c\"")
+    output.puts("#include \"#{File.basename(input_file)}\"")
+    ['setUp', 'tearDown'].each do |name|
+      output.puts("void #{name}(void) {}") unless source =~ /\bvoid\s+#{name}\s*\(\s*(?:void)?\s*\)\s*\{/
+    end
+  end
+
   def create_externs(output, tests, mocks)
     output.puts("\n//=======External Functions This Runner Calls=====")
     output.puts("extern void setUp(void);")
@@ -236,7 +280,6 @@ class UnityTestRunnerGenerator
   end
 
   def create_runtest(output, used_mocks)
-    cexception = @options[:plugins].include? :cexception
     va_args1   = @options[:use_param_tests] ? ', ...' : ''
     va_args2   = @options[:use_param_tests] ? '__VA_ARGS__' : ''
     output.puts("\n//=============CLRWDT macro for XC8 only=============")
@@ -247,9 +290,15 @@ class UnityTestRunnerGenerator
     output.puts('#endif  // defined(__XC8)')
     output.puts("\n//=======Test Runner Used To Run Each Test Below=====")
     output.puts("#define RUN_TEST_NO_ARGS") if @options[:use_param_tests]
-    output.puts("#define RUN_TEST(TestFunc, TestLineNum#{va_args1}) \\")
+    create_runtest_macro(output, used_mocks, "RUN_TEST(TestFunc, TestLineNum#{va_args1})",
+                         "#TestFunc#{va_args2.empty? ? '' : " \"(\" ##{va_args2} \")\""}", "TestFunc(#{va_args2})")
+  end
+
+  def create_runtest_macro(output, used_mocks, signature, name, call)
+    cexception = @options[:plugins].include? :cexception
+    output.puts("#define #{signature} \\")
     output.puts("{ \\")
-    output.puts("  Unity.CurrentTestName = #TestFunc#{va_args2.empty? ? '' : " \"(\" ##{va_args2} \")\""}; \\")
+    output.puts("  Unity.CurrentTestName = #{name}; \\")
     output.puts("  Unity.CurrentTestLineNumber = TestLineNum; \\")
     output.puts("  Unity.NumberOfTests++; \\")
     output.puts("  CMock_Init(); \\") unless (used_mocks.empty?)
@@ -261,7 +310,7 @@ class UnityTestRunnerGenerator
     output.puts("      { \\")
     output.puts("        Unity.setUp(); \\")
     output.puts("      } \\")
-    output.puts("      TestFunc(#{va_args2}); \\")
+    output.puts("      #{call}; \\")
     output.puts("      ClearWDT(); \\") if @options[:embed_clrwdt_in_test_runner]
     output.puts("    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, \"Unhandled Exception!\"); } \\") if cexception
     output.puts("  } \\")
@@ -296,8 +345,84 @@ class UnityTestRunnerGenerator
     output.puts("}")
   end
 
+  # TEST_FUZZ tests get two runners. Built normally, each stored input (or an empty one when
+  # there are none) runs as an ordinary Unity test. Built with UNITY_FUZZ, main() is left to
+  # libFuzzer and LLVMFuzzerTestOneInput() runs UNITY_FUZZ_TARGET (the first TEST_FUZZ unless
+  # defined) silently, aborting on the first failure so the fuzzer saves the input as a crash.
+  def create_fuzz(output, filename, tests, used_mocks)
+    fuzz_tests = tests.select { |test| test[:fuzz] }
+    return if fuzz_tests.empty?
+
+    output.puts("\n//=======Fuzz Test Runner=====")
+    create_runtest_macro(output, used_mocks, "RUN_FUZZ_TEST(TestFunc, TestLineNum, TestName, Data, Size)", "TestName", "TestFunc(Data, Size)")
+
+    corpus = fuzz_tests.select { |test| !test[:corpus].empty? }
+    unless corpus.empty?
+      # Only main() replays the corpus, so a UNITY_FUZZ build leaves it out rather than
+      # carrying arrays nothing refers to.
+      output.puts("\n//=======Fuzz Corpus=====")
+      output.puts('#if !defined(UNITY_FUZZ)')
+      corpus.each do |test|
+        test[:corpus].each_with_index do |input, i|
+          bytes = input[:data].bytes
+          bytes = [0] if bytes.empty?
+          output.puts("static const unsigned char #{test[:test]}_corpus#{i}[] = {")
+          bytes.each_slice(16) { |row| output.puts("  " + row.map { |b| format('0x%02X', b) }.join(', ') + ',') }
+          output.puts("};")
+        end
+      end
+      output.puts('#endif  // !defined(UNITY_FUZZ)')
+    end
+
+    output.puts("\n//=======Fuzzer Entry Point=====")
+    output.puts('#if defined(UNITY_FUZZ)')
+    output.puts('#include <stdlib.h>')
+    output.puts('#ifndef UNITY_FUZZ_TARGET')
+    output.puts("#define UNITY_FUZZ_TARGET #{fuzz_tests[0][:test]}")
+    output.puts('#endif')
+    output.puts('#define UNITY_FUZZ_NAME(TestFunc) UNITY_FUZZ_NAME_(TestFunc)')
+    output.puts('#define UNITY_FUZZ_NAME_(TestFunc) #TestFunc')
+    output.puts("int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size);")
+    output.puts("int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size)")
+    output.puts("{")
+    output.puts("  static int started = 0;")
+    output.puts("  if (!started)")
+    output.puts("  {")
+    output.puts("    UnityBegin(\"#{filename}\",setUp,tearDown);")
+    output.puts("    Unity.CurrentTestName = UNITY_FUZZ_NAME(UNITY_FUZZ_TARGET);")
+    output.puts("    started = 1;")
+    output.puts("  }")
+    output.puts("  CMock_Init();") unless (used_mocks.empty?)
+    output.puts("  if (Unity.setUp)")
+    output.puts("  {")
+    output.puts("    Unity.setUp();")
+    output.puts("  }")
+    output.puts("  UNITY_FUZZ_TARGET(data, size);")
+    output.puts("  if (!TEST_IS_IGNORED)")
+    output.puts("  {")
+    output.puts("    if (Unity.tearDown)")
+    output.puts("    {")
+    output.puts("      Unity.tearDown();")
+    output.puts("    }")
+    output.puts("    CMock_Verify();") unless (used_mocks.empty?)
+    output.puts("  }")
+    output.puts("  CMock_Destroy();") unless (used_mocks.empty?)
+    output.puts("  if (Unity.CurrentTestFailed)")
+    output.puts("  {")
+    output.puts("    UNITY_OUTPUT_COMPLETE();")
+    output.puts("    fflush(stdout);")
+    output.puts("    abort();")
+    output.puts("  }")
+    output.puts("  Unity.CurrentTestIgnored = 0;")
+    output.puts("  return 0;")
+    output.puts("}")
+    output.puts('#endif  // defined(UNITY_FUZZ)')
+  end
+
   def create_main(output, filename, tests, used_mocks)
+    fuzz = tests.any? { |test| test[:fuzz] }
     output.puts("\n\n//=======MAIN=====")
+    output.puts('#if !defined(UNITY_FUZZ)') if fuzz
     @options[:main_name] = "main" if @options[:main_name].nil?
     output.puts('#if defined(__XC8)')
     if (@options[:main_name] != "main")
@@ -316,14 +441,16 @@ class UnityTestRunnerGenerator
     output.puts("  UnityBegin(\"#{filename}\",setUp,tearDown);")
     if (@options[:use_param_tests])
       tests.each do |test|
-        if ((test[:args].nil?) or (test[:args].empty?))
+        if (test[:fuzz])
+          create_fuzz_calls(output, test)
+        elsif ((test[:args].nil?) or (test[:args].empty?))
           output.puts("  RUN_TEST(#{test[:test]}, #{test[:line_number]}, RUN_TEST_NO_ARGS);")
         else
           test[:args].each {|args| output.puts("  RUN_TEST(#{test[:test]}, #{test[:line_number]}, #{args});")}
         end
       end
     else
-        tests.each { |test| output.puts("  RUN_TEST(#{test[:test]}, #{test[:line_number]});") }
+        tests.each { |test| test[:fuzz] ? create_fuzz_calls(output, test) : output.puts("  RUN_TEST(#{test[:test]}, #{test[:line_number]});") }
     end
     output.puts()
     output.puts(" CMock_Guts_MemFreeFinal();") unless used_mocks.empty?
@@ -333,6 +460,17 @@ class UnityTestRunnerGenerator
     output.puts("  return #{@options[:suite_teardown].nil? ? "" : "suite_teardown"}(UnityEnd());")
     output.puts('#endif  // defined(__XC8)')
     output.puts("}")
+    output.puts('#endif  // !defined(UNITY_FUZZ)') if fuzz
+  end
+
+  def create_fuzz_calls(output, test)
+    if test[:corpus].empty?
+      output.puts("  RUN_FUZZ_TEST(#{test[:test]}, #{test[:line_number]}, \"#{test[:test]}\", (const unsigned char*)\"\", 0);")
+    end
+    test[:corpus].each_with_index do |input, i|
+      label = "#{test[:test]}(#{input[:name]})".gsub(/[\\"]/) { |c| "\\" + c }
+      output.puts("  RUN_FUZZ_TEST(#{test[:test]}, #{test[:line_number]}, \"#{label}\", #{test[:test]}_corpus#{i}, #{input[:data].bytesize});")
+    end
   end
 end
 
@@ -346,6 +484,10 @@ if ($0 == __FILE__)
     case(arg)
       when '-cexception'
         options[:plugins] = [:cexception]; true
+      when '-amalgamate'
+        options[:amalgamate] = true; true
+      when /^--fuzz_corpus=\"?(.*?)\"?$/
+        options[:fuzz_corpus] = $1; true
       when /\.*\.yml/
         options = UnityTestRunnerGenerator.grab_config(arg); true
       else false
@@ -357,6 +499,7 @@ if ($0 == __FILE__)
     puts ["usage: ruby #{__FILE__} (yaml) (options) input_test_file output_test_runner (includes)",
            "  blah.yml    - will use config options in the yml file (see docs)",
            "  -cexception - include cexception support",
+           "  -amalgamate - build the framework, test file and runner as one translation unit",
            "    --setup_name=\"\"       - redefine setUp func name to something else",
            "    --teardown_name=\"\"    - redefine tearDown func name to something else",
            "    --main_name=\"\"        - redefine main func name to something else",
@@ -364,7 +507,8 @@ if ($0 == __FILE__)
            "    --suite_setup=\"\"      - code to execute for setup of entire suite",
            "    --suite_teardown=\"\"   - code to execute for teardown of entire suite",
            "    --use_param_tests=1   - enable parameterized tests (disabled by default)",
-           "    --header_file=\"\"      - path/name of test header file to generate too"
+           "    --header_file=\"\"      - path/name of test header file to generate too",
+           "    --fuzz_corpus=\"\"      - directory of stored inputs (one sub-directory per TEST_FUZZ) to replay"
            ].join("\n")
     exit 1
   end
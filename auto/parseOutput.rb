@@ -11,179 +11,197 @@
 #      make | tee Output.txt
 #
 #    To use this parser use the following command
-#    ruby parseOutput.rb [options] [file]
-#        options:  -xml  : produce a JUnit compatible XML file
-#        file      :  file to scan for results
+#    ruby parseOutput.rb [options] [file ...]
+#        options:  -xml      : produce a JUnit compatible XML file (report.xml)
+#                  --jobs N  : parse up to N files at the same time
+#        file      :  file(s) to scan for results
+#
+#    Logs are read one line at a time and the XML is written as the results are found,
+#  so memory use does not depend on the size of the log.  When several files are given
+#  report.xml holds one <testsuite> per file inside a <testsuites> element.
 #============================================================
 
 
 class ParseOutput
-# The following flag is set to true when a test is found or false otherwise.
-    @testFlag
-    @xmlOut
-    @arrayList
-    @totalTests
-    @classIndex
+# Typical test lines look like this:
+# <path>/<test_file>.c:36:test_tc1000_opsys:FAIL: Expected 1 Was 0
+# <path>/<test_file>.c:36:test_tc1000_opsys:FAIL Expected 1 Was 0
+# <path>/<test_file>.c:112:test_tc5004_initCanChannel:IGNORE: Not Yet Implemented
+# <path>/<test_file>.c:115:test_tc5100_initCanVoidPtrs:PASS
+#
+# The path is matched up to the first ":<line number>:", so a Windows drive letter
+# (C:\...) does not shift the other fields.
+    TEST_LINE = /^(.*?):(\d+):([^:]+):(PASS|FAIL|IGNORE)\b:?\s*(.*?)\s*$/
+
+# The totals in the <testsuite> tag are only known at the end of the log, so room is
+# left for them and they are written over that space once the log has been read.
+    HEADER_WIDTH = 128
+
+    def initialize
+        @xmlOut = false
+        @jobs = 1
+        @xmlName = "report.xml"
+    end
 
 #   Set the flag to indicate if there will be an XML output file or not  
     def setXmlOutput()
         @xmlOut = true
     end
     
-#  if write our output to XML
-    def writeXmlOuput()
-            output = File.open("report.xml", "w")
-            output << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
-            @arrayList.each do |item|
-                output << item << "\n"
-            end
-            output << "</testsuite>\n"
+#   Set how many files may be parsed at the same time
+    def setJobs(jobs)
+        @jobs = (jobs < 1) ? 1 : jobs
     end
     
-#  This function will try and determine when the suite is changed.   This is
-# is the name that gets added to the classname parameter.
-    def  testSuiteVerify(testSuiteName)
-        if @testFlag == false
-            @testFlag = true;
-            # Split the path name 
-            testName = testSuiteName.split("/")
-            # Remove the extension
-            baseName = testName[testName.size - 1].split(".")
-            @testSuite = "test." + baseName[0]
-            printf "New Test: %s\n", @testSuite
-        end
+#  Characters that may not appear as they are in XML attribute values
+    def xmlEscape(text)
+        text.gsub(/[&<>"]/, '&' => '&amp;', '<' => '&lt;', '>' => '&gt;', '"' => '&quot;')
     end
-    
 
-# Test was flagged as having passed so format the output
-    def testPassed(array)
-        lastItem = array.length - 1
-        testName = array[lastItem - 1]
-        testSuiteVerify(array[@className])
-        printf "%-40s PASS\n", testName
-        if @xmlOut == true
-            @arrayList.push "     <testcase classname=\"" + @testSuite + "\" name=\"" + testName + "\"/>"
-        end          
+#  This is the name that gets added to the classname parameter.
+    def testSuiteName(path)
+        # Split the path name (either separator) and remove the extension
+        baseName = path.split(/[\\\/]/).last.split(".")
+        "test." + baseName[0]
     end
 
-# Test was flagged as being ingored so format the output
-    def testIgnored(array)
-        lastItem = array.length - 1
-        testName = array[lastItem - 2]
-        reason = array[lastItem].chomp
-        testSuiteVerify(array[@className])
-        printf "%-40s IGNORED\n", testName
-        if @xmlOut == true
-            @arrayList.push "     <testcase classname=\"" + @testSuite + "\" name=\"" + testName + "\">"
-            @arrayList.push "            <skipped type=\"TEST IGNORED\"> " + reason + " </skipped>"
-            @arrayList.push "     </testcase>"
-        end          
+#  Write one <testcase> element straight to the report
+    def writeTestCase(output, suite, testName, tag = nil, type = nil, reason = nil)
+        output << "     <testcase classname=\"" + xmlEscape(suite) + "\" name=\"" + xmlEscape(testName) + "\""
+        if tag.nil?
+            output << "/>\n"
+        else
+            output << ">\n"
+            output << "            <" + tag + " type=\"" + type + "\"> " + xmlEscape(reason) + " </" + tag + ">\n"
+            output << "     </testcase>\n"
+        end
     end
+    
+# Main function used to parse the file that was captured.
+    def process(name, xmlName = @xmlName, standalone = true)
+        verbose = (@jobs == 1)
+        testPass = 0
+        testFail = 0
+        testIgnore = 0
+        lastSuite = nil
+        output = nil
+        headerPos = 0
 
-# Test was flagged as having failed  so format the line
-    def testFailed(array)
-        lastItem = array.length - 1
-        testName = array[lastItem - 2]
-        reason = array[lastItem].chomp + " at line: " + array[lastItem - 3]
-        testSuiteVerify(array[@className])
-        printf "%-40s FAILED\n", testName
-        if @xmlOut == true
-            @arrayList.push "     <testcase classname=\"" + @testSuite + "\" name=\"" + testName + "\">"
-            @arrayList.push "            <failure type=\"ASSERT FAILED\"> " + reason + " </failure>"
-            @arrayList.push "     </testcase>"
-        end          
-    end
+        if @xmlOut
+            output = File.open(xmlName, "wb")
+            output << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" if standalone
+            headerPos = output.pos
+            output << (" " * HEADER_WIDTH) << "\n"
+        end
 
-    
-# Figure out what OS we are running on.   For now we are assuming if it's not Windows it must
-# be Unix based.  
-    def detectOS()
-        myOS = RUBY_PLATFORM.split("-")
-        if myOS.size == 2
-            if myOS[1] == "mingw32"
-                @className = 1
-            else
-                @className = 0
+        if verbose
+            puts "Parsing file: " + name
+            puts ""
+            puts "=================== RESULTS ====================="
+            puts ""
+        end
+
+        File.foreach(name, :mode => "rb") do |line|
+            match = TEST_LINE.match(line)
+            next if match.nil?
+
+            suite = testSuiteName(match[1])
+            testName = match[3]
+            if verbose and (suite != lastSuite)
+                printf "New Test: %s\n", suite
+                lastSuite = suite
+            end
+
+            case match[4]
+            when "PASS"
+                testPass += 1
+                printf "%-40s PASS\n", testName if verbose
+                writeTestCase(output, suite, testName) if output
+            when "FAIL"
+                testFail += 1
+                printf "%-40s FAILED\n", testName if verbose
+                writeTestCase(output, suite, testName, "failure", "ASSERT FAILED", match[5] + " at line: " + match[2]) if output
+            when "IGNORE"
+                testIgnore += 1
+                printf "%-40s IGNORED\n", testName if verbose
+                writeTestCase(output, suite, testName, "skipped", "TEST IGNORED", match[5]) if output
             end
         end
-        
+
+        summary = [ "",
+                    "=================== SUMMARY =====================",
+                    "",
+                    "Tests Passed  : " + testPass.to_s,
+                    "Tests Failed  : " + testFail.to_s,
+                    "Tests Ignored : " + testIgnore.to_s ]
+        summary.unshift("Parsed file: " + name) unless verbose
+        puts summary.join("\n")
+
+        if output
+            output << "</testsuite>\n"
+            heading = "<testsuite tests=\"" + (testPass + testFail + testIgnore).to_s + "\" failures=\"" + testFail.to_s + "\"" + " skips=\"" + testIgnore.to_s + "\""
+            output.seek(headerPos)
+            output << heading.ljust(HEADER_WIDTH - 1) << ">"
+            output.close
+        end          
     end
 
-# Main function used to parse the file that was captured.
-    def process(name)
-        @testFlag = false
-        @arrayList = Array.new
+#  Parse each file, up to @jobs at a time, then join the per-file results into one report
+    def processAll(names)
+        if names.size == 1
+            process(names[0])
+            return
+        end
 
-        detectOS()
+        parts = names.each_index.map { |i| @xmlName + ".part" + i.to_s }
+        runJobs(names.zip(parts)) { |name, part| process(name, part, false) }
 
-        puts "Parsing file: " + name
-    
-      
-        testPass = 0
-        testFail = 0
-        testIgnore = 0
-        puts ""
-        puts "=================== RESULTS ====================="
-        puts ""
-        File.open(name).each do |line|
-        # Typical test lines look like this:
-        # <path>/<test_file>.c:36:test_tc1000_opsys:FAIL: Expected 1 Was 0
-        # <path>/<test_file>.c:112:test_tc5004_initCanChannel:IGNORE: Not Yet Implemented
-        # <path>/<test_file>.c:115:test_tc5100_initCanVoidPtrs:PASS
-        #
-        # where path is different on Unix vs Windows devices (Windows leads with a drive letter)
-            lineArray = line.split(":")
-            lineSize = lineArray.size
-            # If we were able to split the line then we can look to see if any of our target words
-            # were found.  Case is important.
-            if lineSize >= 4
-                # Determine if this test passed
-                if  line.include? ":PASS"
-                    testPassed(lineArray)
-                    testPass += 1
-                elsif line.include? ":FAIL:"
-                    testFailed(lineArray)
-                    testFail += 1
-                elsif line.include? ":IGNORE:"
-                    testIgnored(lineArray)
-                    testIgnore += 1
-                # If none of the keywords are found there are no more tests for this suite so clear
-                # the test flag
-                else
-                    @testFlag = false
-                end
-            else
-                @testFlag = false
+        if @xmlOut
+            File.open(@xmlName, "wb") do |output|
+                output << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                output << "<testsuites>\n"
+                parts.each do |part|
+                    File.open(part, "rb") { |input| IO.copy_stream(input, output) }
+                    File.delete(part)
                 end
+                output << "</testsuites>\n"
             end
-        puts ""
-        puts "=================== SUMMARY ====================="
-        puts ""
-        puts "Tests Passed  : " + testPass.to_s
-        puts "Tests Failed  : " + testFail.to_s
-        puts "Tests Ignored : " + testIgnore.to_s
-        @totalTests = testPass + testFail + testIgnore
-        if @xmlOut == true
-            heading = "<testsuite tests=\"" +  @totalTests.to_s  + "\" failures=\"" + testFail.to_s + "\""  + " skips=\"" +  testIgnore.to_s + "\">" 
-            @arrayList.insert(0, heading) 
-            writeXmlOuput()
-        end
+        end          
+    end
+
+#  Run the block for each work item on @jobs workers. Worker processes are used where fork
+# is available, so parsing is not serialized by the interpreter lock; threads otherwise.
+    def runJobs(work, &block)
+        groups = Array.new([@jobs, work.size].min) { [] }
+        work.each_with_index { |item, i| groups[i % groups.size] << item }
 
-    #  return result
+        if Process.respond_to?(:fork)
+            groups.each { |group| fork { group.each { |item| block.call(*item) } } }
+            failed = Process.waitall.count { |pid, status| !status.success? }
+            raise "#{failed} parser job(s) failed" if failed > 0
+        else
+            groups.map { |group| Thread.new { group.each { |item| block.call(*item) } } }.each(&:join)
+        end          
     end
 
  end
 
 # If the command line has no values in, used a default value of Output.txt
 parseMyFile = ParseOutput.new
+files = []
 
 if ARGV.size >= 1 
-    ARGV.each do |a|
+    args = ARGV.dup
+    while (a = args.shift)
         if a == "-xml"
             parseMyFile.setXmlOutput();
+        elsif a =~ /^--jobs=(\d+)$/
+            parseMyFile.setJobs($1.to_i)
+        elsif a == "--jobs"
+            parseMyFile.setJobs(args.shift.to_i)
         else
-            parseMyFile.process(a)
-            break
+            files << a
         end
     end
+    parseMyFile.processAll(files) unless files.empty?
 end
@@ -10,40 +10,53 @@
 #
 require 'fileutils'
 require 'set'
+require 'json'
+require 'digest/sha1'
+require 'etc'
 
 class UnityTestSummary
   include FileUtils::Verbose
 
-  attr_reader :report, :total_tests, :failures, :ignored
+  attr_reader :report, :total_tests, :failures, :ignored, :assertions
+
+  # bump this when the layout of a cached entry changes
+  CACHE_VERSION = 1
 
   def initialize
     @report = ''
     @total_tests = 0
     @failures = 0
     @ignored = 0
+    @assertions = 0
+    @cache_file = nil
+    @json_file = nil
+    @jobs = (Etc.respond_to?(:nprocessors) ? Etc.nprocessors : 1)
   end
 
   def run
     # Clean up result file names
     results = @targets.map {|target| target.gsub(/\\/,'/')}
 
-    # Dig through each result file, looking for details on pass/fail:
+    # Dig through each result file, looking for details on pass/fail.
+    # Files that have not changed since the last run are taken from the cache.
+    cache = load_cache
+    summaries = summarize_all(results, cache)
+    save_cache(summaries)
+
     failure_output = []
     ignore_output = []
+    @file_results = []
 
     results.each do |result_file|
-      lines = File.readlines(result_file).map { |line| line.chomp }
-      if lines.length == 0
-        raise "Empty test result file: #{result_file}"
-      else
-        output = get_details(result_file, lines)
-        failure_output << output[:failures] unless output[:failures].empty?
-        ignore_output  << output[:ignores]  unless output[:ignores].empty?
-        tests,failures,ignored = parse_test_summary(lines)
-        @total_tests += tests
-        @failures += failures
-        @ignored += ignored
-      end
+      summary = summaries[result_file]
+      failure_output << summary['failures'].map { |line| format_line(line) } unless summary['failures'].empty?
+      ignore_output  << summary['ignores'].map { |line| format_line(line) }  unless summary['ignores'].empty?
+      @total_tests += summary['tests']
+      @failures += summary['failed']
+      @ignored += summary['ignored']
+      @assertions += summary['assertions']
+      @file_results << { 'file' => result_file, 'tests' => summary['tests'], 'assertions' => summary['assertions'],
+                         'failures' => summary['failed'], 'ignored' => summary['ignored'] }
     end
 
     if @ignored > 0
@@ -68,6 +81,9 @@ class UnityTestSummary
     @report += "--------------------------\n"
     @report += "#{@total_tests} TOTAL TESTS #{@failures} TOTAL FAILURES #{@ignored} IGNORED\n"
     @report += "\n"
+
+    write_json(failure_output.flatten, ignore_output.flatten) unless @json_file.nil?
+    return @report
   end
 
   def set_targets(target_array)
@@ -78,6 +94,20 @@ class UnityTestSummary
     @root = path
   end
 
+  # parsed result files are remembered here between runs, keyed by file name
+  def set_cache_file(path)
+    @cache_file = path
+  end
+
+  # also write the combined summary to this file as JSON
+  def set_json_file(path)
+    @json_file = path
+  end
+
+  def set_jobs(jobs)
+    @jobs = [jobs.to_i, 1].max
+  end
+
   def usage(err_msg=nil)
     puts "\nERROR: "
     puts err_msg if err_msg
@@ -86,28 +116,123 @@ class UnityTestSummary
     puts "                             Defaults to current directory if not specified."
     puts "                             Should end in / if specified."
     puts "     root_path - Helpful for producing more verbose output if using relative paths."
+    puts "     --cache=file - Remember parsed result files here and only re-read the ones that changed."
+    puts "     --json=file  - Also write the combined summary to this file as JSON."
+    puts "     --jobs=N     - Number of result files to parse at the same time."
     exit 1
   end
 
   protected
 
+  # Files are parsed on up to @jobs worker processes where fork is available (threads would
+  # all wait on the interpreter lock), each sending its summaries back through a pipe as JSON.
+  def summarize_all(results, cache)
+    jobs = [@jobs, results.size].min
+    if (jobs <= 1) or !Process.respond_to?(:fork)
+      return summarize_group(results, cache)
+    end
+
+    groups = Array.new(jobs) { [] }
+    results.each_with_index { |result_file, i| groups[i % jobs] << result_file }
+    workers = groups.map do |group|
+      reader, writer = IO.pipe
+      pid = fork do
+        reader.close
+        begin
+          writer.write(JSON.generate('summaries' => summarize_group(group, cache)))
+        rescue Exception => e
+          writer.write(JSON.generate('error' => e.message))
+        end
+        writer.close
+        exit!(0)
+      end
+      writer.close
+      [pid, reader]
+    end
+
+    summaries = {}
+    errors = []
+    workers.each do |pid, reader|
+      reply = JSON.parse(reader.read)
+      reader.close
+      Process.wait(pid)
+      errors << reply['error'] if reply['error']
+      summaries.merge!(reply['summaries']) if reply['summaries']
+    end
+    raise errors.first unless errors.empty?
+    return summaries
+  end
+
+  def summarize_group(result_files, cache)
+    summaries = {}
+    result_files.each { |result_file| summaries[result_file] = summarize(result_file, cache[result_file]) }
+    return summaries
+  end
+
+  # A cached summary is reused when the file's mtime and size are unchanged, or when they
+  # changed but the contents hash the same (e.g. the file was rewritten by a clean build).
+  def summarize(result_file, cached)
+    stat = File.stat(result_file)
+    mtime = stat.mtime.to_f
+    if cached and (cached['mtime'] == mtime) and (cached['size'] == stat.size)
+      return cached
+    end
+
+    contents = File.read(result_file)
+    digest = Digest::SHA1.hexdigest(contents)
+    if cached and (cached['digest'] == digest)
+      return cached.merge('mtime' => mtime, 'size' => stat.size)
+    end
+
+    lines = contents.split(/\r?\n/)
+    raise "Empty test result file: #{result_file}" if lines.length == 0
+    details = get_details(result_file, lines)
+    tests,assertions,failures,ignored = parse_test_summary(lines)
+    return { 'mtime' => mtime, 'size' => stat.size, 'digest' => digest,
+             'tests' => tests, 'assertions' => assertions, 'failed' => failures, 'ignored' => ignored,
+             'failures' => details[:failures], 'ignores' => details[:ignores] }
+  end
+
+  def load_cache
+    return {} if @cache_file.nil? or !File.exist?(@cache_file)
+    cache = JSON.parse(File.read(@cache_file))
+    return (cache['version'] == CACHE_VERSION) ? cache['files'] : {}
+  rescue JSON::ParserError
+    return {}
+  end
+
+  def save_cache(summaries)
+    return if @cache_file.nil?
+    File.open(@cache_file, 'w') { |f| f.write(JSON.generate('version' => CACHE_VERSION, 'files' => summaries)) }
+  end
+
+  def write_json(failure_output, ignore_output)
+    summary = { 'total_tests' => @total_tests, 'total_assertions' => @assertions,
+                'total_failures' => @failures, 'total_ignored' => @ignored,
+                'files' => @file_results, 'failed_tests' => failure_output, 'ignored_tests' => ignore_output }
+    File.open(@json_file, 'w') { |f| f.write(JSON.pretty_generate(summary)) }
+  end
+
+  def format_line(line)
+    ((@root and (@root != 0)) ? "#{@root}#{line}" : line ).gsub(/\//, "\\")
+  end
+
   def get_details(result_file, lines)
     results = { :failures => [], :ignores => [], :successes => [] }
     lines.each do |line|
       src_file,src_line,test_name,status,msg = line.split(/:/)
-      line_out = ((@root and (@root != 0)) ? "#{@root}#{line}" : line ).gsub(/\//, "\\")
       case(status)
-        when 'IGNORE' then results[:ignores]   << line_out
-        when 'FAIL'   then results[:failures]  << line_out
-        when 'PASS'   then results[:successes] << line_out
+        when 'IGNORE' then results[:ignores]   << line
+        when 'FAIL'   then results[:failures]  << line
+        when 'PASS'   then results[:successes] << line
       end
     end
     return results
   end
 
   def parse_test_summary(summary)
-    if summary.find { |v| v =~ /(\d+) Tests (\d+) Failures (\d+) Ignored/ }
-      [$1.to_i,$2.to_i,$3.to_i]
+    if summary.find { |v| v =~ /(\d+) Tests (?:(\d+) Assertions )?(\d+) Failures (\d+) Ignored/ }
+      [$1.to_i,$2.to_i,$3.to_i,$4.to_i]
     else
       raise "Couldn't parse test results: #{summary}"
     end
@@ -120,6 +245,16 @@ end
 if $0 == __FILE__
   uts = UnityTestSummary.new
   begin
+    #pull out the options first
+    ARGV.reject! do |arg|
+      case(arg)
+        when /^--cache=(.+)$/ then uts.set_cache_file($1); true
+        when /^--json=(.+)$/  then uts.set_json_file($1); true
+        when /^--jobs=(\d+)$/ then uts.set_jobs($1); true
+        else false
+      end
+    end
+
     #look in the specified or current directory for result files
     ARGV[0] ||= './'
     targets = "#{ARGV[0].gsub(/\\/, '/')}*.test*"
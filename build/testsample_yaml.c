@@ -0,0 +1,94 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=============CLRWDT macro for XC8 only=============
+#if defined(__XC8)
+#define ClearWDT() CLRWDT()
+#else   // defined(__XC8)
+#define ClearWDT()
+#endif  // defined(__XC8)
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      if (Unity.setUp) \
+      { \
+        Unity.setUp(); \
+      } \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    if (Unity.tearDown) \
+    { \
+      Unity.tearDown(); \
+    } \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include "two.h"
+#include "three.h"
+#include <four.h>
+#if defined(__XC8)
+#include <xc.h>
+#else   // defined(__XC8)
+#include <setjmp.h>
+#endif  // defined(__XC8)
+#include <stdio.h>
+#include "CException.h"
+
+//=======Suite Setup=====
+static int suite_setup(void)
+{
+a_yaml_setup();
+}
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_TheFirstThingToTest(void);
+extern void test_TheSecondThingToTest(void);
+
+
+//=======Test Reset Option=====
+void resetTest()
+{
+  if (Unity.tearDown)
+  {
+    Unity.tearDown();
+  }
+  if (Unity.setUp)
+  {
+    Unity.setUp();
+  }
+}
+
+
+//=======MAIN=====
+#if defined(__XC8)
+void main(void)
+#else   // defined(__XC8)
+int main(void)
+#endif  // defined(__XC8)
+{
+  suite_setup();
+  UnityBegin("test/testdata/testsample.c",setUp,tearDown);
+  RUN_TEST(test_TheFirstThingToTest, 21);
+  RUN_TEST(test_TheSecondThingToTest, 43);
+
+#if defined(__XC8)
+  (UnityEnd());
+#else   // defined(__XC8)
+  return (UnityEnd());
+#endif  // defined(__XC8)
+}
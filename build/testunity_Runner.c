@@ -0,0 +1,674 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=============CLRWDT macro for XC8 only=============
+#if defined(__XC8)
+#define ClearWDT() CLRWDT()
+#else   // defined(__XC8)
+#define ClearWDT()
+#endif  // defined(__XC8)
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      if (Unity.setUp) \
+      { \
+        Unity.setUp(); \
+      } \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    if (Unity.tearDown) \
+    { \
+      Unity.tearDown(); \
+    } \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#if defined(__XC8)
+#include <xc.h>
+#else   // defined(__XC8)
+#include <setjmp.h>
+#endif  // defined(__XC8)
+#include <stdio.h>
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void testUnitySizeInitializationReminder(void);
+extern void testTrue(void);
+extern void testFalse(void);
+extern void testPreviousPass(void);
+extern void testNotVanilla(void);
+extern void testNotTrue(void);
+extern void testNotFalse(void);
+extern void testNotUnless(void);
+extern void testNotNotEqual(void);
+extern void testFail(void);
+extern void testIsNull(void);
+extern void testIsNullShouldFailIfNot(void);
+extern void testNotNullShouldFailIfNULL(void);
+extern void testIgnore(void);
+extern void testIgnoreMessage(void);
+extern void testNotEqualInts(void);
+extern void testNotEqualInt8s(void);
+extern void testNotEqualInt16s(void);
+extern void testNotEqualInt32s(void);
+extern void testNotEqualBits(void);
+extern void testNotEqualUInts(void);
+extern void testNotEqualUInt8s(void);
+extern void testNotEqualUInt16s(void);
+extern void testNotEqualUInt32s(void);
+extern void testNotEqualHex8s(void);
+extern void testNotEqualHex8sIfSigned(void);
+extern void testNotEqualHex16s(void);
+extern void testNotEqualHex16sIfSigned(void);
+extern void testNotEqualHex32s(void);
+extern void testNotEqualHex32sIfSigned(void);
+extern void testEqualInts(void);
+extern void testEqualInt8s(void);
+extern void testEqualInt8sWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualInt16s(void);
+extern void testEqualInt16sNegatives(void);
+extern void testEqualInt16sWhenThereAreDifferencesOutside16Bits(void);
+extern void testEqualInt32s(void);
+extern void testEqualInt32sNegatives(void);
+extern void testEqualUints(void);
+extern void testEqualUint8s(void);
+extern void testEqualUint8sWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualUint16s(void);
+extern void testEqualUint16sWhenThereAreDifferencesOutside16Bits(void);
+extern void testEqualUint32s(void);
+extern void testNotEqual(void);
+extern void testEqualHex8s(void);
+extern void testEqualHex8sWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualHex8sNegatives(void);
+extern void testEqualHex16s(void);
+extern void testEqualHex16sWhenThereAreDifferencesOutside16Bits(void);
+extern void testEqualHex32s(void);
+extern void testEqualBits(void);
+extern void testNotEqualBitHigh(void);
+extern void testNotEqualBitLow(void);
+extern void testNotEqualBitsHigh(void);
+extern void testNotEqualBitsLow(void);
+extern void testEqualShorts(void);
+extern void testEqualUShorts(void);
+extern void testEqualChars(void);
+extern void testEqualUChars(void);
+extern void testEqualPointers(void);
+extern void testNotEqualPointers(void);
+extern void testIntsWithinDelta(void);
+extern void testIntsWithinDeltaAndCustomMessage(void);
+extern void testIntsNotWithinDelta(void);
+extern void testIntsNotWithinDeltaAndCustomMessage(void);
+extern void testUIntsWithinDelta(void);
+extern void testUIntsWithinDeltaAndCustomMessage(void);
+extern void testUIntsNotWithinDelta(void);
+extern void testUIntsNotWithinDeltaAndCustomMessage(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage(void);
+extern void testHEX32sWithinDelta(void);
+extern void testHEX32sWithinDeltaAndCustomMessage(void);
+extern void testHEX32sNotWithinDelta(void);
+extern void testHEX32sNotWithinDeltaAndCustomMessage(void);
+extern void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+extern void testHEX16sWithinDelta(void);
+extern void testHEX16sWithinDeltaAndCustomMessage(void);
+extern void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+extern void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+extern void testHEX16sNotWithinDelta(void);
+extern void testHEX16sNotWithinDeltaAndCustomMessage(void);
+extern void testHEX8sWithinDelta(void);
+extern void testHEX8sWithinDeltaAndCustomMessage(void);
+extern void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testHEX8sNotWithinDelta(void);
+extern void testHEX8sNotWithinDeltaAndCustomMessage(void);
+extern void testUINT32sWithinDelta(void);
+extern void testUINT32sWithinDeltaAndCustomMessage(void);
+extern void testUINT32sNotWithinDelta(void);
+extern void testUINT32sNotWithinDeltaAndCustomMessage(void);
+extern void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+extern void testUINT16sWithinDelta(void);
+extern void testUINT16sWithinDeltaAndCustomMessage(void);
+extern void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+extern void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+extern void testUINT16sNotWithinDelta(void);
+extern void testUINT16sNotWithinDeltaAndCustomMessage(void);
+extern void testUINT8sWithinDelta(void);
+extern void testUINT8sWithinDeltaAndCustomMessage(void);
+extern void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testUINT8sNotWithinDelta(void);
+extern void testUINT8sNotWithinDeltaAndCustomMessage(void);
+extern void testINT32sWithinDelta(void);
+extern void testINT32sWithinDeltaAndCustomMessage(void);
+extern void testINT32sNotWithinDelta(void);
+extern void testINT32sNotWithinDeltaAndCustomMessage(void);
+extern void testINT16sWithinDelta(void);
+extern void testINT16sWithinDeltaAndCustomMessage(void);
+extern void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+extern void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+extern void testINT16sNotWithinDelta(void);
+extern void testINT16sNotWithinDeltaAndCustomMessage(void);
+extern void testINT8sWithinDelta(void);
+extern void testINT8sWithinDeltaAndCustomMessage(void);
+extern void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testINT8sNotWithinDelta(void);
+extern void testINT8sNotWithinDeltaAndCustomMessage(void);
+extern void testEqualStrings(void);
+extern void testEqualStringsLen(void);
+extern void testEqualStringsWithCarriageReturnsAndLineFeeds(void);
+extern void testNotEqualString1(void);
+extern void testNotEqualStringLen1(void);
+extern void testNotEqualString2(void);
+extern void testNotEqualStringLen2(void);
+extern void testNotEqualString3(void);
+extern void testNotEqualStringLen3(void);
+extern void testNotEqualString4(void);
+extern void testNotEqualStringLen4(void);
+extern void testNotEqualString5(void);
+extern void testNotEqualString_ExpectedStringIsNull(void);
+extern void testNotEqualString_ActualStringIsNull(void);
+extern void testEqualStringArrays(void);
+extern void testNotEqualStringArray1(void);
+extern void testNotEqualStringArray2(void);
+extern void testNotEqualStringArray3(void);
+extern void testNotEqualStringArray4(void);
+extern void testNotEqualStringArray5(void);
+extern void testNotEqualStringArray6(void);
+extern void testEqualStringArrayIfBothNulls(void);
+extern void testEqualMemory(void);
+extern void testNotEqualMemory1(void);
+extern void testNotEqualMemory2(void);
+extern void testNotEqualMemory3(void);
+extern void testNotEqualMemory4(void);
+extern void testEqualIntArrays(void);
+extern void testNotEqualIntArraysNullExpected(void);
+extern void testNotEqualIntArraysNullActual(void);
+extern void testNotEqualIntArrays1(void);
+extern void testNotEqualIntArrays2(void);
+extern void testNotEqualIntArrays3(void);
+extern void testEqualPtrArrays(void);
+extern void testNotEqualPtrArraysNullExpected(void);
+extern void testNotEqualPtrArraysNullActual(void);
+extern void testNotEqualPtrArrays1(void);
+extern void testNotEqualPtrArrays2(void);
+extern void testNotEqualPtrArrays3(void);
+extern void testEqualInt8Arrays(void);
+extern void testNotEqualInt8Arrays(void);
+extern void testEqualUIntArrays(void);
+extern void testNotEqualUIntArrays1(void);
+extern void testNotEqualUIntArrays2(void);
+extern void testNotEqualUIntArrays3(void);
+extern void testEqualInt16Arrays(void);
+extern void testNotEqualInt16Arrays(void);
+extern void testEqualInt32Arrays(void);
+extern void testNotEqualInt32Arrays(void);
+extern void testEqualUINT8Arrays(void);
+extern void testNotEqualUINT8Arrays1(void);
+extern void testNotEqualUINT8Arrays2(void);
+extern void testNotEqualUINT8Arrays3(void);
+extern void testEqualUINT16Arrays(void);
+extern void testNotEqualUINT16Arrays1(void);
+extern void testNotEqualUINT16Arrays2(void);
+extern void testNotEqualUINT16Arrays3(void);
+extern void testEqualUINT32Arrays(void);
+extern void testNotEqualUINT32Arrays1(void);
+extern void testNotEqualUINT32Arrays2(void);
+extern void testNotEqualUINT32Arrays3(void);
+extern void testEqualHEXArrays(void);
+extern void testNotEqualHEXArrays1(void);
+extern void testNotEqualHEXArrays2(void);
+extern void testNotEqualHEXArrays3(void);
+extern void testEqualHEX32Arrays(void);
+extern void testNotEqualHEX32Arrays1(void);
+extern void testNotEqualHEX32Arrays2(void);
+extern void testNotEqualHEX32Arrays3(void);
+extern void testEqualHEX16Arrays(void);
+extern void testNotEqualHEX16Arrays1(void);
+extern void testNotEqualHEX16Arrays2(void);
+extern void testNotEqualHEX16Arrays3(void);
+extern void testEqualHEX8Arrays(void);
+extern void testNotEqualHEX8Arrays1(void);
+extern void testNotEqualHEX8Arrays2(void);
+extern void testNotEqualHEX8Arrays3(void);
+extern void testEqualMemoryArrays(void);
+extern void testNotEqualMemoryArraysExpectedNull(void);
+extern void testNotEqualMemoryArraysActualNull(void);
+extern void testNotEqualMemoryArrays1(void);
+extern void testNotEqualMemoryArrays2(void);
+extern void testNotEqualMemoryArrays3(void);
+extern void testProtection(void);
+extern void testIgnoredAndThenFailInTearDown(void);
+extern void testEqualHex64s(void);
+extern void testEqualUint64s(void);
+extern void testEqualInt64s(void);
+extern void testNotEqualHex64s(void);
+extern void testNotEqualUint64s(void);
+extern void testNotEqualInt64s(void);
+extern void testNotEqualHex64sIfSigned(void);
+extern void testHEX64sWithinDelta(void);
+extern void testHEX64sNotWithinDelta(void);
+extern void testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testUINT64sWithinDelta(void);
+extern void testUINT64sNotWithinDelta(void);
+extern void testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testINT64sWithinDelta(void);
+extern void testINT64sNotWithinDelta(void);
+extern void testEqualHEX64Arrays(void);
+extern void testEqualUint64Arrays(void);
+extern void testEqualInt64Arrays(void);
+extern void testNotEqualHEX64Arrays1(void);
+extern void testNotEqualHEX64Arrays2(void);
+extern void testNotEqualUint64Arrays(void);
+extern void testNotEqualInt64Arrays(void);
+extern void testFloatsWithinDelta(void);
+extern void testFloatsNotWithinDelta(void);
+extern void testFloatsEqual(void);
+extern void testFloatsNotEqual(void);
+extern void testFloatsNotEqualNegative1(void);
+extern void testFloatsNotEqualNegative2(void);
+extern void testFloatsNotEqualActualNaN(void);
+extern void testFloatsNotEqualExpectedNaN(void);
+extern void testFloatsNotEqualBothNaN(void);
+extern void testFloatsNotEqualInfNaN(void);
+extern void testFloatsNotEqualNaNInf(void);
+extern void testFloatsNotEqualActualInf(void);
+extern void testFloatsNotEqualExpectedInf(void);
+extern void testFloatsNotEqualBothInf(void);
+extern void testFloatsNotEqualPlusMinusInf(void);
+extern void testFloatIsInf(void);
+extern void testFloatIsNotInf(void);
+extern void testFloatIsNotNegInf(void);
+extern void testFloatIsNan(void);
+extern void testFloatIsNotNan(void);
+extern void testFloatInfIsNotNan(void);
+extern void testFloatNanIsNotInf(void);
+extern void testEqualFloatArrays(void);
+extern void testNotEqualFloatArraysExpectedNull(void);
+extern void testNotEqualFloatArraysActualNull(void);
+extern void testNotEqualFloatArrays1(void);
+extern void testNotEqualFloatArrays2(void);
+extern void testNotEqualFloatArrays3(void);
+extern void testNotEqualFloatArraysNegative1(void);
+extern void testNotEqualFloatArraysNegative2(void);
+extern void testNotEqualFloatArraysNegative3(void);
+extern void testNotEqualFloatArraysNaN(void);
+extern void testNotEqualFloatArraysInf(void);
+extern void testDoublesWithinDelta(void);
+extern void testDoublesNotWithinDelta(void);
+extern void testDoublesEqual(void);
+extern void testDoublesNotEqual(void);
+extern void testDoublesNotEqualNegative1(void);
+extern void testDoublesNotEqualNegative2(void);
+extern void testDoublesNotEqualActualNaN(void);
+extern void testDoublesNotEqualExpectedNaN(void);
+extern void testDoublesNotEqualBothNaN(void);
+extern void testDoublesNotEqualInfNaN(void);
+extern void testDoublesNotEqualNaNInf(void);
+extern void testDoublesNotEqualActualInf(void);
+extern void testDoublesNotEqualExpectedInf(void);
+extern void testDoublesNotEqualBothInf(void);
+extern void testDoublesNotEqualPlusMinusInf(void);
+extern void testDoubleIsInf(void);
+extern void testDoubleIsNotInf(void);
+extern void testDoubleIsNotNegInf(void);
+extern void testDoubleIsNan(void);
+extern void testDoubleIsNotNan(void);
+extern void testDoubleInfIsNotNan(void);
+extern void testDoubleNanIsNotInf(void);
+extern void testEqualDoubleArrays(void);
+extern void testNotEqualDoubleArraysExpectedNull(void);
+extern void testNotEqualDoubleArraysActualNull(void);
+extern void testNotEqualDoubleArrays1(void);
+extern void testNotEqualDoubleArrays2(void);
+extern void testNotEqualDoubleArrays3(void);
+extern void testNotEqualDoubleArraysNegative1(void);
+extern void testNotEqualDoubleArraysNegative2(void);
+extern void testNotEqualDoubleArraysNegative3(void);
+extern void testNotEqualDoubleArraysNaN(void);
+extern void testNotEqualDoubleArraysInf(void);
+
+
+//=======Test Reset Option=====
+void resetTest()
+{
+  if (Unity.tearDown)
+  {
+    Unity.tearDown();
+  }
+  if (Unity.setUp)
+  {
+    Unity.setUp();
+  }
+}
+
+
+//=======MAIN=====
+#if defined(__XC8)
+void main(void)
+#else   // defined(__XC8)
+int main(void)
+#endif  // defined(__XC8)
+{
+  UnityBegin("test/testunity.c",setUp,tearDown);
+  RUN_TEST(testUnitySizeInitializationReminder, 60);
+  RUN_TEST(testTrue, 91);
+  RUN_TEST(testFalse, 98);
+  RUN_TEST(testPreviousPass, 105);
+  RUN_TEST(testNotVanilla, 110);
+  RUN_TEST(testNotTrue, 117);
+  RUN_TEST(testNotFalse, 124);
+  RUN_TEST(testNotUnless, 131);
+  RUN_TEST(testNotNotEqual, 138);
+  RUN_TEST(testFail, 145);
+  RUN_TEST(testIsNull, 152);
+  RUN_TEST(testIsNullShouldFailIfNot, 161);
+  RUN_TEST(testNotNullShouldFailIfNULL, 170);
+  RUN_TEST(testIgnore, 179);
+  RUN_TEST(testIgnoreMessage, 187);
+  RUN_TEST(testNotEqualInts, 195);
+  RUN_TEST(testNotEqualInt8s, 202);
+  RUN_TEST(testNotEqualInt16s, 209);
+  RUN_TEST(testNotEqualInt32s, 216);
+  RUN_TEST(testNotEqualBits, 223);
+  RUN_TEST(testNotEqualUInts, 230);
+  RUN_TEST(testNotEqualUInt8s, 242);
+  RUN_TEST(testNotEqualUInt16s, 254);
+  RUN_TEST(testNotEqualUInt32s, 266);
+  RUN_TEST(testNotEqualHex8s, 278);
+  RUN_TEST(testNotEqualHex8sIfSigned, 290);
+  RUN_TEST(testNotEqualHex16s, 302);
+  RUN_TEST(testNotEqualHex16sIfSigned, 314);
+  RUN_TEST(testNotEqualHex32s, 326);
+  RUN_TEST(testNotEqualHex32sIfSigned, 338);
+  RUN_TEST(testEqualInts, 350);
+  RUN_TEST(testEqualInt8s, 370);
+  RUN_TEST(testEqualInt8sWhenThereAreDifferencesOutside8Bits, 389);
+  RUN_TEST(testEqualInt16s, 395);
+  RUN_TEST(testEqualInt16sNegatives, 414);
+  RUN_TEST(testEqualInt16sWhenThereAreDifferencesOutside16Bits, 433);
+  RUN_TEST(testEqualInt32s, 439);
+  RUN_TEST(testEqualInt32sNegatives, 458);
+  RUN_TEST(testEqualUints, 478);
+  RUN_TEST(testEqualUint8s, 499);
+  RUN_TEST(testEqualUint8sWhenThereAreDifferencesOutside8Bits, 518);
+  RUN_TEST(testEqualUint16s, 524);
+  RUN_TEST(testEqualUint16sWhenThereAreDifferencesOutside16Bits, 543);
+  RUN_TEST(testEqualUint32s, 549);
+  RUN_TEST(testNotEqual, 568);
+  RUN_TEST(testEqualHex8s, 579);
+  RUN_TEST(testEqualHex8sWhenThereAreDifferencesOutside8Bits, 598);
+  RUN_TEST(testEqualHex8sNegatives, 604);
+  RUN_TEST(testEqualHex16s, 623);
+  RUN_TEST(testEqualHex16sWhenThereAreDifferencesOutside16Bits, 642);
+  RUN_TEST(testEqualHex32s, 648);
+  RUN_TEST(testEqualBits, 667);
+  RUN_TEST(testNotEqualBitHigh, 683);
+  RUN_TEST(testNotEqualBitLow, 692);
+  RUN_TEST(testNotEqualBitsHigh, 701);
+  RUN_TEST(testNotEqualBitsLow, 712);
+  RUN_TEST(testEqualShorts, 722);
+  RUN_TEST(testEqualUShorts, 742);
+  RUN_TEST(testEqualChars, 762);
+  RUN_TEST(testEqualUChars, 782);
+  RUN_TEST(testEqualPointers, 801);
+  RUN_TEST(testNotEqualPointers, 818);
+  RUN_TEST(testIntsWithinDelta, 825);
+  RUN_TEST(testIntsWithinDeltaAndCustomMessage, 837);
+  RUN_TEST(testIntsNotWithinDelta, 849);
+  RUN_TEST(testIntsNotWithinDeltaAndCustomMessage, 856);
+  RUN_TEST(testUIntsWithinDelta, 863);
+  RUN_TEST(testUIntsWithinDeltaAndCustomMessage, 870);
+  RUN_TEST(testUIntsNotWithinDelta, 877);
+  RUN_TEST(testUIntsNotWithinDeltaAndCustomMessage, 884);
+  RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst, 891);
+  RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage, 898);
+  RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst, 905);
+  RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage, 912);
+  RUN_TEST(testHEX32sWithinDelta, 919);
+  RUN_TEST(testHEX32sWithinDeltaAndCustomMessage, 926);
+  RUN_TEST(testHEX32sNotWithinDelta, 933);
+  RUN_TEST(testHEX32sNotWithinDeltaAndCustomMessage, 940);
+  RUN_TEST(testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass, 947);
+  RUN_TEST(testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage, 954);
+  RUN_TEST(testHEX16sWithinDelta, 961);
+  RUN_TEST(testHEX16sWithinDeltaAndCustomMessage, 968);
+  RUN_TEST(testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 975);
+  RUN_TEST(testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 980);
+  RUN_TEST(testHEX16sNotWithinDelta, 985);
+  RUN_TEST(testHEX16sNotWithinDeltaAndCustomMessage, 992);
+  RUN_TEST(testHEX8sWithinDelta, 999);
+  RUN_TEST(testHEX8sWithinDeltaAndCustomMessage, 1006);
+  RUN_TEST(testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1013);
+  RUN_TEST(testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1018);
+  RUN_TEST(testHEX8sNotWithinDelta, 1023);
+  RUN_TEST(testHEX8sNotWithinDeltaAndCustomMessage, 1030);
+  RUN_TEST(testUINT32sWithinDelta, 1039);
+  RUN_TEST(testUINT32sWithinDeltaAndCustomMessage, 1046);
+  RUN_TEST(testUINT32sNotWithinDelta, 1053);
+  RUN_TEST(testUINT32sNotWithinDeltaAndCustomMessage, 1060);
+  RUN_TEST(testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass, 1067);
+  RUN_TEST(testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage, 1074);
+  RUN_TEST(testUINT16sWithinDelta, 1081);
+  RUN_TEST(testUINT16sWithinDeltaAndCustomMessage, 1088);
+  RUN_TEST(testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1095);
+  RUN_TEST(testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1100);
+  RUN_TEST(testUINT16sNotWithinDelta, 1105);
+  RUN_TEST(testUINT16sNotWithinDeltaAndCustomMessage, 1112);
+  RUN_TEST(testUINT8sWithinDelta, 1119);
+  RUN_TEST(testUINT8sWithinDeltaAndCustomMessage, 1126);
+  RUN_TEST(testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1133);
+  RUN_TEST(testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1138);
+  RUN_TEST(testUINT8sNotWithinDelta, 1143);
+  RUN_TEST(testUINT8sNotWithinDeltaAndCustomMessage, 1150);
+  RUN_TEST(testINT32sWithinDelta, 1157);
+  RUN_TEST(testINT32sWithinDeltaAndCustomMessage, 1164);
+  RUN_TEST(testINT32sNotWithinDelta, 1169);
+  RUN_TEST(testINT32sNotWithinDeltaAndCustomMessage, 1176);
+  RUN_TEST(testINT16sWithinDelta, 1183);
+  RUN_TEST(testINT16sWithinDeltaAndCustomMessage, 1190);
+  RUN_TEST(testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1195);
+  RUN_TEST(testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1200);
+  RUN_TEST(testINT16sNotWithinDelta, 1205);
+  RUN_TEST(testINT16sNotWithinDeltaAndCustomMessage, 1212);
+  RUN_TEST(testINT8sWithinDelta, 1219);
+  RUN_TEST(testINT8sWithinDeltaAndCustomMessage, 1226);
+  RUN_TEST(testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1231);
+  RUN_TEST(testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1236);
+  RUN_TEST(testINT8sNotWithinDelta, 1241);
+  RUN_TEST(testINT8sNotWithinDeltaAndCustomMessage, 1248);
+  RUN_TEST(testEqualStrings, 1255);
+  RUN_TEST(testEqualStringsLen, 1266);
+  RUN_TEST(testEqualStringsWithCarriageReturnsAndLineFeeds, 1276);
+  RUN_TEST(testNotEqualString1, 1287);
+  RUN_TEST(testNotEqualStringLen1, 1294);
+  RUN_TEST(testNotEqualString2, 1301);
+  RUN_TEST(testNotEqualStringLen2, 1308);
+  RUN_TEST(testNotEqualString3, 1315);
+  RUN_TEST(testNotEqualStringLen3, 1322);
+  RUN_TEST(testNotEqualString4, 1329);
+  RUN_TEST(testNotEqualStringLen4, 1336);
+  RUN_TEST(testNotEqualString5, 1343);
+  RUN_TEST(testNotEqualString_ExpectedStringIsNull, 1352);
+  RUN_TEST(testNotEqualString_ActualStringIsNull, 1359);
+  RUN_TEST(testEqualStringArrays, 1366);
+  RUN_TEST(testNotEqualStringArray1, 1377);
+  RUN_TEST(testNotEqualStringArray2, 1387);
+  RUN_TEST(testNotEqualStringArray3, 1397);
+  RUN_TEST(testNotEqualStringArray4, 1407);
+  RUN_TEST(testNotEqualStringArray5, 1417);
+  RUN_TEST(testNotEqualStringArray6, 1427);
+  RUN_TEST(testEqualStringArrayIfBothNulls, 1437);
+  RUN_TEST(testEqualMemory, 1445);
+  RUN_TEST(testNotEqualMemory1, 1457);
+  RUN_TEST(testNotEqualMemory2, 1464);
+  RUN_TEST(testNotEqualMemory3, 1471);
+  RUN_TEST(testNotEqualMemory4, 1478);
+  RUN_TEST(testEqualIntArrays, 1485);
+  RUN_TEST(testNotEqualIntArraysNullExpected, 1499);
+  RUN_TEST(testNotEqualIntArraysNullActual, 1509);
+  RUN_TEST(testNotEqualIntArrays1, 1519);
+  RUN_TEST(testNotEqualIntArrays2, 1529);
+  RUN_TEST(testNotEqualIntArrays3, 1539);
+  RUN_TEST(testEqualPtrArrays, 1549);
+  RUN_TEST(testNotEqualPtrArraysNullExpected, 1566);
+  RUN_TEST(testNotEqualPtrArraysNullActual, 1578);
+  RUN_TEST(testNotEqualPtrArrays1, 1590);
+  RUN_TEST(testNotEqualPtrArrays2, 1603);
+  RUN_TEST(testNotEqualPtrArrays3, 1616);
+  RUN_TEST(testEqualInt8Arrays, 1629);
+  RUN_TEST(testNotEqualInt8Arrays, 1643);
+  RUN_TEST(testEqualUIntArrays, 1653);
+  RUN_TEST(testNotEqualUIntArrays1, 1667);
+  RUN_TEST(testNotEqualUIntArrays2, 1677);
+  RUN_TEST(testNotEqualUIntArrays3, 1687);
+  RUN_TEST(testEqualInt16Arrays, 1697);
+  RUN_TEST(testNotEqualInt16Arrays, 1711);
+  RUN_TEST(testEqualInt32Arrays, 1721);
+  RUN_TEST(testNotEqualInt32Arrays, 1735);
+  RUN_TEST(testEqualUINT8Arrays, 1745);
+  RUN_TEST(testNotEqualUINT8Arrays1, 1759);
+  RUN_TEST(testNotEqualUINT8Arrays2, 1769);
+  RUN_TEST(testNotEqualUINT8Arrays3, 1779);
+  RUN_TEST(testEqualUINT16Arrays, 1790);
+  RUN_TEST(testNotEqualUINT16Arrays1, 1804);
+  RUN_TEST(testNotEqualUINT16Arrays2, 1814);
+  RUN_TEST(testNotEqualUINT16Arrays3, 1824);
+  RUN_TEST(testEqualUINT32Arrays, 1834);
+  RUN_TEST(testNotEqualUINT32Arrays1, 1848);
+  RUN_TEST(testNotEqualUINT32Arrays2, 1858);
+  RUN_TEST(testNotEqualUINT32Arrays3, 1868);
+  RUN_TEST(testEqualHEXArrays, 1878);
+  RUN_TEST(testNotEqualHEXArrays1, 1892);
+  RUN_TEST(testNotEqualHEXArrays2, 1902);
+  RUN_TEST(testNotEqualHEXArrays3, 1912);
+  RUN_TEST(testEqualHEX32Arrays, 1922);
+  RUN_TEST(testNotEqualHEX32Arrays1, 1936);
+  RUN_TEST(testNotEqualHEX32Arrays2, 1946);
+  RUN_TEST(testNotEqualHEX32Arrays3, 1956);
+  RUN_TEST(testEqualHEX16Arrays, 1966);
+  RUN_TEST(testNotEqualHEX16Arrays1, 1980);
+  RUN_TEST(testNotEqualHEX16Arrays2, 1990);
+  RUN_TEST(testNotEqualHEX16Arrays3, 2000);
+  RUN_TEST(testEqualHEX8Arrays, 2010);
+  RUN_TEST(testNotEqualHEX8Arrays1, 2024);
+  RUN_TEST(testNotEqualHEX8Arrays2, 2034);
+  RUN_TEST(testNotEqualHEX8Arrays3, 2044);
+  RUN_TEST(testEqualMemoryArrays, 2054);
+  RUN_TEST(testNotEqualMemoryArraysExpectedNull, 2068);
+  RUN_TEST(testNotEqualMemoryArraysActualNull, 2078);
+  RUN_TEST(testNotEqualMemoryArrays1, 2088);
+  RUN_TEST(testNotEqualMemoryArrays2, 2098);
+  RUN_TEST(testNotEqualMemoryArrays3, 2108);
+  RUN_TEST(testProtection, 2118);
+  RUN_TEST(testIgnoredAndThenFailInTearDown, 2136);
+  RUN_TEST(testEqualHex64s, 2144);
+  RUN_TEST(testEqualUint64s, 2167);
+  RUN_TEST(testEqualInt64s, 2190);
+  RUN_TEST(testNotEqualHex64s, 2214);
+  RUN_TEST(testNotEqualUint64s, 2230);
+  RUN_TEST(testNotEqualInt64s, 2246);
+  RUN_TEST(testNotEqualHex64sIfSigned, 2262);
+  RUN_TEST(testHEX64sWithinDelta, 2278);
+  RUN_TEST(testHEX64sNotWithinDelta, 2289);
+  RUN_TEST(testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass, 2300);
+  RUN_TEST(testUINT64sWithinDelta, 2311);
+  RUN_TEST(testUINT64sNotWithinDelta, 2322);
+  RUN_TEST(testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass, 2333);
+  RUN_TEST(testINT64sWithinDelta, 2344);
+  RUN_TEST(testINT64sNotWithinDelta, 2355);
+  RUN_TEST(testEqualHEX64Arrays, 2366);
+  RUN_TEST(testEqualUint64Arrays, 2384);
+  RUN_TEST(testEqualInt64Arrays, 2402);
+  RUN_TEST(testNotEqualHEX64Arrays1, 2421);
+  RUN_TEST(testNotEqualHEX64Arrays2, 2435);
+  RUN_TEST(testNotEqualUint64Arrays, 2449);
+  RUN_TEST(testNotEqualInt64Arrays, 2463);
+  RUN_TEST(testFloatsWithinDelta, 2478);
+  RUN_TEST(testFloatsNotWithinDelta, 2490);
+  RUN_TEST(testFloatsEqual, 2501);
+  RUN_TEST(testFloatsNotEqual, 2513);
+  RUN_TEST(testFloatsNotEqualNegative1, 2524);
+  RUN_TEST(testFloatsNotEqualNegative2, 2535);
+  RUN_TEST(testFloatsNotEqualActualNaN, 2546);
+  RUN_TEST(testFloatsNotEqualExpectedNaN, 2557);
+  RUN_TEST(testFloatsNotEqualBothNaN, 2568);
+  RUN_TEST(testFloatsNotEqualInfNaN, 2579);
+  RUN_TEST(testFloatsNotEqualNaNInf, 2590);
+  RUN_TEST(testFloatsNotEqualActualInf, 2601);
+  RUN_TEST(testFloatsNotEqualExpectedInf, 2612);
+  RUN_TEST(testFloatsNotEqualBothInf, 2623);
+  RUN_TEST(testFloatsNotEqualPlusMinusInf, 2634);
+  RUN_TEST(testFloatIsInf, 2645);
+  RUN_TEST(testFloatIsNotInf, 2655);
+  RUN_TEST(testFloatIsNotNegInf, 2666);
+  RUN_TEST(testFloatIsNan, 2677);
+  RUN_TEST(testFloatIsNotNan, 2686);
+  RUN_TEST(testFloatInfIsNotNan, 2697);
+  RUN_TEST(testFloatNanIsNotInf, 2708);
+  RUN_TEST(testEqualFloatArrays, 2719);
+  RUN_TEST(testNotEqualFloatArraysExpectedNull, 2737);
+  RUN_TEST(testNotEqualFloatArraysActualNull, 2751);
+  RUN_TEST(testNotEqualFloatArrays1, 2765);
+  RUN_TEST(testNotEqualFloatArrays2, 2779);
+  RUN_TEST(testNotEqualFloatArrays3, 2793);
+  RUN_TEST(testNotEqualFloatArraysNegative1, 2807);
+  RUN_TEST(testNotEqualFloatArraysNegative2, 2821);
+  RUN_TEST(testNotEqualFloatArraysNegative3, 2835);
+  RUN_TEST(testNotEqualFloatArraysNaN, 2849);
+  RUN_TEST(testNotEqualFloatArraysInf, 2863);
+  RUN_TEST(testDoublesWithinDelta, 2879);
+  RUN_TEST(testDoublesNotWithinDelta, 2891);
+  RUN_TEST(testDoublesEqual, 2903);
+  RUN_TEST(testDoublesNotEqual, 2915);
+  RUN_TEST(testDoublesNotEqualNegative1, 2926);
+  RUN_TEST(testDoublesNotEqualNegative2, 2937);
+  RUN_TEST(testDoublesNotEqualActualNaN, 2948);
+  RUN_TEST(testDoublesNotEqualExpectedNaN, 2959);
+  RUN_TEST(testDoublesNotEqualBothNaN, 2970);
+  RUN_TEST(testDoublesNotEqualInfNaN, 2981);
+  RUN_TEST(testDoublesNotEqualNaNInf, 2992);
+  RUN_TEST(testDoublesNotEqualActualInf, 3003);
+  RUN_TEST(testDoublesNotEqualExpectedInf, 3014);
+  RUN_TEST(testDoublesNotEqualBothInf, 3025);
+  RUN_TEST(testDoublesNotEqualPlusMinusInf, 3036);
+  RUN_TEST(testDoubleIsInf, 3047);
+  RUN_TEST(testDoubleIsNotInf, 3057);
+  RUN_TEST(testDoubleIsNotNegInf, 3068);
+  RUN_TEST(testDoubleIsNan, 3079);
+  RUN_TEST(testDoubleIsNotNan, 3088);
+  RUN_TEST(testDoubleInfIsNotNan, 3099);
+  RUN_TEST(testDoubleNanIsNotInf, 3110);
+  RUN_TEST(testEqualDoubleArrays, 3121);
+  RUN_TEST(testNotEqualDoubleArraysExpectedNull, 3139);
+  RUN_TEST(testNotEqualDoubleArraysActualNull, 3153);
+  RUN_TEST(testNotEqualDoubleArrays1, 3167);
+  RUN_TEST(testNotEqualDoubleArrays2, 3181);
+  RUN_TEST(testNotEqualDoubleArrays3, 3195);
+  RUN_TEST(testNotEqualDoubleArraysNegative1, 3209);
+  RUN_TEST(testNotEqualDoubleArraysNegative2, 3223);
+  RUN_TEST(testNotEqualDoubleArraysNegative3, 3237);
+  RUN_TEST(testNotEqualDoubleArraysNaN, 3251);
+  RUN_TEST(testNotEqualDoubleArraysInf, 3265);
+
+#if defined(__XC8)
+  (UnityEnd());
+#else   // defined(__XC8)
+  return (UnityEnd());
+#endif  // defined(__XC8)
+}
@@ -131,10 +131,20 @@ void UnityIgnoreTest(const char * printableName)
 static int malloc_count;
 static int malloc_fail_countdown = MALLOC_DONT_FAIL;
 
+//Allocations made and bytes asked for during the current test, and the most bytes held at once
+static int malloc_total;
+static size_t malloc_bytes;
+static size_t malloc_bytes_total;
+static size_t malloc_bytes_peak;
+
 void UnityMalloc_StartTest()
 {
     malloc_count = 0;
     malloc_fail_countdown = MALLOC_DONT_FAIL;
+    malloc_total = 0;
+    malloc_bytes = 0;
+    malloc_bytes_total = 0;
+    malloc_bytes_peak = 0;
 }
 
 void UnityMalloc_EndTest()
@@ -151,6 +161,55 @@ void UnityMalloc_MakeMallocFailAfterCount(int countdown)
     malloc_fail_countdown = countdown;
 }
 
+//Start measuring a statement.  The peak is measured from the bytes held now, and the
+//test's own peak is put back when the measurement is checked
+void UnityMalloc_Mark(UNITY_MALLOC_MARK_T* mark)
+{
+    mark->Allocations = malloc_total;
+    mark->Bytes = malloc_bytes;
+    mark->TestPeak = malloc_bytes_peak;
+    malloc_bytes_peak = malloc_bytes;
+}
+
+static size_t UnityMalloc_EndMark(const UNITY_MALLOC_MARK_T* mark)
+{
+    size_t peak = malloc_bytes_peak - mark->Bytes;
+
+    if (mark->TestPeak > malloc_bytes_peak)
+        malloc_bytes_peak = mark->TestPeak;
+    return peak;
+}
+
+static int UnityMalloc_Fail(const char* what, size_t limit, size_t actual, int line)
+{
+    UnityTestResultsFailBegin((UNITY_LINE_TYPE)line);
+    UnityPrint(" Expected At Most ");
+    UnityPrintNumberUnsigned((_U_UINT)limit);
+    UnityPrint(what);
+    UnityPrint(" Was ");
+    UnityPrintNumberUnsigned((_U_UINT)actual);
+    return UnityTestResultsFailEnd(NULL);
+}
+
+int UnityMalloc_AssertAllocations(const UNITY_MALLOC_MARK_T* mark, int most, int line)
+{
+    int allocations = malloc_total - mark->Allocations;
+
+    UnityMalloc_EndMark(mark);
+    if (allocations > most)
+        return UnityMalloc_Fail(" Allocations", (size_t)most, (size_t)allocations, line);
+    return 0;
+}
+
+int UnityMalloc_AssertPeakBytes(const UNITY_MALLOC_MARK_T* mark, size_t most, int line)
+{
+    size_t peak = UnityMalloc_EndMark(mark);
+
+    if (peak > most)
+        return UnityMalloc_Fail(" Peak Bytes", most, peak, line);
+    return 0;
+}
+
 #ifdef malloc
 #undef malloc
 #endif
@@ -184,6 +243,11 @@ void * unity_malloc(size_t size)
     }
 
     malloc_count++;
+    malloc_total++;
+    malloc_bytes += size;
+    malloc_bytes_total += size;
+    if (malloc_bytes > malloc_bytes_peak)
+        malloc_bytes_peak = malloc_bytes;
 
     guard = (Guard*)malloc(size + sizeof(Guard) + 4);
     guard->size = size;
@@ -208,6 +272,7 @@ static void release_memory(void * mem)
     guard--;
 
     malloc_count--;
+    malloc_bytes -= guard->size;
     free(guard);
 }
 
@@ -374,6 +439,16 @@ void UnityConcludeFixtureTest()
         if (UnityFixture.Verbose)
         {
             UnityPrint(" PASS");
+            if (malloc_total > 0)
+            {
+                UNITY_OUTPUT_CHAR(' ');
+                UnityPrintNumberUnsigned((_U_UINT)malloc_total);
+                UnityPrint(" Allocations ");
+                UnityPrintNumberUnsigned((_U_UINT)malloc_bytes_total);
+                UnityPrint(" Bytes, Peak ");
+                UnityPrintNumberUnsigned((_U_UINT)malloc_bytes_peak);
+                UnityPrint(" Bytes");
+            }
             UNITY_OUTPUT_CHAR('\n');
         }
     }
@@ -79,4 +79,16 @@ int UnityMain(int argc, char* argv[], void (*runAllTests)(void));
 
 void UnityMalloc_MakeMallocFailAfterCount(int count);
 
+//Heap use of one statement (which may be a block), counted through the malloc overrides
+#define TEST_ASSERT_ALLOCATIONS_AT_MOST(count, statement)\
+    { UNITY_MALLOC_MARK_T unity_mark; UnityMalloc_Mark(&unity_mark); statement;\
+      if (UnityMalloc_AssertAllocations(&unity_mark, (count), __LINE__) != 0) return; }
+
+#define TEST_ASSERT_NO_ALLOCATIONS(statement)\
+    TEST_ASSERT_ALLOCATIONS_AT_MOST(0, statement)
+
+#define TEST_ASSERT_PEAK_BYTES_AT_MOST(bytes, statement)\
+    { UNITY_MALLOC_MARK_T unity_mark; UnityMalloc_Mark(&unity_mark); statement;\
+      if (UnityMalloc_AssertPeakBytes(&unity_mark, (bytes), __LINE__) != 0) return; }
+
 #endif /* UNITY_FIXTURE_H_ */
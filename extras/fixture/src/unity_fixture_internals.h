@@ -25,9 +25,19 @@ void UnityTestRunner(unityfunction * setup,
         const char * name,
         const char * file, int line);
 
+typedef struct _UNITY_MALLOC_MARK_T
+{
+    int Allocations;
+    size_t Bytes;
+    size_t TestPeak;
+} UNITY_MALLOC_MARK_T;
+
 void UnityIgnoreTest(const char * printableName);
 void UnityMalloc_StartTest(void);
 void UnityMalloc_EndTest(void);
+void UnityMalloc_Mark(UNITY_MALLOC_MARK_T* mark);
+int UnityMalloc_AssertAllocations(const UNITY_MALLOC_MARK_T* mark, int most, int line);
+int UnityMalloc_AssertPeakBytes(const UNITY_MALLOC_MARK_T* mark, size_t most, int line);
 int UnityFailureCount(void);
 int UnityGetCommandLineOptions(int argc, char* argv[]);
 void UnityConcludeFixtureTest(void);
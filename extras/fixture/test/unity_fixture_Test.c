@@ -132,6 +132,27 @@ TEST(UnityFixture, PointerSet)
     TEST_ASSERT_POINTERS_EQUAL(&c2, p2);
 }
 
+TEST(UnityFixture, NoAllocationsInStatement)
+{
+    int i = 0;
+    TEST_ASSERT_NO_ALLOCATIONS(i++);
+    TEST_ASSERT_EQUAL(1, i);
+}
+
+TEST(UnityFixture, AllocationsCountedPerStatement)
+{
+    void* m = malloc(10);
+    TEST_ASSERT_ALLOCATIONS_AT_MOST(2, { free(malloc(1)); free(malloc(2)); });
+    TEST_ASSERT_NO_ALLOCATIONS(free(m));
+}
+
+TEST(UnityFixture, PeakBytesMeasuredFromStatementStart)
+{
+    void* m = malloc(100);
+    TEST_ASSERT_PEAK_BYTES_AT_MOST(30, { free(malloc(20)); free(malloc(30)); });
+    free(m);
+}
+
 //------------------------------------------------------------
 
 TEST_GROUP(UnityCommandOptions);
@@ -339,3 +360,35 @@ TEST(LeakDetection, BufferOverrunFoundDuringRealloc)
     CHECK(strstr(UnityOutputCharSpy_Get(), "Buffer overrun detected during realloc()"));
     Unity.CurrentTestFailed = 0;
 }
+
+TEST(LeakDetection, DetectsTooManyAllocations)
+{
+    UNITY_MALLOC_MARK_T mark;
+    UnityMalloc_Mark(&mark);
+    free(malloc(1));
+    free(malloc(1));
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_AssertAllocations(&mark, 1, __LINE__);
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    CHECK(strstr(UnityOutputCharSpy_Get(), "Expected At Most 1 Allocations Was 2"));
+    Unity.CurrentTestFailed = 0;
+}
+
+TEST(LeakDetection, DetectsPeakBytesOverLimit)
+{
+    UNITY_MALLOC_MARK_T mark;
+    void* m;
+    UnityMalloc_Mark(&mark);
+    m = malloc(16);
+    free(malloc(8));
+    free(m);
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_AssertPeakBytes(&mark, 16, __LINE__);
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    CHECK(strstr(UnityOutputCharSpy_Get(), "Expected At Most 16 Peak Bytes Was 24"));
+    Unity.CurrentTestFailed = 0;
+}
@@ -18,6 +18,9 @@ TEST_GROUP_RUNNER(UnityFixture)
     RUN_TEST_CASE(UnityFixture, ReallocSizeZeroFreesMemAndReturnsNullPointer);
     RUN_TEST_CASE(UnityFixture, CallocFillsWithZero);
     RUN_TEST_CASE(UnityFixture, PointerSet);
+    RUN_TEST_CASE(UnityFixture, NoAllocationsInStatement);
+    RUN_TEST_CASE(UnityFixture, AllocationsCountedPerStatement);
+    RUN_TEST_CASE(UnityFixture, PeakBytesMeasuredFromStatementStart);
 }
 
 TEST_GROUP_RUNNER(UnityCommandOptions)
@@ -38,4 +41,6 @@ TEST_GROUP_RUNNER(LeakDetection)
     RUN_TEST_CASE(LeakDetection, DetectsLeak);
     RUN_TEST_CASE(LeakDetection, BufferOverrunFoundDuringFree);
     RUN_TEST_CASE(LeakDetection, BufferOverrunFoundDuringRealloc);
+    RUN_TEST_CASE(LeakDetection, DetectsTooManyAllocations);
+    RUN_TEST_CASE(LeakDetection, DetectsPeakBytesOverLimit);
 }
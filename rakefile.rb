@@ -33,18 +33,33 @@ task :unit => [:prepare_for_tests] do
   run_tests get_unit_test_files
 end
 
+desc "Test unity amalgamated, with the features that need POSIX headers turned on"
+task :amalgamated => [:prepare_for_tests] do
+  run_amalgamated_tests get_unit_test_files
+end
+
+desc "Test the C++ front-end with each C++ standard the target lists"
+task :cpp => [:prepare_for_tests] do
+  run_cpp_tests get_cpp_test_files
+end
+
 Rake::TestTask.new(:scripts) do |t|
   t.pattern = 'test/test_*.rb'
   t.verbose = true
 end
 
+desc "Compare separate and amalgamated test builds"
+task :measure => [:prepare_for_tests] do
+  measure_build_modes get_unit_test_files
+end
+
 desc "Generate test summary"
 task :summary do
   report_summary
 end
 
 desc "Build and test Unity"
-task :all => [:clean, :prepare_for_tests, :scripts, :unit, :summary]
+task :all => [:clean, :prepare_for_tests, :scripts, :unit, :amalgamated, :cpp, :summary]
 task :default => [:clobber, :all]
 task :ci => [:no_color, :default]
 task :cruise => [:no_color, :default]
@@ -6,6 +6,9 @@
 
 require 'yaml'
 require 'fileutils'
+require 'digest/sha1'
+require 'thread'
+require 'etc'
 require UNITY_ROOT + 'auto/unity_test_summary'
 require UNITY_ROOT + 'auto/generate_test_runner'
 require UNITY_ROOT + 'auto/colour_reporter'
@@ -13,6 +16,10 @@ require UNITY_ROOT + 'auto/colour_reporter'
 module RakefileHelpers
 
   C_EXTENSION = '.c'
+  CPP_EXTENSION = '.cpp'
+
+  # keeps the command lines and output of parallel jobs from interleaving
+  REPORT_LOCK = Mutex.new
   
   def load_configuration(config_file)
     unless ($configured)
@@ -40,6 +47,12 @@ module RakefileHelpers
     FileList.new(path)
   end
   
+  def get_cpp_test_files
+    path = $cfg['compiler']['unit_tests_path'] + 'test*' + CPP_EXTENSION
+    path.gsub!(/\\/, '/')
+    FileList.new(path)
+  end
+  
   def get_local_include_dirs
     include_dirs = $cfg['compiler']['includes']['items'].dup
     include_dirs.delete_if {|dir| dir.is_a?(Array)}
@@ -83,30 +96,62 @@ module RakefileHelpers
     return result
   end
 
-  def build_compiler_fields
-    command  = tackit($cfg['compiler']['path'])
+  # A C++ source is built with compiler:cpp_path instead of compiler:path, with the -std=
+  # option of the target replaced by the C++ standard asked for and without C-only warnings
+  def build_compiler_fields(cpp_standard=nil)
+    command  = tackit(cpp_standard.nil? ? $cfg['compiler']['path'] : $cfg['compiler']['cpp_path'])
     if $cfg['compiler']['defines']['items'].nil?
       defines  = ''
     else
       defines  = squash($cfg['compiler']['defines']['prefix'], $cfg['compiler']['defines']['items'])
     end
-    options  = squash('', $cfg['compiler']['options'])
+    options  = $cfg['compiler']['options']
+    unless cpp_standard.nil?
+      options = options.map { |option| option.to_s.sub(/^-std=.*$/, "-std=#{cpp_standard}") }
+      options = options.reject { |option| option =~ /^-W(error=)?implicit-function-declaration$/ }
+    end
+    options  = squash('', options)
     includes = squash($cfg['compiler']['includes']['prefix'], $cfg['compiler']['includes']['items'])
     includes = includes.gsub(/\\ /, ' ').gsub(/\\\"/, '"').gsub(/\\$/, '') # Remove trailing slashes (for IAR)
     return {:command => command, :defines => defines, :options => options, :includes => includes}
   end
 
-  def compile(file, defines=[])
-    compiler = build_compiler_fields
-    cmd_str  = "#{compiler[:command]}#{compiler[:defines]}#{compiler[:options]}#{compiler[:includes]} #{file} " +
+  def build_dependency_fields
+    return nil if $cfg['compiler']['dependencies'].nil?
+    return {:flag => " #{$cfg['compiler']['dependencies']['flag']}", :extension => $cfg['compiler']['dependencies']['extension']}
+  end
+
+  # Objects are named after the source contents and the complete compiler command line,
+  # so runners built with the same settings share them and a changed define gets a new object.
+  def object_key(file, compiler)
+    Digest::SHA1.hexdigest([compiler[:command], compiler[:defines], compiler[:options], compiler[:includes], File.read(file)].join("\n"))[0,12]
+  end
+
+  # An object left by an earlier build is reused when the compiler's dependency file
+  # (e.g. from gcc -MMD) shows that none of the headers it was built from are newer.
+  # The source itself is already part of the object's name.
+  def object_up_to_date?(file, obj_path, dependencies)
+    return false if dependencies.nil?
+    dep_file = obj_path.ext(dependencies[:extension])
+    return false unless (File.exist?(obj_path) && File.exist?(dep_file))
+    prerequisites = File.read(dep_file).gsub(/\\\r?\n/, ' ').split(/\s+/).reject { |item| item.empty? || (item =~ /:$/) || (item == file) }
+    obj_time = File.mtime(obj_path)
+    prerequisites.all? { |item| File.exist?(item) && (File.mtime(item) <= obj_time) }
+  end
+
+  def compile(file, defines=[], cpp_standard=nil)
+    compiler = build_compiler_fields(cpp_standard)
+    dependencies = build_dependency_fields
+    obj_file = "#{File.basename(file, File.extname(file))}_#{object_key(file, compiler)}#{$cfg['compiler']['object_files']['extension']}"
+    return obj_file if object_up_to_date?(file, $cfg['compiler']['object_files']['destination'] + obj_file, dependencies)
+    cmd_str  = "#{compiler[:command]}#{compiler[:defines]}#{compiler[:options]}#{compiler[:includes]}#{dependencies.nil? ? '' : dependencies[:flag]} #{file} " +
                "#{$cfg['compiler']['object_files']['prefix']}#{$cfg['compiler']['object_files']['destination']}"
-    obj_file = "#{File.basename(file, C_EXTENSION)}#{$cfg['compiler']['object_files']['extension']}"
     execute(cmd_str + obj_file)
     return obj_file
   end
   
-  def build_linker_fields
-    command  = tackit($cfg['linker']['path'])
+  def build_linker_fields(cpp=false)
+    command  = tackit(cpp ? $cfg['linker']['cpp_path'] : $cfg['linker']['path'])
     if $cfg['linker']['options'].nil?
       options  = ''
     else
@@ -121,8 +166,8 @@ module RakefileHelpers
     return {:command => command, :options => options, :includes => includes}
   end
   
-  def link_it(exe_name, obj_list)
-    linker = build_linker_fields
+  def link_it(exe_name, obj_list, cpp=false)
+    linker = build_linker_fields(cpp)
     cmd_str = "#{linker[:command]}#{linker[:options]}#{linker[:includes]} " +
       (obj_list.map{|obj|"#{$cfg['linker']['object_files']['path']}#{obj} "}).join +
       $cfg['linker']['bin_files']['prefix'] + ' ' +
@@ -152,15 +197,47 @@ module RakefileHelpers
   end
   
   def execute(command_string, verbose=true)
-    report command_string
     output = `#{command_string}`.chomp
-    report(output) if (verbose && !output.nil? && (output.length > 0))
+    REPORT_LOCK.synchronize do
+      report command_string
+      report(output) if (verbose && !output.nil? && (output.length > 0))
+    end
     if $?.exitstatus != 0
       raise "Command failed. (Returned #{$?.exitstatus})"
     end
     return output
   end
   
+  def job_count
+    jobs = ENV['UNITY_JOBS'] || $cfg['compiler']['jobs']
+    return jobs.to_i if (!jobs.nil? && (jobs.to_i > 0))
+    return Etc.nprocessors
+  end
+
+  # Call the block for each item on up to job_count threads (the work itself is done by
+  # the compiler and linker processes) and return the results in the order of the items.
+  def run_jobs(items)
+    results = Array.new(items.size)
+    errors = []
+    pending = Queue.new
+    items.each_with_index { |item, index| pending << [item, index] }
+    pending.close
+    workers = Array.new([job_count, items.size].min) do
+      Thread.new do
+        while (job = pending.pop)
+          begin
+            results[job[1]] = yield(job[0])
+          rescue => e
+            REPORT_LOCK.synchronize { errors << e }
+          end
+        end
+      end
+    end
+    workers.each(&:join)
+    raise errors.first unless errors.empty?
+    return results
+  end
+
   def report_summary
     summary = UnityTestSummary.new
     summary.set_root_path(UNITY_ROOT ) 
@@ -168,37 +245,46 @@ module RakefileHelpers
     results_glob.gsub!(/\\/, '/')
     results = Dir[results_glob]
     summary.set_targets(results)
+    summary.set_cache_file($cfg['compiler']['build_path'] + 'summary_cache.json')
+    summary.set_json_file($cfg['compiler']['build_path'] + 'summary.json')
     summary.run
   end
   
-  def run_tests(test_files)
-    report 'Running Unity system tests...'
-    
+  def prepare_test_build
     # Tack on TEST define for compiling unit tests
     load_configuration($cfg_file)
     test_defines = ['TEST']
     $cfg['compiler']['defines']['items'] = [] if $cfg['compiler']['defines']['items'].nil?
-    $cfg['compiler']['defines']['items'] << 'TEST'
-    
+    $cfg['compiler']['defines']['items'] << 'TEST' unless $cfg['compiler']['defines']['items'].include?('TEST')
+    return test_defines
+  end
+  
+  # Build the executables for the unit tests and return their names. An amalgamated build
+  # compiles the framework and each test file inside the test's runner instead of on their own.
+  # runner_options are passed on to the runner generator.
+  def build_tests(test_files, test_defines, amalgamate=false, runner_options={})
     include_dirs = get_local_include_dirs
+    framework_source = ($cfg[:unity][:framework] || :unity).to_s + C_EXTENSION
+    suffix = amalgamate ? '_Amalgamated' : ''
     
-    # Build and execute each unit test
+    # Gather the sources of each unit test
+    test_sources = {}
     test_files.each do |test|
-      obj_list = []
+      sources = []
       
       # Detect dependencies and build required modules
       extract_headers(test).each do |header|
         # Compile corresponding source file if it exists
         src_file = find_source_file(header, include_dirs)
         if !src_file.nil?
-          obj_list << compile(src_file, test_defines)
+          sources << src_file unless (amalgamate && (File.basename(src_file) == framework_source))
         end
       end
       
       # Build the test runner (generate if configured to do so)
       test_base = File.basename(test, C_EXTENSION)
       
-      runner_name = test_base + '_Runner.c'
+      runner_name = test_base + suffix + '_Runner.c'
       runner_path = ''
       
       if $cfg['compiler']['runner_path'].nil?
@@ -207,34 +293,144 @@ module RakefileHelpers
         runner_path = $cfg['compiler']['runner_path'] + runner_name
       end
       
-      options = $cfg[:unity]
+      options = $cfg[:unity].merge(:amalgamate => amalgamate).merge(runner_options)
       options[:use_param_tests] = (test =~ /parameterized/) ? true : false
       UnityTestRunnerGenerator.new(options).run(test, runner_path)
-      obj_list << compile(runner_path, test_defines)
+      sources << runner_path
       
       # Build the test module
-      obj_list << compile(test, test_defines)
-      
-      # Link the test executable
-      link_it(test_base, obj_list)
+      sources << test unless amalgamate
+      test_sources[test] = sources
+    end
+    
+    # Compile each source once, however many tests use it, then link the test executables
+    all_sources = test_sources.values.flatten.uniq
+    objects = Hash[all_sources.zip(run_jobs(all_sources) { |src_file| compile(src_file, test_defines) })]
+    run_jobs(test_files) { |test| link_it(File.basename(test, C_EXTENSION) + suffix, test_sources[test].map { |src_file| objects[src_file] }) }
+    return test_files.map { |test| File.basename(test, C_EXTENSION) + suffix }
+  end
+  
+  def test_command(exe_name)
+    simulator = build_simulator_fields
+    executable = $cfg['linker']['bin_files']['destination'] + exe_name + $cfg['linker']['bin_files']['extension']
+    if simulator.nil?
+      return executable
+    else
+      return "#{simulator[:command]} #{simulator[:pre_support]} #{executable} #{simulator[:post_support]}"
+    end
+  end
+  
+  def run_tests(test_files)
+    report 'Running Unity system tests...'
+    
+    test_defines = prepare_test_build
+    exe_names = build_tests(test_files, test_defines, $cfg[:unity][:amalgamate] ? true : false)
+    
+    test_files.each_with_index do |test, index|
+      save_test_results(File.basename(test, C_EXTENSION), execute(test_command(exe_names[index])))
+    end
+  end
+  
+  # Execute unit test and generate results file
+  def save_test_results(test_base, output)
+    test_results = $cfg['compiler']['build_path'] + test_base
+    if output.match(/OK$/m).nil?
+      test_results += '.testfail'
+    else
+      test_results += '.testpass'
+    end
+    File.open(test_results, 'w') { |f| f.print output }
+  end
+  
+  # Build the unit tests as amalgamated runners with compiler:posix_defines added and run
+  # them. The runner includes the framework and the test file ahead of its own headers, so
+  # this is the build where a feature-test macro placed too late shows up.
+  def run_amalgamated_tests(test_files)
+    if $cfg['compiler']['posix_defines'].nil?
+      report "No POSIX defines given for #{$cfg_file}, skipping the amalgamated tests"
+      return
+    end
+    report 'Running Unity system tests amalgamated...'
+    
+    test_defines = prepare_test_build
+    $cfg['compiler']['defines']['items'] |= $cfg['compiler']['posix_defines']
+    exe_names = build_tests(test_files, test_defines, true)
+    
+    exe_names.each do |exe_name|
+      save_test_results(exe_name, execute(test_command(exe_name)))
+    end
+  end
+  
+  # Build each C++ test once for every standard in compiler:cpp_standards and run it.  The
+  # test and its runner are compiled as C++, the framework as C with the usual options.
+  def run_cpp_tests(test_files)
+    if $cfg['compiler']['cpp_path'].nil?
+      report "No C++ compiler given for #{$cfg_file}, skipping the C++ tests"
+      return
+    end
+    report 'Running Unity C++ tests...'
+    
+    test_defines = prepare_test_build
+    framework = $cfg['compiler']['source_path'] + ($cfg[:unity][:framework] || :unity).to_s + C_EXTENSION
+    framework_obj = compile(framework, test_defines)
+    
+    test_files.each do |test|
+      test_base = File.basename(test, CPP_EXTENSION)
+      runner_path = ($cfg['compiler']['runner_path'] || $cfg['compiler']['build_path']) + test_base + '_Runner' + CPP_EXTENSION
+      UnityTestRunnerGenerator.new($cfg[:unity]).run(test, runner_path)
       
-      # Execute unit test and generate results file
-      simulator = build_simulator_fields
-      executable = $cfg['linker']['bin_files']['destination'] + test_base + $cfg['linker']['bin_files']['extension']
-      if simulator.nil?
-        cmd_str = executable
-      else
-        cmd_str = "#{simulator[:command]} #{simulator[:pre_support]} #{executable} #{simulator[:post_support]}"
+      $cfg['compiler']['cpp_standards'].each do |standard|
+        exe_name = test_base + '_' + standard.tr('+', 'x')
+        objects = run_jobs([test, runner_path]) { |src_file| compile(src_file, test_defines, standard) }
+        link_it(exe_name, objects + [framework_obj], true)
+        save_test_results(exe_name, execute(test_command(exe_name)))
       end
-      output = execute(cmd_str)
-      test_results = $cfg['compiler']['build_path'] + test_base
-      if output.match(/OK$/m).nil?
-        test_results += '.testfail'
-      else
-        test_results += '.testpass'
+    end
+  end
+  
+  # Build the unit tests from scratch as separate and as amalgamated translation units, then
+  # report how long each build took and the run time per assertion (best of `repeats` runs).
+  # The runners print the processor clock just before UnityBegin and just after UnityEnd, so
+  # the run time covers the tests only and not the start-up of the executable.
+  def measure_build_modes(test_files, repeats=5)
+    report 'Measuring separate and amalgamated builds...'
+    
+    test_defines = prepare_test_build
+    objects = $cfg['compiler']['object_files']['destination'] + '*' + $cfg['compiler']['object_files']['extension']
+    runner_options = {
+      :includes       => ($cfg[:unity][:includes] || []) + ['<time.h>'],
+      :suite_setup    => "  printf(\"Run Clock Start %ld\\n\", (long)clock());\n  return 0;",
+      :suite_teardown => "  printf(\"Run Clock End %ld Per Second %ld\\n\", (long)clock(), (long)CLOCKS_PER_SEC);\n  return num_failures;"
+    }
+    lines = []
+    
+    [false, true].each do |amalgamate|
+      FileUtils.rm_f(Dir[objects])
+      started = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+      exe_names = build_tests(test_files, test_defines, amalgamate, runner_options)
+      build_time = Process.clock_gettime(Process::CLOCK_MONOTONIC) - started
+      
+      run_time = 0.0
+      assertions = 0
+      exe_names.each do |exe_name|
+        best = nil
+        output = ''
+        repeats.times do
+          output = `#{test_command(exe_name)}`
+          clocks = output.match(/Run Clock Start (\d+).*Run Clock End (\d+) Per Second (\d+)/m)
+          raise "#{exe_name} did not report its run time" if clocks.nil?
+          elapsed = (clocks[2].to_i - clocks[1].to_i).to_f / clocks[3].to_i
+          best = elapsed if (best.nil? || (elapsed < best))
+        end
+        run_time += best
+        assertions += $2.to_i if (output =~ /(\d+) Tests (\d+) Assertions/)
       end
-      File.open(test_results, 'w') { |f| f.print output }
       
+      per_assertion = (assertions > 0) ? (run_time * 1e9 / assertions) : 0
+      lines << format("%-12s build %8.3f s   run %8.3f ms   %8d assertions   %10.1f ns/assertion",
+                      amalgamate ? 'amalgamated' : 'separate', build_time, run_time * 1e3, assertions, per_assertion)
     end
+    
+    report lines.join("\n")
   end
 end
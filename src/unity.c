@@ -4,18 +4,207 @@
     [Released under MIT License. Please refer to license.txt for details]
 ========================================== */
 
+#if (defined(UNITY_INCLUDE_CONCURRENT) || defined(UNITY_INCLUDE_EXEC_TIME)) && defined(__linux__) && !defined(_GNU_SOURCE)
+// clock_gettime under a strict -std, and pinning threads to cores
+#define _GNU_SOURCE
+#endif
 #include "unity.h"
 #include <stdio.h>
 #include <string.h>
+#if defined(UNITY_INCLUDE_CONCURRENT) || defined(UNITY_INCLUDE_INTERLEAVE)
+#include <pthread.h>
+#endif
+#ifdef UNITY_INCLUDE_CONCURRENT
+#include <sched.h>
+#include <time.h>
+#ifdef __linux__
+#include <unistd.h>
+#endif
+#endif
+#ifdef UNITY_INCLUDE_FILE
+#include <stdlib.h>
+#ifdef UNITY_FILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#endif
 
+#ifdef UNITY_THREAD_SAFE
+/// remember which test this thread failed in, so it can tell its own failures from those of other threads
+#define UNITY_FAIL_AND_BAIL   { UNITY_ATOMIC_STORE(Unity.CurrentTestFailed, 1); UnityThreadFailedTest = Unity.NumberOfTests; UNITY_OUTPUT_CHAR('\n'); return 1; }
+#else
 #define UNITY_FAIL_AND_BAIL   { Unity.CurrentTestFailed  = 1; UNITY_OUTPUT_CHAR('\n'); return 1; }
-#define UNITY_IGNORE_AND_BAIL { Unity.CurrentTestIgnored = 1; UNITY_OUTPUT_CHAR('\n'); return 1; }
+#endif
+#define UNITY_IGNORE_AND_BAIL { UNITY_ATOMIC_STORE(Unity.CurrentTestIgnored, 1); UNITY_OUTPUT_CHAR('\n'); return 1; }
 /// return prematurely if we are already in failure or ignore state
-#define UNITY_SKIP_EXECUTION  { if ((Unity.CurrentTestFailed != 0) || (Unity.CurrentTestIgnored != 0)) {return 1;} else { Unity.NumberOfAssertions++; } }
+#define UNITY_SKIP_EXECUTION  { if (UNITY_CURRENT_TEST_ENDED()) {return 1;} else { UNITY_COUNT_ASSERTION(); } }
 #define UNITY_PRINT_EOL       { UNITY_OUTPUT_CHAR('\n'); }
 
 struct _Unity Unity;
 
+#ifdef UNITY_OUTPUT_JUNIT
+static char  UnityJUnitMessage[UNITY_JUNIT_MESSAGE_LENGTH];
+static _UU32 UnityJUnitMessageLength;
+
+/// keep a copy of everything printed during the current test, so its
+/// failure or ignore text can be repeated in the JUnit report
+static void UnityOutputCharJUnit(const char c)
+{
+    UNITY_OUTPUT_CHAR(c);
+    if (UnityJUnitMessageLength < (_UU32)(UNITY_JUNIT_MESSAGE_LENGTH - 1))
+    {
+        UnityJUnitMessage[UnityJUnitMessageLength++] = c;
+    }
+}
+#undef  UNITY_OUTPUT_CHAR
+#define UNITY_OUTPUT_CHAR(a) UnityOutputCharJUnit((char)(a))
+#endif
+
+#ifdef UNITY_INCLUDE_PROPERTY
+static UNITY_BOOL UnityOutputMuted;
+
+/// a property runs many cases and replays the failing one while shrinking it;
+/// all of that is kept quiet and only the final, smallest case is printed
+static void UnityOutputCharProperty(const char c)
+{
+    if (!UnityOutputMuted)
+    {
+        UNITY_OUTPUT_CHAR(c);
+    }
+}
+#undef  UNITY_OUTPUT_CHAR
+#define UNITY_OUTPUT_CHAR(a) UnityOutputCharProperty((char)(a))
+#endif
+
+#ifdef UNITY_THREAD_SAFE
+/// one line printed by a thread other than the one that called UnityBegin; Sequence
+/// says whether the slot is free for a producer or ready for the main thread
+typedef struct
+{
+    _UU32 Sequence;
+    _UU32 Length;
+    char  Text[UNITY_OUTPUT_RECORD_LENGTH];
+} UNITY_OUTPUT_RECORD_T;
+
+static UNITY_OUTPUT_RECORD_T UnityOutputQueue[UNITY_OUTPUT_QUEUE_SIZE];
+static _UU32 UnityOutputQueueHead;
+static _UU32 UnityOutputQueueTail;
+static _UU32 UnityOutputDropped;
+
+static UNITY_THREAD_LOCAL UNITY_BOOL         UnityThreadIsMain;
+static UNITY_THREAD_LOCAL const char*        UnityThreadName;
+static UNITY_THREAD_LOCAL _UU32              UnityThreadNumber;
+static UNITY_THREAD_LOCAL char               UnityThreadNumberName[12];
+static UNITY_THREAD_LOCAL UNITY_COUNTER_TYPE UnityThreadFailedTest;
+static UNITY_THREAD_LOCAL char               UnityThreadLine[UNITY_OUTPUT_RECORD_LENGTH];
+static UNITY_THREAD_LOCAL _UU32              UnityThreadLineLength;
+
+/// hand the line this thread has built up to the main thread; producers claim a slot by
+/// moving the tail, and a full queue drops the line rather than wait for the main thread
+static void UnityOutputQueuePush(void)
+{
+    _UU32 tail = UNITY_ATOMIC_LOAD(UnityOutputQueueTail);
+    UNITY_OUTPUT_RECORD_T* record;
+    _US32 lag;
+
+    for (;;)
+    {
+        record = &UnityOutputQueue[tail % UNITY_OUTPUT_QUEUE_SIZE];
+        lag = (_US32)(UNITY_ATOMIC_LOAD(record->Sequence) - tail);
+        if (lag == 0)
+        {
+            if (UNITY_ATOMIC_CAS(UnityOutputQueueTail, tail, tail + 1))
+            {
+                break;
+            }
+        }
+        else if (lag < 0)
+        {
+            UNITY_ATOMIC_ADD(UnityOutputDropped, 1);
+            UnityThreadLineLength = 0;
+            return;
+        }
+        else
+        {
+            tail = UNITY_ATOMIC_LOAD(UnityOutputQueueTail);
+        }
+    }
+    memcpy(record->Text, UnityThreadLine, UnityThreadLineLength);
+    record->Length = UnityThreadLineLength;
+    UNITY_ATOMIC_STORE(record->Sequence, tail + 1);
+    UnityThreadLineLength = 0;
+}
+
+/// the main thread prints straight through; every other thread collects whole lines,
+/// cutting long ones short, so lines from different threads never interleave
+static void UnityOutputCharThread(const char c)
+{
+    if (UnityThreadIsMain)
+    {
+        UNITY_OUTPUT_CHAR(c);
+        return;
+    }
+    if ((c == '\n') || (UnityThreadLineLength < (_UU32)(UNITY_OUTPUT_RECORD_LENGTH - 1)))
+    {
+        UnityThreadLine[UnityThreadLineLength++] = c;
+    }
+    if (c == '\n')
+    {
+        UnityOutputQueuePush();
+    }
+}
+#undef  UNITY_OUTPUT_CHAR
+#define UNITY_OUTPUT_CHAR(a) UnityOutputCharThread((char)(a))
+#endif
+
+#ifndef UNITY_PRINT_NUMBER_LOW_RAM
+/// send a run of characters that needs no escaping, through UNITY_OUTPUT_BLOCK when
+/// the output has a faster path for whole blocks
+static void UnityOutputBlock(const char* buffer, const _UU32 length)
+{
+#ifdef UNITY_OUTPUT_BLOCK
+#ifdef UNITY_THREAD_SAFE
+    if (!UnityThreadIsMain)
+    {
+        _UU32 i;
+
+        for (i = 0; i < length; i++)
+        {
+            UNITY_OUTPUT_CHAR(buffer[i]);
+        }
+        return;
+    }
+#endif
+#ifdef UNITY_INCLUDE_PROPERTY
+    if (UnityOutputMuted)
+    {
+        return;
+    }
+#endif
+    UNITY_OUTPUT_BLOCK(buffer, length);
+#ifdef UNITY_OUTPUT_JUNIT
+    {
+        _UU32 i;
+
+        for (i = 0; (i < length) && (UnityJUnitMessageLength < (_UU32)(UNITY_JUNIT_MESSAGE_LENGTH - 1)); i++)
+        {
+            UnityJUnitMessage[UnityJUnitMessageLength++] = buffer[i];
+        }
+    }
+#endif
+#else
+    _UU32 i;
+
+    for (i = 0; i < length; i++)
+    {
+        UNITY_OUTPUT_CHAR(buffer[i]);
+    }
+#endif
+}
+#endif
+
 const char UnityStrOk[]                             = "OK";
 const char UnityStrPass[]                           = "PASS";
 const char UnityStrFail[]                           = "FAIL";
@@ -42,15 +231,104 @@ const char UnityStrNegInf[]                         = "Negative Infinity";
 const char UnityStrNaN[]                            = "NaN";
 const char UnityStrDet[]                            = "Determinate";
 
+#ifdef UNITY_MEMORY_DIFF
+const char UnityStrMemoryDiffHeader[]               = "    Offset      Expected                  Actual";
+#endif
+#ifdef UNITY_INCLUDE_FILE
+const char UnityStrFileRead[]                       = " Unable To Read File '";
+const char UnityStrFileWrite[]                      = " Unable To Write File '";
+const char UnityStrFileSize[]                       = " File Size Mismatch.";
+#endif
+#ifdef UNITY_INCLUDE_DIGEST
+const char UnityStrCrc32Mismatch[]                  = " CRC32 Mismatch.";
+const char UnityStrXxh64Mismatch[]                  = " XXH64 Mismatch.";
+const char UnityStrBlock[]                          = " Block ";
+const char UnityStrBytes[]                          = " Bytes ";
+#endif
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+const char UnityStrMismatchedAt[]                   = " Mismatched At ";
+#endif
+const char UnityStrListSeparator[]                  = ", ";
+const char UnityStrMore[]                           = ", ...";
+const char UnityStrTotal[]                          = " Total ";
+const char UnityStrUnordered[]                      = " Elements Differ In Any Order.";
+const char UnityStrMissing[]                        = " Missing ";
+const char UnityStrExtra[]                          = " Extra ";
+const char UnityStrMissingElement[]                 = " Missing Element ";
+const char UnityStrExtraElement[]                   = " Extra Element ";
+const char UnityStrWithin[]                         = " Expected Within ";
+const char UnityStrNotSorted[]                      = " Elements Not Sorted.";
+const char UnityStrOf[]                             = " Of ";
+#if defined(UNITY_INCLUDE_FLOAT) || defined(UNITY_INCLUDE_DOUBLE)
+const char UnityStrWorstElement[]                   = " Worst Element ";
+const char UnityStrOffBy[]                          = " Off By ";
+const char UnityStrUlp[]                            = " ULP";
+const char UnityStrAllowed[]                        = " Allowed ";
+const char UnityStrFailed[]                         = " Failed ";
+const char UnityStrErrUlp[]                         = " ULP Comparison Needs IEEE 754 Single or Double Precision";
+#endif
+
 const char UnityStrErrFloat[]                       = "Unity Floating Point Disabled";
 const char UnityStrErrDouble[]                      = "Unity Double Precision Disabled";
 const char UnityStrErr64[]                          = "Unity 64-bit Support Disabled";
+const char UnityStrErrDigest[]                      = "Unity Digest Support Disabled";
+const char UnityStrErrFile[]                        = "Unity File Support Disabled";
+const char UnityStrErrGeneric[]                     = "Unity Generic Assertions Need C11 _Generic";
+#ifdef UNITY_INCLUDE_PROPERTY
+const char UnityStrFalsified[]                      = "Falsified After ";
+const char UnityStrCases[]                          = " Cases, ";
+const char UnityStrShrinks[]                        = " Shrink Steps. Replay With Seed ";
+const char UnityStrGiven[]                          = "Given ";
+const char UnityStrGivenBytes[]                     = " Bytes:";
+const char UnityStrNotReplayed[]                    = " Property Passed When Replayed. Is It Deterministic?";
+const char UnityStrAllCases[]                       = " All ";
+const char UnityStrDiscarded[]                      = " Cases Discarded By TEST_ASSUME";
+#endif
+#ifdef UNITY_INCLUDE_DATA_FILE
+const char UnityStrDataFile[]                       = " Not A Unity Data File '";
+const char UnityStrDataRowMax[]                     = " Row Larger Than UNITY_DATA_ROW_MAX In '";
+const char UnityStrDataRowSize[]                    = " Row Size Mismatch.";
+const char UnityStrDataStopped[]                    = " Stopped After ";
+const char UnityStrDataFailedRows[]                 = " Failed Rows Of ";
+#endif
+#if defined(UNITY_INCLUDE_CONCURRENT) || defined(UNITY_INCLUDE_INTERLEAVE)
+const char UnityStrThreadStart[]                    = " Could Not Start Thread ";
+#endif
+#ifdef UNITY_INCLUDE_CONCURRENT
+const char UnityStrConcurrentThreads[]              = " TEST_CONCURRENT Needs 1 To UNITY_CONCURRENT_MAX_THREADS Threads";
+const char UnityStrConcurrentFailed[]               = " Threads Failed";
+const char UnityStrThread[]                         = "Thread ";
+const char UnityStrOps[]                            = " Ops ";
+const char UnityStrMicroseconds[]                   = " us ";
+const char UnityStrOpsPerSecond[]                   = " Ops/s";
+#endif
+#ifdef UNITY_INCLUDE_INTERLEAVE
+const char UnityStrSchedule[]                       = " Schedule ";
+const char UnityStrScheduleFailed[]                 = " Failed";
+const char UnityStrScheduleSeed[]                   = ". Replay With Seed ";
+const char UnityStrThreadsRan[]                     = ". Threads Ran";
+const char UnityStrScheduleStuck[]                  = " Schedule Did Not Finish In UNITY_INTERLEAVE_MAX_STEPS Steps";
+const char UnityStrSpawnLimit[]                     = " UNITY_SPAWN Past UNITY_INTERLEAVE_MAX_THREADS Threads";
+#endif
 
 const char UnityStrBreaker[]                        = "-----------------------";
 const char UnityStrResultsTests[]                   = " Tests ";
 const char UnityStrResultsAssertions[]              = " Assertions ";
 const char UnityStrResultsFailures[]                = " Failures ";
 const char UnityStrResultsIgnored[]                 = " Ignored ";
+const char UnityStrSubtests[]                       = " Subtests";
+const char UnityStrSubtestsFailed[]                 = " Subtests Failed";
+const char UnityStrSubtestsIgnored[]                = " Ignored";
+const char UnityStrResultsSubtests[]                = " Subtests ";
+#ifdef UNITY_THREAD_SAFE
+const char UnityStrThreadDropped[]                  = " Lines Of Thread Output Dropped";
+#endif
+const char UnityStrResultsSubtestsFailed[]          = " Failed ";
+#ifdef UNITY_INCLUDE_ASSERTION_STATS
+const char UnityStrAssertions[]                     = " Assertions";
+const char UnityStrMilliseconds[]                   = " ms ";
+const char UnityStrPerSecond[]                      = " Assertions/s";
+#endif
 
 #if defined(UNITY_INCLUDE_FLOAT)
 // Dividing by these constants produces +/- infinity.
@@ -124,7 +402,6 @@ void UnityPrint(const char* string)
     }
 }
 
-void UnityPrintLen(const char* string, const _UU32 length);
 void UnityPrintLen(const char* string, const _UU32 length)
 {
     const char* pch = string;
@@ -178,6 +455,7 @@ void UnityPrintNumberByStyle(const _U_SINT number, const UNITY_DISPLAY_STYLE_T s
     }
 }
 
+#ifdef UNITY_PRINT_NUMBER_LOW_RAM
 //-----------------------------------------------
 /// basically do an itoa using as little ram as possible
 void UnityPrintNumber(const _U_SINT number_to_print)
@@ -249,13 +527,91 @@ void UnityPrintNumberUnsigned(const _U_UINT number)
     while (divisor > 0);
 }
 
+#else
 //-----------------------------------------------
-void UnityPrintNumberHex(const _U_UINT number, const char nibbles_to_print)
+/// "00" "01" ... "99", so two digits cost one divide by 100 instead of two by 10
+static const char UnityDigitPairs[201] =
+    "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+    "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+/// digits of number, written backwards so they end just before end and emitted in
+/// one block.  Values wider than 32 bits are split into 8-digit chunks first, so
+/// everything after that is 32-bit arithmetic with constant divisors, which
+/// compilers turn into multiplies by a reciprocal.
+static void UnityPrintDigits(_U_UINT number, const int negative)
+{
+    char buffer[21];
+    char* const end = &buffer[sizeof(buffer)];
+    char* pch = end;
+    _UU32 low;
+    _UU32 pair;
+#ifdef UNITY_SUPPORT_64
+    int i;
+
+    while (number > 0xFFFFFFFFu)
+    {
+        low = (_UU32)(number % 100000000u);
+        number /= 100000000u;
+        for (i = 0; i < 4; i++)
+        {
+            pair = (low % 100u) << 1;
+            low /= 100u;
+            *--pch = UnityDigitPairs[pair + 1];
+            *--pch = UnityDigitPairs[pair];
+        }
+    }
+#endif
+    low = (_UU32)number;
+    while (low >= 100u)
+    {
+        pair = (low % 100u) << 1;
+        low /= 100u;
+        *--pch = UnityDigitPairs[pair + 1];
+        *--pch = UnityDigitPairs[pair];
+    }
+    if (low >= 10u)
+    {
+        pair = low << 1;
+        *--pch = UnityDigitPairs[pair + 1];
+        *--pch = UnityDigitPairs[pair];
+    }
+    else
+    {
+        *--pch = (char)('0' + low);
+    }
+    if (negative)
+    {
+        *--pch = '-';
+    }
+    UnityOutputBlock(pch, (_UU32)(end - pch));
+}
+
+//-----------------------------------------------
+void UnityPrintNumber(const _U_SINT number_to_print)
+{
+    if (number_to_print < 0)
+    {
+        // negated as unsigned, so the largest negative number needs no special case
+        UnityPrintDigits((_U_UINT)0 - (_U_UINT)number_to_print, 1);
+    }
+    else
+    {
+        UnityPrintDigits((_U_UINT)number_to_print, 0);
+    }
+}
+
+//-----------------------------------------------
+void UnityPrintNumberUnsigned(const _U_UINT number)
+{
+    UnityPrintDigits(number, 0);
+}
+#endif
+
+//-----------------------------------------------
+static void UnityPrintHexDigits(const _U_UINT number, const char nibbles_to_print)
 {
     _U_UINT nibble;
     char nibbles = nibbles_to_print;
-    UNITY_OUTPUT_CHAR('0');
-    UNITY_OUTPUT_CHAR('x');
 
     while (nibbles > 0)
     {
@@ -271,6 +627,13 @@ void UnityPrintNumberHex(const _U_UINT number, const char nibbles_to_print)
     }
 }
 
+void UnityPrintNumberHex(const _U_UINT number, const char nibbles_to_print)
+{
+    UNITY_OUTPUT_CHAR('0');
+    UNITY_OUTPUT_CHAR('x');
+    UnityPrintHexDigits(number, nibbles_to_print);
+}
+
 //-----------------------------------------------
 void UnityPrintMask(const _U_UINT mask, const _U_UINT number)
 {
@@ -299,1079 +662,5191 @@ void UnityPrintMask(const _U_UINT mask, const _U_UINT number)
 }
 
 //-----------------------------------------------
-#ifdef UNITY_FLOAT_VERBOSE
-void UnityPrintFloat(const _UF number)
+#if defined(UNITY_FLOAT_VERBOSE) || defined(UNITY_DOUBLE_VERBOSE)
+/// Prints the significant digits "digits" (no leading or trailing zeros) of a value
+/// equal to 0.digits * 10^point, using plain notation for 1e-4 <= value < 1e16 and
+/// exponent notation outside that, e.g. 0.1, 100.0, 1.5e-07, 1e+16
+static void UnityPrintDecimal(const char* digits, const _US32 length, const _US32 point)
 {
-    char TempBuffer[32];
-    sprintf(TempBuffer, "%.6f", number);
-    UnityPrint(TempBuffer);
+    _US32 i;
+
+    if ((point > -4) && (point <= 16))
+    {
+        if (point <= 0)
+        {
+            UNITY_OUTPUT_CHAR('0');
+            UNITY_OUTPUT_CHAR('.');
+            for (i = point; i < 0; i++)
+            {
+                UNITY_OUTPUT_CHAR('0');
+            }
+            for (i = 0; i < length; i++)
+            {
+                UNITY_OUTPUT_CHAR(digits[i]);
+            }
+        }
+        else
+        {
+            for (i = 0; i < point; i++)
+            {
+                UNITY_OUTPUT_CHAR((i < length) ? digits[i] : '0');
+            }
+            UNITY_OUTPUT_CHAR('.');
+            if (length <= point)
+            {
+                UNITY_OUTPUT_CHAR('0');
+            }
+            for (; i < length; i++)
+            {
+                UNITY_OUTPUT_CHAR(digits[i]);
+            }
+        }
+    }
+    else
+    {
+        UNITY_OUTPUT_CHAR(digits[0]);
+        if (length > 1)
+        {
+            UNITY_OUTPUT_CHAR('.');
+            for (i = 1; i < length; i++)
+            {
+                UNITY_OUTPUT_CHAR(digits[i]);
+            }
+        }
+        UNITY_OUTPUT_CHAR('e');
+        i = point - 1;
+        if (i < 0)
+        {
+            UNITY_OUTPUT_CHAR('-');
+            i = -i;
+        }
+        else
+        {
+            UNITY_OUTPUT_CHAR('+');
+        }
+        if (i >= 100)
+        {
+            UNITY_OUTPUT_CHAR((char)('0' + (i / 100)));
+        }
+        UNITY_OUTPUT_CHAR((char)('0' + ((i / 10) % 10)));
+        UNITY_OUTPUT_CHAR((char)('0' + (i % 10)));
+    }
 }
-#endif
 
-#ifdef UNITY_DOUBLE_VERBOSE
-void UnityPrintDouble(const _UD number)
+#ifdef UNITY_SUPPORT_64
+// Shortest digits that read back as the same value, found with Grisu2 (Loitsch, "Printing
+// Floating-Point Numbers Quickly and Accurately with Integers"): the value and the
+// halfway points to its neighbours are scaled by a cached power of ten into 64-bit fixed
+// point, then digits are generated until the result lies strictly between the halfway
+// points.  Only integer arithmetic is used, so no printf and no float library.
+typedef struct _UNITY_DIYFP_T
 {
-    char TempBuffer[32];
-    sprintf(TempBuffer, "%.6f", number);
-    UnityPrint(TempBuffer);
-}
-#endif
+    _UU64 f;
+    _US32 e;
+} UNITY_DIYFP_T;
 
-//-----------------------------------------------
+// 10^k for k = -348, -340, ..., 340, normalized to 64 bits (upper, lower word) and
+// rounded, with their binary exponents below
+static const _UU32 UnityCachedPowers[87][2] =
+{
+    { 0xFA8FD5A0UL, 0x081C0288UL }, { 0xBAAEE17FUL, 0xA23EBF76UL }, { 0x8B16FB20UL, 0x3055AC76UL },
+    { 0xCF42894AUL, 0x5DCE35EAUL }, { 0x9A6BB0AAUL, 0x55653B2DUL }, { 0xE61ACF03UL, 0x3D1A45DFUL },
+    { 0xAB70FE17UL, 0xC79AC6CAUL }, { 0xFF77B1FCUL, 0xBEBCDC4FUL }, { 0xBE5691EFUL, 0x416BD60CUL },
+    { 0x8DD01FADUL, 0x907FFC3CUL }, { 0xD3515C28UL, 0x31559A83UL }, { 0x9D71AC8FUL, 0xADA6C9B5UL },
+    { 0xEA9C2277UL, 0x23EE8BCBUL }, { 0xAECC4991UL, 0x4078536DUL }, { 0x823C1279UL, 0x5DB6CE57UL },
+    { 0xC2109436UL, 0x4DFB5637UL }, { 0x9096EA6FUL, 0x3848984FUL }, { 0xD77485CBUL, 0x25823AC7UL },
+    { 0xA086CFCDUL, 0x97BF97F4UL }, { 0xEF340A98UL, 0x172AACE5UL }, { 0xB23867FBUL, 0x2A35B28EUL },
+    { 0x84C8D4DFUL, 0xD2C63F3BUL }, { 0xC5DD4427UL, 0x1AD3CDBAUL }, { 0x936B9FCEUL, 0xBB25C996UL },
+    { 0xDBAC6C24UL, 0x7D62A584UL }, { 0xA3AB6658UL, 0x0D5FDAF6UL }, { 0xF3E2F893UL, 0xDEC3F126UL },
+    { 0xB5B5ADA8UL, 0xAAFF80B8UL }, { 0x87625F05UL, 0x6C7C4A8BUL }, { 0xC9BCFF60UL, 0x34C13053UL },
+    { 0x964E858CUL, 0x91BA2655UL }, { 0xDFF97724UL, 0x70297EBDUL }, { 0xA6DFBD9FUL, 0xB8E5B88FUL },
+    { 0xF8A95FCFUL, 0x88747D94UL }, { 0xB9447093UL, 0x8FA89BCFUL }, { 0x8A08F0F8UL, 0xBF0F156BUL },
+    { 0xCDB02555UL, 0x653131B6UL }, { 0x993FE2C6UL, 0xD07B7FACUL }, { 0xE45C10C4UL, 0x2A2B3B06UL },
+    { 0xAA242499UL, 0x697392D3UL }, { 0xFD87B5F2UL, 0x8300CA0EUL }, { 0xBCE50864UL, 0x92111AEBUL },
+    { 0x8CBCCC09UL, 0x6F5088CCUL }, { 0xD1B71758UL, 0xE219652CUL }, { 0x9C400000UL, 0x00000000UL },
+    { 0xE8D4A510UL, 0x00000000UL }, { 0xAD78EBC5UL, 0xAC620000UL }, { 0x813F3978UL, 0xF8940984UL },
+    { 0xC097CE7BUL, 0xC90715B3UL }, { 0x8F7E32CEUL, 0x7BEA5C70UL }, { 0xD5D238A4UL, 0xABE98068UL },
+    { 0x9F4F2726UL, 0x179A2245UL }, { 0xED63A231UL, 0xD4C4FB27UL }, { 0xB0DE6538UL, 0x8CC8ADA8UL },
+    { 0x83C7088EUL, 0x1AAB65DBUL }, { 0xC45D1DF9UL, 0x42711D9AUL }, { 0x924D692CUL, 0xA61BE758UL },
+    { 0xDA01EE64UL, 0x1A708DEAUL }, { 0xA26DA399UL, 0x9AEF774AUL }, { 0xF209787BUL, 0xB47D6B85UL },
+    { 0xB454E4A1UL, 0x79DD1877UL }, { 0x865B8692UL, 0x5B9BC5C2UL }, { 0xC83553C5UL, 0xC8965D3DUL },
+    { 0x952AB45CUL, 0xFA97A0B3UL }, { 0xDE469FBDUL, 0x99A05FE3UL }, { 0xA59BC234UL, 0xDB398C25UL },
+    { 0xF6C69A72UL, 0xA3989F5CUL }, { 0xB7DCBF53UL, 0x54E9BECEUL }, { 0x88FCF317UL, 0xF22241E2UL },
+    { 0xCC20CE9BUL, 0xD35C78A5UL }, { 0x98165AF3UL, 0x7B2153DFUL }, { 0xE2A0B5DCUL, 0x971F303AUL },
+    { 0xA8D9D153UL, 0x5CE3B396UL }, { 0xFB9B7CD9UL, 0xA4A7443CUL }, { 0xBB764C4CUL, 0xA7A44410UL },
+    { 0x8BAB8EEFUL, 0xB6409C1AUL }, { 0xD01FEF10UL, 0xA657842CUL }, { 0x9B10A4E5UL, 0xE9913129UL },
+    { 0xE7109BFBUL, 0xA19C0C9DUL }, { 0xAC2820D9UL, 0x623BF429UL }, { 0x80444B5EUL, 0x7AA7CF85UL },
+    { 0xBF21E440UL, 0x03ACDD2DUL }, { 0x8E679C2FUL, 0x5E44FF8FUL }, { 0xD433179DUL, 0x9C8CB841UL },
+    { 0x9E19DB92UL, 0xB4E31BA9UL }, { 0xEB96BF6EUL, 0xBADF77D9UL }, { 0xAF87023BUL, 0x9BF0EE6BUL }
+};
 
-void UnityPrintFail(void)
+static const _US16 UnityCachedPowerExponents[87] =
 {
-    UnityPrint(UnityStrFail);
-}
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927,
+    -901, -874, -847, -821, -794, -768, -741, -715, -688, -661, -635, -608,
+    -582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+    -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+    56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614, 641, 667,
+    694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986,
+    1013, 1039, 1066
+};
 
-void UnityPrintOk(void)
+static const _UU32 UnityPowersOf10[10] =
 {
-    UnityPrint(UnityStrOk);
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+static UNITY_DIYFP_T UnityDiyFp(const _UU64 f, const _US32 e)
+{
+    UNITY_DIYFP_T result;
+
+    result.f = f;
+    result.e = e;
+    return result;
 }
 
-//-----------------------------------------------
+static UNITY_DIYFP_T UnityDiyFpNormalize(UNITY_DIYFP_T x)
+{
+    while ((x.f & ((_UU64)1 << 63)) == 0)
+    {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
 
-void UnityTestResultsBegin(const char* file, const UNITY_LINE_TYPE line)
+/// upper 64 bits of the 128-bit product, rounded
+static UNITY_DIYFP_T UnityDiyFpMultiply(const UNITY_DIYFP_T x, const UNITY_DIYFP_T y)
 {
-    UnityPrint(file);
-    UNITY_OUTPUT_CHAR(':');
-    UnityPrintNumber((_U_SINT)line);
-    UNITY_OUTPUT_CHAR(':');
-    UnityPrint(Unity.CurrentTestName);
-    UNITY_OUTPUT_CHAR(':');
+    const _UU64 mask = 0xFFFFFFFFUL;
+    const _UU64 a = x.f >> 32;
+    const _UU64 b = x.f & mask;
+    const _UU64 c = y.f >> 32;
+    const _UU64 d = y.f & mask;
+    const _UU64 ac = a * c;
+    const _UU64 bc = b * c;
+    const _UU64 ad = a * d;
+    const _UU64 bd = b * d;
+    const _UU64 middle = (bd >> 32) + (ad & mask) + (bc & mask) + ((_UU64)1 << 31);
+
+    return UnityDiyFp(ac + (ad >> 32) + (bc >> 32) + (middle >> 32), x.e + y.e + 64);
 }
 
-//-----------------------------------------------
-static void UnityTestResultsFailBegin(const UNITY_LINE_TYPE line);
-static void UnityTestResultsFailBegin(const UNITY_LINE_TYPE line)
+/// cached power c = 10^-k such that the exponent of w * c lands in [-59, -32]
+static UNITY_DIYFP_T UnityCachedPower(const _US32 e, _US32* k)
 {
-    UnityTestResultsBegin(Unity.TestFile, line);
-    UnityPrint(UnityStrFail);
+    // ceil((-61 - e) * log10(2)) with log10(2) ~ 646456993 / 2^31
+    const _US64 scaled = (_US64)(-61 - e) * 646456993L;
+    _US32 exponent10 = (_US32)(scaled / 2147483648L);
+    _US32 index;
+
+    if ((scaled > 0) && ((_US64)exponent10 * 2147483648L < scaled))
+    {
+        exponent10++;
+    }
+    index = ((exponent10 + 347) >> 3) + 1;
+    *k = -(-348 + (index << 3));
+    return UnityDiyFp(((_UU64)UnityCachedPowers[index][0] << 32) | (_UU64)UnityCachedPowers[index][1],
+                      UnityCachedPowerExponents[index]);
 }
 
-//-----------------------------------------------
-void UnityConcludeTest(void)
+/// step the last digit down while that brings it closer to the exact value and
+/// stays inside the rounding interval
+static void UnityGrisuRound(char* digits, const _US32 length, const _UU64 delta, _UU64 rest, const _UU64 ten_kappa, const _UU64 distance)
 {
-    if (Unity.CurrentTestIgnored)
+    while ((rest < distance) && ((delta - rest) >= ten_kappa) &&
+           (((rest + ten_kappa) < distance) || ((distance - rest) > (rest + ten_kappa - distance))))
     {
-        Unity.TestIgnores++;
+        digits[length - 1]--;
+        rest += ten_kappa;
     }
-    else if (!Unity.CurrentTestFailed)
+}
+
+/// digits of the scaled upper boundary, as few as the interval delta allows; *k is
+/// adjusted so the value is digits * 10^k
+static _US32 UnityGrisuDigits(const UNITY_DIYFP_T w, const UNITY_DIYFP_T upper, _UU64 delta, char* digits, _US32* k)
+{
+    const _US32 shift = -upper.e;
+    const _UU64 one = (_UU64)1 << shift;
+    const _UU64 distance = upper.f - w.f;
+    _UU32 p1 = (_UU32)(upper.f >> shift);
+    _UU64 p2 = upper.f & (one - 1);
+    _US32 kappa = 10;
+    _US32 length = 0;
+    _UU32 d;
+
+    while ((kappa > 1) && (p1 < UnityPowersOf10[kappa - 1]))
     {
-        UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
-        UnityPrint(UnityStrPass);
-        UNITY_PRINT_EOL;
+        kappa--;
     }
-    else
+
+    while (kappa > 0)
     {
-        Unity.TestFailures++;
+        d = p1 / UnityPowersOf10[kappa - 1];
+        p1 %= UnityPowersOf10[kappa - 1];
+        if ((d != 0) || (length != 0))
+        {
+            digits[length++] = (char)('0' + d);
+        }
+        kappa--;
+        if ((((_UU64)p1 << shift) + p2) <= delta)
+        {
+            *k += kappa;
+            UnityGrisuRound(digits, length, delta, ((_UU64)p1 << shift) + p2, (_UU64)UnityPowersOf10[kappa] << shift, distance);
+            return length;
+        }
     }
 
-    Unity.CurrentTestFailed = 0;
-    Unity.CurrentTestIgnored = 0;
+    for (;;)
+    {
+        p2 *= 10;
+        delta *= 10;
+        d = (_UU32)(p2 >> shift);
+        if ((d != 0) || (length != 0))
+        {
+            digits[length++] = (char)('0' + d);
+        }
+        p2 &= one - 1;
+        kappa--;
+        if (p2 < delta)
+        {
+            *k += kappa;
+            UnityGrisuRound(digits, length, delta, p2, one, distance * ((-kappa < 10) ? UnityPowersOf10[-kappa] : 0));
+            return length;
+        }
+    }
 }
 
-//-----------------------------------------------
-static void UnityAddMsgIfSpecified(const char* msg);
-static void UnityAddMsgIfSpecified(const char* msg)
+/// prints the finite, positive value f * 2^e whose predecessor is only half as far
+/// away as its successor when lower_closer is set (f is a power of two)
+static void UnityPrintShortest(const _UU64 f, const _US32 e, const int lower_closer)
 {
-    if (msg)
-    {
-        UnityPrint(UnityStrSpacer);
-        UnityPrint(msg);
-    }
+    char digits[20];
+    UNITY_DIYFP_T upper = UnityDiyFpNormalize(UnityDiyFp((f << 1) + 1, e - 1));
+    UNITY_DIYFP_T lower = (lower_closer != 0) ? UnityDiyFp((f << 2) - 1, e - 2) : UnityDiyFp((f << 1) - 1, e - 1);
+    UNITY_DIYFP_T power;
+    UNITY_DIYFP_T w;
+    _US32 k;
+    _US32 length;
+
+    lower.f <<= lower.e - upper.e;
+    lower.e = upper.e;
+    power = UnityCachedPower(upper.e, &k);
+    w = UnityDiyFpMultiply(UnityDiyFpNormalize(UnityDiyFp(f, e)), power);
+    upper = UnityDiyFpMultiply(upper, power);
+    lower = UnityDiyFpMultiply(lower, power);
+    upper.f--;
+    lower.f++;
+    length = UnityGrisuDigits(w, upper, upper.f - lower.f, digits, &k);
+    UnityPrintDecimal(digits, length, length + k);
 }
 
-//-----------------------------------------------
-static void UnityPrintExpectedAndActualStrings(const char* expected, const char* actual);
-static void UnityPrintExpectedAndActualStrings(const char* expected, const char* actual)
+/// prints an IEEE 754 value of the given width, significand and exponent bits
+static void UnityPrintIeee(const _UU64 bits, const _US32 width, const _US32 significand_bits)
 {
-    UnityPrint(UnityStrExpected);
-    if (expected != NULL)
+    const _UU64 hidden = (_UU64)1 << significand_bits;
+    const _UU64 significand = bits & (hidden - 1);
+    const _US32 exponent_mask = (1 << (width - 1 - significand_bits)) - 1;
+    const _US32 exponent = (_US32)(bits >> significand_bits) & exponent_mask;
+    const _US32 bias = (exponent_mask >> 1) + significand_bits;
+
+    if ((exponent == exponent_mask) && (significand != 0))
     {
-        UNITY_OUTPUT_CHAR('\'');
-        UnityPrint(expected);
-        UNITY_OUTPUT_CHAR('\'');
+        UnityPrint(UnityStrNaN);
+        return;
     }
-    else
+    if (((bits >> (width - 1)) & 1) != 0)
     {
-      UnityPrint(UnityStrNull);
+        UNITY_OUTPUT_CHAR('-');
     }
-    UnityPrint(UnityStrWas);
-    if (actual != NULL)
+    if (exponent == exponent_mask)
     {
-        UNITY_OUTPUT_CHAR('\'');
-        UnityPrint(actual);
-        UNITY_OUTPUT_CHAR('\'');
+        UnityPrint(UnityStrInf);
+    }
+    else if ((exponent == 0) && (significand == 0))
+    {
+        UnityPrint("0.0");
+    }
+    else if (exponent == 0)
+    {
+        UnityPrintShortest(significand, 1 - bias, 0);
     }
     else
     {
-      UnityPrint(UnityStrNull);
+        UnityPrintShortest(significand | hidden, exponent - bias, (significand == 0) && (exponent > 1));
     }
 }
+#endif
 
-//-----------------------------------------------
-static void UnityPrintExpectedAndActualStringsLen(const char* expected, const char* actual, const _UU32 length)
+/// without 64-bit integers the value is scaled into [1, 10) in floating point and
+/// "significant" digits are printed; close, but not always the shortest round trip
+static void UnityPrintScaled(double number, const _US32 significant)
 {
-    UnityPrint(UnityStrExpected);
-    if (expected != NULL)
+    char digits[20];
+    double rounding = 5.0;
+    _US32 point = 1;
+    _US32 length;
+
+    if (number != number)
     {
-        UNITY_OUTPUT_CHAR('\'');
-        UnityPrintLen(expected, length);
-        UNITY_OUTPUT_CHAR('\'');
+        UnityPrint(UnityStrNaN);
+        return;
     }
-    else
+    if ((number < 0.0) || ((number == 0.0) && ((1.0 / number) < 0.0)))
     {
-      UnityPrint(UnityStrNull);
+        UNITY_OUTPUT_CHAR('-');
+        number = -number;
     }
-    UnityPrint(UnityStrWas);
-    if (actual != NULL)
+    if (number == 0.0)
     {
-        UNITY_OUTPUT_CHAR('\'');
-        UnityPrintLen(actual, length);
-        UNITY_OUTPUT_CHAR('\'');
+        UnityPrint("0.0");
+        return;
     }
-    else
+    if ((number - number) != 0.0)
     {
-      UnityPrint(UnityStrNull);
+        UnityPrint(UnityStrInf);
+        return;
+    }
+    while (number >= 10.0)
+    {
+        number /= 10.0;
+        point++;
+    }
+    while (number < 1.0)
+    {
+        number *= 10.0;
+        point--;
+    }
+    for (length = 0; length < significant; length++)
+    {
+        rounding /= 10.0;
     }
+    number += rounding;
+    if (number >= 10.0)
+    {
+        number /= 10.0;
+        point++;
+    }
+    for (length = 0; length < significant; length++)
+    {
+        digits[length] = (char)('0' + (int)number);
+        number = (number - (int)number) * 10.0;
+    }
+    while ((length > 1) && (digits[length - 1] == '0'))
+    {
+        length--;
+    }
+    UnityPrintDecimal(digits, length, point);
 }
+#endif
 
+#ifdef UNITY_FLOAT_VERBOSE
+void UnityPrintFloat(const _UF number)
+{
+#ifdef UNITY_SUPPORT_64
+    _UU32 bits32;
+    _UU64 bits64;
 
+    if (sizeof(_UF) == sizeof(bits32))
+    {
+        memcpy(&bits32, &number, sizeof(bits32));
+        UnityPrintIeee(bits32, 32, 23);
+        return;
+    }
+    if (sizeof(_UF) == sizeof(bits64))
+    {
+        memcpy(&bits64, &number, sizeof(bits64));
+        UnityPrintIeee(bits64, 64, 52);
+        return;
+    }
+#endif
+    UnityPrintScaled((double)number, (sizeof(_UF) > 4) ? 15 : 9);
+}
+#endif
 
-//-----------------------------------------------
-// Assertion & Control Helpers
-//-----------------------------------------------
-static int UnityCheckArraysForNull(UNITY_PTR_ATTRIBUTE const void* expected, UNITY_PTR_ATTRIBUTE const void* actual, const UNITY_LINE_TYPE lineNumber, const char* msg);
-static int UnityCheckArraysForNull(UNITY_PTR_ATTRIBUTE const void* expected, UNITY_PTR_ATTRIBUTE const void* actual, const UNITY_LINE_TYPE lineNumber, const char* msg)
+#ifdef UNITY_DOUBLE_VERBOSE
+void UnityPrintDouble(const _UD number)
 {
-    //return true if they are both NULL
-    if ((expected == NULL) && (actual == NULL))
-        return 1;
+#ifdef UNITY_SUPPORT_64
+    _UU32 bits32;
+    _UU64 bits64;
 
-    //throw error if just expected is NULL
-    if (expected == NULL)
+    if (sizeof(_UD) == sizeof(bits64))
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrNullPointerForExpected);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        memcpy(&bits64, &number, sizeof(bits64));
+        UnityPrintIeee(bits64, 64, 52);
+        return;
     }
-
-    //throw error if just actual is NULL
-    if (actual == NULL)
+    if (sizeof(_UD) == sizeof(bits32))
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrNullPointerForActual);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        memcpy(&bits32, &number, sizeof(bits32));
+        UnityPrintIeee(bits32, 32, 23);
+        return;
     }
-
-    //return false if neither is NULL
-    return 0;
+#endif
+    UnityPrintScaled((double)number, (sizeof(_UD) > 4) ? 15 : 9);
 }
+#endif
 
-//-----------------------------------------------
-// Assertion Functions
 //-----------------------------------------------
 
-UNITY_BOOL UnityAssertBits(const _U_SINT mask,
-                     const _U_SINT expected,
-                     const _U_SINT actual,
-                     const char* msg,
-                     const UNITY_LINE_TYPE lineNumber)
+void UnityPrintFail(void)
 {
-    UNITY_SKIP_EXECUTION;
+    UnityPrint(UnityStrFail);
+}
 
-    if ((mask & expected) != (mask & actual))
-    {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpected);
-        UnityPrintMask((_U_UINT)mask, (_U_UINT)expected);
-        UnityPrint(UnityStrWas);
-        UnityPrintMask((_U_UINT)mask, (_U_UINT)actual);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
-    }
-    return 0;
+void UnityPrintOk(void)
+{
+    UnityPrint(UnityStrOk);
 }
 
 //-----------------------------------------------
-UNITY_BOOL UnityAssertEqualNumber(const _U_SINT expected,
-                            const _U_SINT actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_DISPLAY_STYLE_T style)
-{
-    UNITY_SKIP_EXECUTION;
+#ifdef UNITY_INCLUDE_DATA_FILE
+static void UnityPrintDataRow(void);
+#endif
 
-    if (expected != actual)
+void UnityTestResultsBegin(const char* file, const UNITY_LINE_TYPE line)
+{
+#ifdef UNITY_THREAD_SAFE
+    // keep lines other threads have already finished ahead of this one
+    UnityFlushThreadOutput();
+#endif
+    UnityPrint(file);
+    UNITY_OUTPUT_CHAR(':');
+    UnityPrintNumber((_U_SINT)line);
+    UNITY_OUTPUT_CHAR(':');
+    UnityPrint(Unity.CurrentTestName);
+#ifdef UNITY_INCLUDE_DATA_FILE
+    UnityPrintDataRow();
+#endif
+    if (Unity.CurrentSubtestName != NULL)
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpected);
-        UnityPrintNumberByStyle(expected, style);
-        UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        // an unnamed subtest is labelled with its index in the test
+        UNITY_OUTPUT_CHAR('[');
+        if (Unity.CurrentSubtestName[0] != '\0')
+            UnityPrint(Unity.CurrentSubtestName);
+        else
+            UnityPrintNumberUnsigned((_U_UINT)(Unity.CurrentTestSubtests - 1));
+        UNITY_OUTPUT_CHAR(']');
     }
-    return 0;
+#ifdef UNITY_THREAD_SAFE
+    if (UnityThreadName != NULL)
+    {
+        UNITY_OUTPUT_CHAR('@');
+        UnityPrint(UnityThreadName);
+    }
+#endif
+    UNITY_OUTPUT_CHAR(':');
 }
 
 //-----------------------------------------------
-UNITY_BOOL UnityAssertGreaterNumber(const _U_SINT border,
-                            const _U_SINT actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_DISPLAY_STYLE_T style)
+void UnityTestResultsFailBegin(const UNITY_LINE_TYPE line)
 {
-    UNITY_SKIP_EXECUTION;
-
-    if (border >= actual) {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpectedGreaterThan);
-        UnityPrintNumberByStyle(border, style);
-        UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
-    }
-    return 0;
+    UnityTestResultsBegin(Unity.TestFile, line);
+    UnityPrint(UnityStrFail);
 }
 
 //-----------------------------------------------
-UNITY_BOOL UnityAssertGreaterOrEqualNumber(const _U_SINT border,
-                            const _U_SINT actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_DISPLAY_STYLE_T style)
+// JUnit XML Report
+//-----------------------------------------------
+#ifdef UNITY_OUTPUT_JUNIT
+
+#ifdef UNITY_JUNIT_OUTPUT_STDIO
+static FILE* UnityJUnitFile = NULL;
+
+static void UnityJUnitFileOpen(void)
 {
-    UNITY_SKIP_EXECUTION;
+    UnityJUnitFile = fopen(UNITY_JUNIT_FILE, "w");
+}
 
-    if (border > actual) {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpectedGreaterThanOrEqualTo);
-        UnityPrintNumberByStyle(border, style);
-        UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+static void UnityJUnitFilePutChar(const char c)
+{
+    if (UnityJUnitFile != NULL)
+    {
+        fputc(c, UnityJUnitFile);
     }
-    return 0;
 }
 
-//-----------------------------------------------
-UNITY_BOOL UnityAssertLessOrEqualNumber(const _U_SINT border,
-                            const _U_SINT actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_DISPLAY_STYLE_T style)
+static void UnityJUnitFileClose(void)
 {
-    UNITY_SKIP_EXECUTION;
-
-    if (border < actual) {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpectedLessThanOrEqualTo);
-        UnityPrintNumberByStyle(border, style);
-        UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+    if (UnityJUnitFile != NULL)
+    {
+        fclose(UnityJUnitFile);
+        UnityJUnitFile = NULL;
     }
-    return 0;
 }
+#endif
 
-//-----------------------------------------------
-UNITY_BOOL UnityAssertLessNumber(const _U_SINT border,
-                            const _U_SINT actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_DISPLAY_STYLE_T style)
+static void UnityJUnitPrint(const char* string)
 {
-    UNITY_SKIP_EXECUTION;
-
-    if (border <= actual) {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpectedLessThan);
-        UnityPrintNumberByStyle(border, style);
-        UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+    while (*string != '\0')
+    {
+        UNITY_JUNIT_OUTPUT_CHAR(*string++);
     }
-    return 0;
 }
 
-//-----------------------------------------------
-UNITY_BOOL UnityAssertGreaterUnsignedNumber(const _U_UINT border,
-                            const _U_UINT actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_DISPLAY_STYLE_T style)
+/// print at most length characters of string, escaped for use inside an XML attribute
+static void UnityJUnitPrintEscaped(const char* string, _UU32 length)
 {
-    UNITY_SKIP_EXECUTION;
+    unsigned char c;
 
-    if (border >= actual) {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpectedGreaterThan);
-        UnityPrintNumberByStyle(border, style);
-        UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+    if (string == NULL)
+        return;
+
+    while ((length-- > 0) && (*string != '\0'))
+    {
+        c = (unsigned char)*string++;
+        switch (c)
+        {
+            case '&':  UnityJUnitPrint("&amp;");  break;
+            case '<':  UnityJUnitPrint("&lt;");   break;
+            case '>':  UnityJUnitPrint("&gt;");   break;
+            case '"':  UnityJUnitPrint("&quot;"); break;
+            case '\n': UnityJUnitPrint("&#10;");  break;
+            default:
+                // other control characters are not allowed in XML 1.0 at all
+                UNITY_JUNIT_OUTPUT_CHAR((c < 32) ? ' ' : (char)c);
+                break;
+        }
     }
-    return 0;
 }
 
-//-----------------------------------------------
-UNITY_BOOL UnityAssertGreaterOrEqualUnsignedNumber(const _U_UINT border,
-                            const _U_UINT actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_DISPLAY_STYLE_T style)
+#if defined(UNITY_INCLUDE_EXEC_TIME) || defined(UNITY_INCLUDE_ASSERTION_STATS)
+static void UnityJUnitPrintNumber(_U_UINT number)
 {
-    UNITY_SKIP_EXECUTION;
+    char digits[20];
+    _UU8 count = 0;
 
-    if (border > actual) {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpectedGreaterThanOrEqualTo);
-        UnityPrintNumberByStyle(border, style);
-        UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+    do
+    {
+        digits[count++] = (char)('0' + (number % 10));
+        number /= 10;
+    }
+    while (number > 0);
+
+    while (count > 0)
+    {
+        UNITY_JUNIT_OUTPUT_CHAR(digits[--count]);
     }
-    return 0;
 }
+#endif
+
+static void UnityJUnitBegin(void)
+{
+    UNITY_JUNIT_OUTPUT_START();
+    UnityJUnitPrint("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuite name=\"");
+    UnityJUnitPrintEscaped(Unity.TestFile, (_UU32)(-1));
+    UnityJUnitPrint("\">\n");
+    UnityJUnitMessageLength = 0;
+}
+
+/// write one <testcase> element as soon as the test has concluded, so nothing is held back until UnityEnd
+static void UnityJUnitConcludeTest(void)
+{
+    _UU32 length = UnityJUnitMessageLength;
+#ifdef UNITY_INCLUDE_EXEC_TIME
+    _UU32 elapsed = UNITY_CLOCK_MS() - Unity.CurrentTestStartTime;
+#endif
+
+    // the captured text is the failure line itself; drop its line ending
+    while ((length > 0) && ((UnityJUnitMessage[length - 1] == '\n') || (UnityJUnitMessage[length - 1] == '\r')))
+    {
+        length--;
+    }
+
+    UnityJUnitPrint("  <testcase classname=\"");
+    UnityJUnitPrintEscaped(Unity.TestFile, (_UU32)(-1));
+    UnityJUnitPrint("\" name=\"");
+    UnityJUnitPrintEscaped(Unity.CurrentTestName, (_UU32)(-1));
+#ifdef UNITY_INCLUDE_EXEC_TIME
+    UnityJUnitPrint("\" time=\"");
+    UnityJUnitPrintNumber(elapsed / 1000);
+    UNITY_JUNIT_OUTPUT_CHAR('.');
+    UNITY_JUNIT_OUTPUT_CHAR((char)('0' + ((elapsed / 100) % 10)));
+    UNITY_JUNIT_OUTPUT_CHAR((char)('0' + ((elapsed / 10) % 10)));
+    UNITY_JUNIT_OUTPUT_CHAR((char)('0' + (elapsed % 10)));
+#endif
+#ifdef UNITY_INCLUDE_ASSERTION_STATS
+    UnityJUnitPrint("\" assertions=\"");
+    UnityJUnitPrintNumber((_U_UINT)(Unity.NumberOfAssertions - Unity.CurrentTestFirstAssertion));
+#endif
+    if (Unity.CurrentTestIgnored)
+    {
+        UnityJUnitPrint("\">\n    <skipped message=\"");
+        UnityJUnitPrintEscaped(UnityJUnitMessage, length);
+        UnityJUnitPrint("\"/>\n  </testcase>\n");
+    }
+    else if (Unity.CurrentTestFailed)
+    {
+        UnityJUnitPrint("\">\n    <failure type=\"ASSERT FAILED\" message=\"");
+        UnityJUnitPrintEscaped(UnityJUnitMessage, length);
+        UnityJUnitPrint("\"/>\n  </testcase>\n");
+    }
+    else
+    {
+        UnityJUnitPrint("\"/>\n");
+    }
+}
+
+static void UnityJUnitEnd(void)
+{
+    UnityJUnitPrint("</testsuite>\n");
+    UNITY_JUNIT_OUTPUT_COMPLETE();
+}
+#endif // UNITY_OUTPUT_JUNIT
+
+//-----------------------------------------------
+#ifdef UNITY_CLOCK_MS_DEFAULT
+/// milliseconds since an arbitrary start; only the difference between two readings means anything
+_UU32 UnityClockMs(void)
+{
+#ifdef CLOCK_MONOTONIC
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (_UU32)now.tv_sec * 1000u + (_UU32)(now.tv_nsec / 1000000);
+#else
+    // divide first so nothing overflows however long the process has run
+    const clock_t now = clock();
+
+    return (_UU32)(now / CLOCKS_PER_SEC) * 1000u + (_UU32)(((now % CLOCKS_PER_SEC) * 1000) / CLOCKS_PER_SEC);
+#endif
+}
+#endif
+
+//-----------------------------------------------
+#ifdef UNITY_INCLUDE_ASSERTION_STATS
+/// "<count> Assertions", then with a clock " <ms> ms <rate> Assertions/s" once any time has passed
+static void UnityPrintAssertionStats(const UNITY_COUNTER_TYPE count, const _UU32 elapsed)
+{
+    UnityPrintNumberUnsigned((_U_UINT)count);
+    UnityPrint(UnityStrAssertions);
+    if (elapsed > 0)
+    {
+        UNITY_OUTPUT_CHAR(' ');
+        UnityPrintNumberUnsigned((_U_UINT)elapsed);
+        UnityPrint(UnityStrMilliseconds);
+        // split so count * 1000 cannot overflow
+        UnityPrintNumberUnsigned(((_U_UINT)count / elapsed) * 1000u + (((_U_UINT)count % elapsed) * 1000u) / elapsed);
+        UnityPrint(UnityStrPerSecond);
+    }
+}
+#endif
+
+//-----------------------------------------------
+void UnityConcludeTest(void)
+{
+#ifdef UNITY_THREAD_SAFE
+    UnityFlushThreadOutput();
+#endif
+    // a failed assertion directly inside a UNITY_SUBTEST scope returns from the test with the subtest still open
+    if (Unity.CurrentSubtestName != NULL)
+    {
+        UnitySubtestEnd();
+    }
+    if (Unity.CurrentTestSubtestFailures > 0)
+    {
+        UnityTestResultsFailBegin(Unity.CurrentTestLineNumber);
+        UNITY_OUTPUT_CHAR(' ');
+        UnityPrintNumberUnsigned((_U_UINT)(Unity.CurrentTestSubtestFailures));
+        UnityPrint(UnityStrOf);
+        UnityPrintNumberUnsigned((_U_UINT)(Unity.CurrentTestSubtests));
+        UnityPrint(UnityStrSubtestsFailed);
+        UNITY_PRINT_EOL;
+        Unity.CurrentTestFailed = 1;
+    }
+
+#ifdef UNITY_OUTPUT_JUNIT
+    UnityJUnitConcludeTest();
+#endif
+
+    if (Unity.CurrentTestIgnored)
+    {
+        Unity.TestIgnores++;
+    }
+    else if (!Unity.CurrentTestFailed)
+    {
+        UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
+        UnityPrint(UnityStrPass);
+        if (Unity.CurrentTestSubtests > 0)
+        {
+            UNITY_OUTPUT_CHAR(' ');
+            UnityPrintNumberUnsigned((_U_UINT)(Unity.CurrentTestSubtests));
+            UnityPrint(UnityStrSubtests);
+        }
+        if (Unity.CurrentTestSubtestIgnores > 0)
+        {
+            UNITY_OUTPUT_CHAR(' ');
+            UnityPrintNumberUnsigned((_U_UINT)(Unity.CurrentTestSubtestIgnores));
+            UnityPrint(UnityStrSubtestsIgnored);
+        }
+#ifdef UNITY_INCLUDE_ASSERTION_STATS
+        UNITY_OUTPUT_CHAR(' ');
+#ifdef UNITY_INCLUDE_EXEC_TIME
+        UnityPrintAssertionStats(Unity.NumberOfAssertions - Unity.CurrentTestFirstAssertion, UNITY_CLOCK_MS() - Unity.CurrentTestStartTime);
+#else
+        UnityPrintAssertionStats(Unity.NumberOfAssertions - Unity.CurrentTestFirstAssertion, 0);
+#endif
+#endif
+        UNITY_PRINT_EOL;
+    }
+    else
+    {
+        Unity.TestFailures++;
+    }
+
+    Unity.CurrentTestFailed = 0;
+    Unity.CurrentTestIgnored = 0;
+    Unity.CurrentTestSubtests = 0;
+    Unity.CurrentTestSubtestFailures = 0;
+    Unity.CurrentTestSubtestIgnores = 0;
+    // memory lent with UnitySetScratch may have been on the test's stack, which is gone now
+    UnitySetScratch(NULL, 0);
+#ifdef UNITY_OUTPUT_JUNIT
+    UnityJUnitMessageLength = 0;
+#endif
+#ifdef UNITY_INCLUDE_ASSERTION_STATS
+    Unity.CurrentTestFirstAssertion = Unity.NumberOfAssertions;
+#endif
+#ifdef UNITY_INCLUDE_EXEC_TIME
+    Unity.CurrentTestStartTime = UNITY_CLOCK_MS();
+#endif
+}
+
+//-----------------------------------------------
+static void UnityAddMsgIfSpecified(const char* msg);
+static void UnityAddMsgIfSpecified(const char* msg)
+{
+    if (msg)
+    {
+        UnityPrint(UnityStrSpacer);
+        UnityPrint(msg);
+    }
+}
+
+//-----------------------------------------------
+static void UnityPrintExpectedAndActualStrings(const char* expected, const char* actual);
+static void UnityPrintExpectedAndActualStrings(const char* expected, const char* actual)
+{
+    UnityPrint(UnityStrExpected);
+    if (expected != NULL)
+    {
+        UNITY_OUTPUT_CHAR('\'');
+        UnityPrint(expected);
+        UNITY_OUTPUT_CHAR('\'');
+    }
+    else
+    {
+      UnityPrint(UnityStrNull);
+    }
+    UnityPrint(UnityStrWas);
+    if (actual != NULL)
+    {
+        UNITY_OUTPUT_CHAR('\'');
+        UnityPrint(actual);
+        UNITY_OUTPUT_CHAR('\'');
+    }
+    else
+    {
+      UnityPrint(UnityStrNull);
+    }
+}
+
+//-----------------------------------------------
+static void UnityPrintExpectedAndActualStringsLen(const char* expected, const char* actual, const _UU32 length)
+{
+    UnityPrint(UnityStrExpected);
+    if (expected != NULL)
+    {
+        UNITY_OUTPUT_CHAR('\'');
+        UnityPrintLen(expected, length);
+        UNITY_OUTPUT_CHAR('\'');
+    }
+    else
+    {
+      UnityPrint(UnityStrNull);
+    }
+    UnityPrint(UnityStrWas);
+    if (actual != NULL)
+    {
+        UNITY_OUTPUT_CHAR('\'');
+        UnityPrintLen(actual, length);
+        UNITY_OUTPUT_CHAR('\'');
+    }
+    else
+    {
+      UnityPrint(UnityStrNull);
+    }
+}
+
+
+
+//-----------------------------------------------
+// Assertion & Control Helpers
+//-----------------------------------------------
+static int UnityCheckArraysForNull(UNITY_PTR_ATTRIBUTE const void* expected, UNITY_PTR_ATTRIBUTE const void* actual, const UNITY_LINE_TYPE lineNumber, const char* msg);
+static int UnityCheckArraysForNull(UNITY_PTR_ATTRIBUTE const void* expected, UNITY_PTR_ATTRIBUTE const void* actual, const UNITY_LINE_TYPE lineNumber, const char* msg)
+{
+    //return true if they are both NULL
+    if ((expected == NULL) && (actual == NULL))
+        return 1;
+
+    //throw error if just expected is NULL
+    if (expected == NULL)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNullPointerForExpected);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    //throw error if just actual is NULL
+    if (actual == NULL)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNullPointerForActual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    //return false if neither is NULL
+    return 0;
+}
+
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+//-----------------------------------------------
+// Mismatch Reporting
+//-----------------------------------------------
+// The differing indices are printed as ranges while the rest of the buffer is scanned, so
+// nothing is stored. Only the first UNITY_MISMATCH_REPORT_LIMIT ranges are printed, but
+// the total counts every difference.
+typedef struct
+{
+    _UU32 Count;
+    _UU32 Ranges;
+    _UU32 RunStart;
+    _UU32 RunEnd;
+} UNITY_MISMATCHES_T;
+
+static void UnityMismatchPrintRun(UNITY_MISMATCHES_T* mismatches)
+{
+    if (mismatches->Ranges < UNITY_MISMATCH_REPORT_LIMIT)
+    {
+        if (mismatches->Ranges > 0)
+            UnityPrint(UnityStrListSeparator);
+        UnityPrintNumberUnsigned(mismatches->RunStart);
+        if (mismatches->RunEnd != mismatches->RunStart)
+        {
+            UNITY_OUTPUT_CHAR('-');
+            UnityPrintNumberUnsigned(mismatches->RunEnd);
+        }
+    }
+    mismatches->Ranges++;
+}
+
+static void UnityMismatchBegin(UNITY_MISMATCHES_T* mismatches, const _UU32 index)
+{
+    mismatches->Count = 1;
+    mismatches->Ranges = 0;
+    mismatches->RunStart = index;
+    mismatches->RunEnd = index;
+    UnityPrint(UnityStrMismatchedAt);
+}
+
+static void UnityMismatchAdd(UNITY_MISMATCHES_T* mismatches, const _UU32 index)
+{
+    mismatches->Count++;
+    if (index != (mismatches->RunEnd + 1))
+    {
+        UnityMismatchPrintRun(mismatches);
+        mismatches->RunStart = index;
+    }
+    mismatches->RunEnd = index;
+}
+
+static void UnityMismatchEnd(UNITY_MISMATCHES_T* mismatches)
+{
+    UnityMismatchPrintRun(mismatches);
+    if (mismatches->Ranges > UNITY_MISMATCH_REPORT_LIMIT)
+        UnityPrint(UnityStrMore);
+    UnityPrint(UnityStrTotal);
+    UnityPrintNumberUnsigned(mismatches->Count);
+}
+
+/// Report the mismatches from element 'first' (known to differ) to the end, for elements of
+/// 'size' bytes that are equal exactly when their bytes are. Whole blocks without any
+/// difference are skipped with a single memcmp.
+static void UnityPrintMismatchedElements(UNITY_PTR_ATTRIBUTE const void* expected,
+                                         UNITY_PTR_ATTRIBUTE const void* actual,
+                                         const _UU32 first,
+                                         const _UU32 num_elements,
+                                         const _UU32 size)
+{
+    const unsigned char* ptr_exp = (const unsigned char*)expected;
+    const unsigned char* ptr_act = (const unsigned char*)actual;
+    const _UU32 block = (size < UNITY_MISMATCH_BLOCK_SIZE) ? (UNITY_MISMATCH_BLOCK_SIZE / size) : 1;
+    _UU32 index = first + 1;
+    _UU32 end;
+    UNITY_MISMATCHES_T mismatches;
+
+    UnityMismatchBegin(&mismatches, first);
+    while (index < num_elements)
+    {
+        end = ((num_elements - index) > block) ? (index + block) : num_elements;
+        if (memcmp(&ptr_exp[index * size], &ptr_act[index * size], (size_t)((end - index) * size)) != 0)
+        {
+            for (; index < end; index++)
+            {
+                if (memcmp(&ptr_exp[index * size], &ptr_act[index * size], (size_t)size) != 0)
+                    UnityMismatchAdd(&mismatches, index);
+            }
+        }
+        index = end;
+    }
+    UnityMismatchEnd(&mismatches);
+}
+#endif
+
+#ifdef UNITY_MEMORY_DIFF
+//-----------------------------------------------
+// Memory Diff
+//-----------------------------------------------
+static void UnityPrintMemoryDiffHex(const unsigned char* bytes, const unsigned char* other, const _UU32 offset, const _UU32 end)
+{
+    _UU32 i;
+
+    for (i = offset; i < (offset + UNITY_MEMORY_DIFF_ROW); i++)
+    {
+        if (i < end)
+        {
+            UNITY_OUTPUT_CHAR((bytes[i] != other[i]) ? '*' : ' ');
+            UnityPrintHexDigits(bytes[i], 2);
+        }
+        else
+        {
+            UNITY_OUTPUT_CHAR(' ');
+            UNITY_OUTPUT_CHAR(' ');
+            UNITY_OUTPUT_CHAR(' ');
+        }
+    }
+}
+
+static void UnityPrintMemoryDiffAscii(const unsigned char* bytes, const _UU32 offset, const _UU32 end)
+{
+    _UU32 i;
+
+    for (i = offset; i < (offset + UNITY_MEMORY_DIFF_ROW); i++)
+    {
+        if (i >= end)
+            UNITY_OUTPUT_CHAR(' ');
+        else if ((bytes[i] >= 0x20) && (bytes[i] <= 0x7E))
+            UNITY_OUTPUT_CHAR((char)bytes[i]);
+        else
+            UNITY_OUTPUT_CHAR('.');
+    }
+    UNITY_OUTPUT_CHAR('|');
+}
+
+/// The first byte shown around a mismatch at 'index': the start of a row, about half of
+/// UNITY_MEMORY_DIFF_WINDOW before it
+static _UU32 UnityMemoryDiffStart(const _UU32 index)
+{
+    if (index > (UNITY_MEMORY_DIFF_WINDOW / 2))
+        return (index - (UNITY_MEMORY_DIFF_WINDOW / 2)) / UNITY_MEMORY_DIFF_ROW * UNITY_MEMORY_DIFF_ROW;
+    return 0;
+}
+
+/// Print 'length' bytes as rows of hex and ASCII, expected on the left and actual on the right,
+/// with a '*' in front of every byte that differs. The rows are labelled from 'position'.
+/// Everything goes straight to the output; nothing is buffered.
+static void UnityPrintMemoryDiffRows(const unsigned char* ptr_exp,
+                                     const unsigned char* ptr_act,
+                                     const _UU32 position,
+                                     const _UU32 length)
+{
+    _UU32 offset;
+
+    UNITY_PRINT_EOL;
+    UnityPrint(UnityStrMemoryDiffHeader);
+    for (offset = 0; offset < length; offset += UNITY_MEMORY_DIFF_ROW)
+    {
+        UNITY_PRINT_EOL;
+        UNITY_OUTPUT_CHAR(' ');
+        UNITY_OUTPUT_CHAR(' ');
+        UNITY_OUTPUT_CHAR(' ');
+        UNITY_OUTPUT_CHAR(' ');
+        UnityPrintNumberHex(position + offset, 8);
+        UNITY_OUTPUT_CHAR(' ');
+        UnityPrintMemoryDiffHex(ptr_exp, ptr_act, offset, length);
+        UNITY_OUTPUT_CHAR(' ');
+        UNITY_OUTPUT_CHAR(' ');
+        UnityPrintMemoryDiffHex(ptr_act, ptr_exp, offset, length);
+        UNITY_OUTPUT_CHAR(' ');
+        UNITY_OUTPUT_CHAR(' ');
+        UNITY_OUTPUT_CHAR('|');
+        UnityPrintMemoryDiffAscii(ptr_exp, offset, length);
+        UnityPrintMemoryDiffAscii(ptr_act, offset, length);
+    }
+}
+
+/// Print about UNITY_MEMORY_DIFF_WINDOW bytes around 'index'
+static void UnityPrintMemoryDiff(UNITY_PTR_ATTRIBUTE const void* expected,
+                                 UNITY_PTR_ATTRIBUTE const void* actual,
+                                 const _UU32 index,
+                                 const _UU32 length)
+{
+    const unsigned char* ptr_exp = (const unsigned char*)expected;
+    const unsigned char* ptr_act = (const unsigned char*)actual;
+    const _UU32 start = UnityMemoryDiffStart(index);
+    const _UU32 count = ((length - start) > UNITY_MEMORY_DIFF_WINDOW) ? UNITY_MEMORY_DIFF_WINDOW : (length - start);
+
+    UnityPrintMemoryDiffRows(&ptr_exp[start], &ptr_act[start], start, count);
+}
+#endif
+
+#ifdef UNITY_INCLUDE_DIGEST
+//-----------------------------------------------
+// Digests
+//-----------------------------------------------
+
+// CRC-32 (IEEE 802.3, reflected, as used by zlib and PNG), one table lookup per byte
+static const _UU32 UnityCrc32Table[256] =
+{
+    0x00000000UL, 0x77073096UL, 0xEE0E612CUL, 0x990951BAUL, 0x076DC419UL, 0x706AF48FUL, 0xE963A535UL, 0x9E6495A3UL,
+    0x0EDB8832UL, 0x79DCB8A4UL, 0xE0D5E91EUL, 0x97D2D988UL, 0x09B64C2BUL, 0x7EB17CBDUL, 0xE7B82D07UL, 0x90BF1D91UL,
+    0x1DB71064UL, 0x6AB020F2UL, 0xF3B97148UL, 0x84BE41DEUL, 0x1ADAD47DUL, 0x6DDDE4EBUL, 0xF4D4B551UL, 0x83D385C7UL,
+    0x136C9856UL, 0x646BA8C0UL, 0xFD62F97AUL, 0x8A65C9ECUL, 0x14015C4FUL, 0x63066CD9UL, 0xFA0F3D63UL, 0x8D080DF5UL,
+    0x3B6E20C8UL, 0x4C69105EUL, 0xD56041E4UL, 0xA2677172UL, 0x3C03E4D1UL, 0x4B04D447UL, 0xD20D85FDUL, 0xA50AB56BUL,
+    0x35B5A8FAUL, 0x42B2986CUL, 0xDBBBC9D6UL, 0xACBCF940UL, 0x32D86CE3UL, 0x45DF5C75UL, 0xDCD60DCFUL, 0xABD13D59UL,
+    0x26D930ACUL, 0x51DE003AUL, 0xC8D75180UL, 0xBFD06116UL, 0x21B4F4B5UL, 0x56B3C423UL, 0xCFBA9599UL, 0xB8BDA50FUL,
+    0x2802B89EUL, 0x5F058808UL, 0xC60CD9B2UL, 0xB10BE924UL, 0x2F6F7C87UL, 0x58684C11UL, 0xC1611DABUL, 0xB6662D3DUL,
+    0x76DC4190UL, 0x01DB7106UL, 0x98D220BCUL, 0xEFD5102AUL, 0x71B18589UL, 0x06B6B51FUL, 0x9FBFE4A5UL, 0xE8B8D433UL,
+    0x7807C9A2UL, 0x0F00F934UL, 0x9609A88EUL, 0xE10E9818UL, 0x7F6A0DBBUL, 0x086D3D2DUL, 0x91646C97UL, 0xE6635C01UL,
+    0x6B6B51F4UL, 0x1C6C6162UL, 0x856530D8UL, 0xF262004EUL, 0x6C0695EDUL, 0x1B01A57BUL, 0x8208F4C1UL, 0xF50FC457UL,
+    0x65B0D9C6UL, 0x12B7E950UL, 0x8BBEB8EAUL, 0xFCB9887CUL, 0x62DD1DDFUL, 0x15DA2D49UL, 0x8CD37CF3UL, 0xFBD44C65UL,
+    0x4DB26158UL, 0x3AB551CEUL, 0xA3BC0074UL, 0xD4BB30E2UL, 0x4ADFA541UL, 0x3DD895D7UL, 0xA4D1C46DUL, 0xD3D6F4FBUL,
+    0x4369E96AUL, 0x346ED9FCUL, 0xAD678846UL, 0xDA60B8D0UL, 0x44042D73UL, 0x33031DE5UL, 0xAA0A4C5FUL, 0xDD0D7CC9UL,
+    0x5005713CUL, 0x270241AAUL, 0xBE0B1010UL, 0xC90C2086UL, 0x5768B525UL, 0x206F85B3UL, 0xB966D409UL, 0xCE61E49FUL,
+    0x5EDEF90EUL, 0x29D9C998UL, 0xB0D09822UL, 0xC7D7A8B4UL, 0x59B33D17UL, 0x2EB40D81UL, 0xB7BD5C3BUL, 0xC0BA6CADUL,
+    0xEDB88320UL, 0x9ABFB3B6UL, 0x03B6E20CUL, 0x74B1D29AUL, 0xEAD54739UL, 0x9DD277AFUL, 0x04DB2615UL, 0x73DC1683UL,
+    0xE3630B12UL, 0x94643B84UL, 0x0D6D6A3EUL, 0x7A6A5AA8UL, 0xE40ECF0BUL, 0x9309FF9DUL, 0x0A00AE27UL, 0x7D079EB1UL,
+    0xF00F9344UL, 0x8708A3D2UL, 0x1E01F268UL, 0x6906C2FEUL, 0xF762575DUL, 0x806567CBUL, 0x196C3671UL, 0x6E6B06E7UL,
+    0xFED41B76UL, 0x89D32BE0UL, 0x10DA7A5AUL, 0x67DD4ACCUL, 0xF9B9DF6FUL, 0x8EBEEFF9UL, 0x17B7BE43UL, 0x60B08ED5UL,
+    0xD6D6A3E8UL, 0xA1D1937EUL, 0x38D8C2C4UL, 0x4FDFF252UL, 0xD1BB67F1UL, 0xA6BC5767UL, 0x3FB506DDUL, 0x48B2364BUL,
+    0xD80D2BDAUL, 0xAF0A1B4CUL, 0x36034AF6UL, 0x41047A60UL, 0xDF60EFC3UL, 0xA867DF55UL, 0x316E8EEFUL, 0x4669BE79UL,
+    0xCB61B38CUL, 0xBC66831AUL, 0x256FD2A0UL, 0x5268E236UL, 0xCC0C7795UL, 0xBB0B4703UL, 0x220216B9UL, 0x5505262FUL,
+    0xC5BA3BBEUL, 0xB2BD0B28UL, 0x2BB45A92UL, 0x5CB36A04UL, 0xC2D7FFA7UL, 0xB5D0CF31UL, 0x2CD99E8BUL, 0x5BDEAE1DUL,
+    0x9B64C2B0UL, 0xEC63F226UL, 0x756AA39CUL, 0x026D930AUL, 0x9C0906A9UL, 0xEB0E363FUL, 0x72076785UL, 0x05005713UL,
+    0x95BF4A82UL, 0xE2B87A14UL, 0x7BB12BAEUL, 0x0CB61B38UL, 0x92D28E9BUL, 0xE5D5BE0DUL, 0x7CDCEFB7UL, 0x0BDBDF21UL,
+    0x86D3D2D4UL, 0xF1D4E242UL, 0x68DDB3F8UL, 0x1FDA836EUL, 0x81BE16CDUL, 0xF6B9265BUL, 0x6FB077E1UL, 0x18B74777UL,
+    0x88085AE6UL, 0xFF0F6A70UL, 0x66063BCAUL, 0x11010B5CUL, 0x8F659EFFUL, 0xF862AE69UL, 0x616BFFD3UL, 0x166CCF45UL,
+    0xA00AE278UL, 0xD70DD2EEUL, 0x4E048354UL, 0x3903B3C2UL, 0xA7672661UL, 0xD06016F7UL, 0x4969474DUL, 0x3E6E77DBUL,
+    0xAED16A4AUL, 0xD9D65ADCUL, 0x40DF0B66UL, 0x37D83BF0UL, 0xA9BCAE53UL, 0xDEBB9EC5UL, 0x47B2CF7FUL, 0x30B5FFE9UL,
+    0xBDBDF21CUL, 0xCABAC28AUL, 0x53B39330UL, 0x24B4A3A6UL, 0xBAD03605UL, 0xCDD70693UL, 0x54DE5729UL, 0x23D967BFUL,
+    0xB3667A2EUL, 0xC4614AB8UL, 0x5D681B02UL, 0x2A6F2B94UL, 0xB40BBE37UL, 0xC30C8EA1UL, 0x5A05DF1BUL, 0x2D02EF8DUL
+};
+
+_UU32 UnityCrc32(UNITY_PTR_ATTRIBUTE const void* data, const _UU32 length)
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr = (UNITY_PTR_ATTRIBUTE const unsigned char*)data;
+    _UU32 crc = 0xFFFFFFFFUL;
+    _UU32 bytes = length;
+
+    while (bytes--)
+    {
+        crc = UnityCrc32Table[(crc ^ *ptr++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFUL;
+}
+
+#ifdef UNITY_SUPPORT_64
+// XXH64 with a seed of 0, reading the input byte by byte so it does not depend on
+// alignment or byte order
+#define UNITY_XXH64_PRIME(hi, lo) ((((_UU64)(hi)) << 32) | (_UU64)(lo))
+#define UNITY_XXH64_PRIME1 UNITY_XXH64_PRIME(0x9E3779B1UL, 0x85EBCA87UL)
+#define UNITY_XXH64_PRIME2 UNITY_XXH64_PRIME(0xC2B2AE3DUL, 0x27D4EB4FUL)
+#define UNITY_XXH64_PRIME3 UNITY_XXH64_PRIME(0x165667B1UL, 0x9E3779F9UL)
+#define UNITY_XXH64_PRIME4 UNITY_XXH64_PRIME(0x85EBCA77UL, 0xC2B2AE63UL)
+#define UNITY_XXH64_PRIME5 UNITY_XXH64_PRIME(0x27D4EB2FUL, 0x165667C5UL)
+#define UNITY_XXH64_ROTL(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+static _UU64 UnityXxh64Read(UNITY_PTR_ATTRIBUTE const unsigned char* ptr, const int bytes)
+{
+    _UU64 value = 0;
+    int i;
+
+    for (i = bytes - 1; i >= 0; i--)
+    {
+        value = (value << 8) | ptr[i];
+    }
+    return value;
+}
+
+static _UU64 UnityXxh64Round(_UU64 acc, const _UU64 input)
+{
+    acc += input * UNITY_XXH64_PRIME2;
+    acc = UNITY_XXH64_ROTL(acc, 31);
+    return acc * UNITY_XXH64_PRIME1;
+}
+
+static _UU64 UnityXxh64Merge(_UU64 acc, const _UU64 value)
+{
+    acc ^= UnityXxh64Round(0, value);
+    return (acc * UNITY_XXH64_PRIME1) + UNITY_XXH64_PRIME4;
+}
+
+_UU64 UnityXxh64(UNITY_PTR_ATTRIBUTE const void* data, const _UU32 length)
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr = (UNITY_PTR_ATTRIBUTE const unsigned char*)data;
+    _UU32 bytes = length;
+    _UU64 v1, v2, v3, v4, hash;
+
+    if (bytes >= 32)
+    {
+        v1 = UNITY_XXH64_PRIME1 + UNITY_XXH64_PRIME2;
+        v2 = UNITY_XXH64_PRIME2;
+        v3 = 0;
+        v4 = 0 - UNITY_XXH64_PRIME1;
+        do
+        {
+            v1 = UnityXxh64Round(v1, UnityXxh64Read(ptr, 8));
+            v2 = UnityXxh64Round(v2, UnityXxh64Read(ptr + 8, 8));
+            v3 = UnityXxh64Round(v3, UnityXxh64Read(ptr + 16, 8));
+            v4 = UnityXxh64Round(v4, UnityXxh64Read(ptr + 24, 8));
+            ptr += 32;
+            bytes -= 32;
+        }
+        while (bytes >= 32);
+        hash = UNITY_XXH64_ROTL(v1, 1) + UNITY_XXH64_ROTL(v2, 7) + UNITY_XXH64_ROTL(v3, 12) + UNITY_XXH64_ROTL(v4, 18);
+        hash = UnityXxh64Merge(hash, v1);
+        hash = UnityXxh64Merge(hash, v2);
+        hash = UnityXxh64Merge(hash, v3);
+        hash = UnityXxh64Merge(hash, v4);
+    }
+    else
+    {
+        hash = UNITY_XXH64_PRIME5;
+    }
+    hash += length;
+
+    while (bytes >= 8)
+    {
+        hash ^= UnityXxh64Round(0, UnityXxh64Read(ptr, 8));
+        hash = (UNITY_XXH64_ROTL(hash, 27) * UNITY_XXH64_PRIME1) + UNITY_XXH64_PRIME4;
+        ptr += 8;
+        bytes -= 8;
+    }
+    if (bytes >= 4)
+    {
+        hash ^= UnityXxh64Read(ptr, 4) * UNITY_XXH64_PRIME1;
+        hash = (UNITY_XXH64_ROTL(hash, 23) * UNITY_XXH64_PRIME2) + UNITY_XXH64_PRIME3;
+        ptr += 4;
+        bytes -= 4;
+    }
+    while (bytes--)
+    {
+        hash ^= (*ptr++) * UNITY_XXH64_PRIME5;
+        hash = UNITY_XXH64_ROTL(hash, 11) * UNITY_XXH64_PRIME1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= UNITY_XXH64_PRIME2;
+    hash ^= hash >> 29;
+    hash *= UNITY_XXH64_PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+#endif
+
+static _U_UINT UnityDigest(UNITY_PTR_ATTRIBUTE const void* data, const _UU32 length, const UNITY_DIGEST_T digest)
+{
+#ifdef UNITY_SUPPORT_64
+    if (digest == UNITY_DIGEST_XXH64)
+        return UnityXxh64(data, length);
+#endif
+    return UnityCrc32(data, length);
+}
+
+static void UnityPrintDigest(const _U_UINT value, const UNITY_DIGEST_T digest)
+{
+    UnityPrintNumberHex(value, (char)((digest == UNITY_DIGEST_XXH64) ? 16 : 8));
+}
+
+static void UnityPrintDigestMismatch(const UNITY_LINE_TYPE lineNumber, const UNITY_DIGEST_T digest)
+{
+    UnityTestResultsFailBegin(lineNumber);
+    UnityPrint((digest == UNITY_DIGEST_XXH64) ? UnityStrXxh64Mismatch : UnityStrCrc32Mismatch);
+}
+#endif
+
+//-----------------------------------------------
+// Assertion Functions
+//-----------------------------------------------
+
+UNITY_BOOL UnityAssertBits(const _U_SINT mask,
+                     const _U_SINT expected,
+                     const _U_SINT actual,
+                     const char* msg,
+                     const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if ((mask & expected) != (mask & actual))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpected);
+        UnityPrintMask((_U_UINT)mask, (_U_UINT)expected);
+        UnityPrint(UnityStrWas);
+        UnityPrintMask((_U_UINT)mask, (_U_UINT)actual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualNumber(const _U_SINT expected,
+                            const _U_SINT actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (expected != actual)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpected);
+        UnityPrintNumberByStyle(expected, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertGreaterNumber(const _U_SINT border,
+                            const _U_SINT actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (border >= actual) {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpectedGreaterThan);
+        UnityPrintNumberByStyle(border, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertGreaterOrEqualNumber(const _U_SINT border,
+                            const _U_SINT actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (border > actual) {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpectedGreaterThanOrEqualTo);
+        UnityPrintNumberByStyle(border, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertLessOrEqualNumber(const _U_SINT border,
+                            const _U_SINT actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (border < actual) {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpectedLessThanOrEqualTo);
+        UnityPrintNumberByStyle(border, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertLessNumber(const _U_SINT border,
+                            const _U_SINT actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (border <= actual) {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpectedLessThan);
+        UnityPrintNumberByStyle(border, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertGreaterUnsignedNumber(const _U_UINT border,
+                            const _U_UINT actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (border >= actual) {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpectedGreaterThan);
+        UnityPrintNumberByStyle(border, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertGreaterOrEqualUnsignedNumber(const _U_UINT border,
+                            const _U_UINT actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (border > actual) {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpectedGreaterThanOrEqualTo);
+        UnityPrintNumberByStyle(border, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertLessOrEqualUnsignedNumber(const _U_UINT border,
+                            const _U_UINT actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (border < actual) {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpectedLessThanOrEqualTo);
+        UnityPrintNumberByStyle(border, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertLessUnsignedNumber(const _U_UINT border,
+                            const _U_UINT actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (border <= actual) {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpectedLessThan);
+        UnityPrintNumberByStyle(border, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+/// The checks every integer array assertion makes before comparing elements.  Non-zero when
+/// the assertion is over: it failed, or both arrays are NULL
+static UNITY_BOOL UnityCheckIntArrays(UNITY_PTR_ATTRIBUTE const void* expected,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber)
+{
+    if (num_elements == 0)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE void*)expected, (UNITY_PTR_ATTRIBUTE void*)actual, lineNumber, msg) == 1)
+        return 1;
+    return 0;
+}
+
+/// Report element 'index' of two integer arrays of 'size' byte elements as the first that differs
+static UNITY_BOOL UnityIntArrayElementFail(UNITY_PTR_ATTRIBUTE const void* expected,
+                                           UNITY_PTR_ATTRIBUTE const void* actual,
+                                           const _UU32 index,
+                                           const _UU32 num_elements,
+                                           const _U_SINT expected_element,
+                                           const _U_SINT actual_element,
+                                           const char* msg,
+                                           const UNITY_LINE_TYPE lineNumber,
+                                           const UNITY_DISPLAY_STYLE_T style,
+                                           const _UU32 size)
+{
+    UnityTestResultsFailBegin(lineNumber);
+    UnityPrint(UnityStrElement);
+    UnityPrintNumberByStyle(index, UNITY_DISPLAY_STYLE_UINT);
+    UnityPrint(UnityStrExpected);
+    UnityPrintNumberByStyle(expected_element, style);
+    UnityPrint(UnityStrWas);
+    UnityPrintNumberByStyle(actual_element, style);
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+    UnityPrintMismatchedElements(expected, actual, index, num_elements, size);
+#else
+    (void)expected;
+    (void)actual;
+    (void)num_elements;
+    (void)size;
+#endif
+    UnityAddMsgIfSpecified(msg);
+    UNITY_FAIL_AND_BAIL;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualIntArray(UNITY_PTR_ATTRIBUTE const void* expected,
+                              UNITY_PTR_ATTRIBUTE const void* actual,
+                              const _UU32 num_elements,
+                              const char* msg,
+                              const UNITY_LINE_TYPE lineNumber,
+                              const UNITY_DISPLAY_STYLE_T style)
+{
+    // If style is UNITY_DISPLAY_STYLE_INT, we'll fall into the default case rather than the INT16 or INT32 (etc) case
+    // as UNITY_DISPLAY_STYLE_INT includes a flag for UNITY_DISPLAY_RANGE_AUTO, which the width-specific
+    // variants do not. Therefore remove this flag.
+    switch(style & (UNITY_DISPLAY_STYLE_T)(~UNITY_DISPLAY_RANGE_AUTO))
+    {
+        case UNITY_DISPLAY_STYLE_HEX8:
+        case UNITY_DISPLAY_STYLE_INT8:
+        case UNITY_DISPLAY_STYLE_UINT8:
+            return UnityAssertEqualIntArray8(expected, actual, num_elements, msg, lineNumber, style);
+        case UNITY_DISPLAY_STYLE_HEX16:
+        case UNITY_DISPLAY_STYLE_INT16:
+        case UNITY_DISPLAY_STYLE_UINT16:
+            return UnityAssertEqualIntArray16(expected, actual, num_elements, msg, lineNumber, style);
+#ifdef UNITY_SUPPORT_64
+        case UNITY_DISPLAY_STYLE_HEX64:
+        case UNITY_DISPLAY_STYLE_INT64:
+        case UNITY_DISPLAY_STYLE_UINT64:
+            return UnityAssertEqualIntArray64(expected, actual, num_elements, msg, lineNumber, style);
+#endif
+        default:
+            return UnityAssertEqualIntArray32(expected, actual, num_elements, msg, lineNumber, style);
+    }
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualIntArray8(UNITY_PTR_ATTRIBUTE const void* expected,
+                                     UNITY_PTR_ATTRIBUTE const void* actual,
+                                     const _UU32 num_elements,
+                                     const char* msg,
+                                     const UNITY_LINE_TYPE lineNumber,
+                                     const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_PTR_ATTRIBUTE const _US8* ptr_exp = (UNITY_PTR_ATTRIBUTE const _US8*)expected;
+    UNITY_PTR_ATTRIBUTE const _US8* ptr_act = (UNITY_PTR_ATTRIBUTE const _US8*)actual;
+    _UU32 i;
+
+    UNITY_SKIP_EXECUTION;
+
+    if (UnityCheckIntArrays(expected, actual, num_elements, msg, lineNumber) != 0)
+        return 1;
+
+    for (i = 0; i < num_elements; i++)
+    {
+        if (ptr_exp[i] != ptr_act[i])
+            return UnityIntArrayElementFail(expected, actual, i, num_elements, ptr_exp[i], ptr_act[i], msg, lineNumber, style, 1);
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualIntArray16(UNITY_PTR_ATTRIBUTE const void* expected,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber,
+                                      const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_PTR_ATTRIBUTE const _US16* ptr_exp = (UNITY_PTR_ATTRIBUTE const _US16*)expected;
+    UNITY_PTR_ATTRIBUTE const _US16* ptr_act = (UNITY_PTR_ATTRIBUTE const _US16*)actual;
+    _UU32 i;
+
+    UNITY_SKIP_EXECUTION;
+
+    if (UnityCheckIntArrays(expected, actual, num_elements, msg, lineNumber) != 0)
+        return 1;
+
+    for (i = 0; i < num_elements; i++)
+    {
+        if (ptr_exp[i] != ptr_act[i])
+            return UnityIntArrayElementFail(expected, actual, i, num_elements, ptr_exp[i], ptr_act[i], msg, lineNumber, style, 2);
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualIntArray32(UNITY_PTR_ATTRIBUTE const void* expected,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber,
+                                      const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_PTR_ATTRIBUTE const _US32* ptr_exp = (UNITY_PTR_ATTRIBUTE const _US32*)expected;
+    UNITY_PTR_ATTRIBUTE const _US32* ptr_act = (UNITY_PTR_ATTRIBUTE const _US32*)actual;
+    _UU32 i;
+
+    UNITY_SKIP_EXECUTION;
+
+    if (UnityCheckIntArrays(expected, actual, num_elements, msg, lineNumber) != 0)
+        return 1;
+
+    for (i = 0; i < num_elements; i++)
+    {
+        if (ptr_exp[i] != ptr_act[i])
+            return UnityIntArrayElementFail(expected, actual, i, num_elements, ptr_exp[i], ptr_act[i], msg, lineNumber, style, 4);
+    }
+    return 0;
+}
+
+#ifdef UNITY_SUPPORT_64
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualIntArray64(UNITY_PTR_ATTRIBUTE const void* expected,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber,
+                                      const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_PTR_ATTRIBUTE const _US64* ptr_exp = (UNITY_PTR_ATTRIBUTE const _US64*)expected;
+    UNITY_PTR_ATTRIBUTE const _US64* ptr_act = (UNITY_PTR_ATTRIBUTE const _US64*)actual;
+    _UU32 i;
+
+    UNITY_SKIP_EXECUTION;
+
+    if (UnityCheckIntArrays(expected, actual, num_elements, msg, lineNumber) != 0)
+        return 1;
+
+    for (i = 0; i < num_elements; i++)
+    {
+        if (ptr_exp[i] != ptr_act[i])
+            return UnityIntArrayElementFail(expected, actual, i, num_elements, ptr_exp[i], ptr_act[i], msg, lineNumber, style, 8);
+    }
+    return 0;
+}
+#endif
+
+#ifdef UNITY_SUPPORT_GENERIC
+//-----------------------------------------------
+// Generic Assertions
+//-----------------------------------------------
+// TEST_ASSERT_EQUAL and TEST_ASSERT_EQUAL_ARRAY pick one of these (or an integer array loop)
+// with _Generic, so they share a signature that ends with the display style of the type.
+
+/// Bring a number to the width and signedness of a style, as a cast to that type would
+static _U_SINT UnityNumberOfStyle(const _U_SINT number, const UNITY_DISPLAY_STYLE_T style)
+{
+    const _U_UINT mask = UnitySizeMask[((_U_UINT)style & (_U_UINT)0x0F) - 1];
+    const _U_UINT sign = (mask >> 1) + 1;
+
+    if (((style & UNITY_DISPLAY_RANGE_INT) == UNITY_DISPLAY_RANGE_INT) && (((_U_UINT)number & sign) != 0))
+        return (_U_SINT)((_U_UINT)number | ~mask);
+    return (_U_SINT)((_U_UINT)number & mask);
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualGenericNumber(const _U_SINT expected,
+                                         const _U_SINT actual,
+                                         const char* msg,
+                                         const UNITY_LINE_TYPE lineNumber,
+                                         const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    // compared by value, so -1 never equals an unsigned 0xFFFFFFFF
+    if (expected != actual)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpected);
+        // an expected value that does not fit the type of actual is printed whole, not cut down to it
+        if (UnityNumberOfStyle(expected, style) == expected)
+            UnityPrintNumberByStyle(expected, style);
+        else
+            UnityPrintNumber(expected);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualGenericPointer(UNITY_PTR_ATTRIBUTE const void* expected,
+                                          UNITY_PTR_ATTRIBUTE const void* actual,
+                                          const char* msg,
+                                          const UNITY_LINE_TYPE lineNumber,
+                                          const UNITY_DISPLAY_STYLE_T style)
+{
+    return UnityAssertEqualNumber((_U_SINT)(_UP)expected, (_U_SINT)(_UP)actual, msg, lineNumber, style);
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualGenericString(const char* expected,
+                                         const char* actual,
+                                         const char* msg,
+                                         const UNITY_LINE_TYPE lineNumber,
+                                         const UNITY_DISPLAY_STYLE_T style)
+{
+    (void)style;
+    return UnityAssertEqualString(expected, actual, msg, lineNumber);
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualGenericStringArray(UNITY_PTR_ATTRIBUTE const void* expected,
+                                              UNITY_PTR_ATTRIBUTE const void* actual,
+                                              const _UU32 num_elements,
+                                              const char* msg,
+                                              const UNITY_LINE_TYPE lineNumber,
+                                              const UNITY_DISPLAY_STYLE_T style)
+{
+    (void)style;
+    return UnityAssertEqualStringArray((const char**)expected, (const char**)actual, num_elements, msg, lineNumber);
+}
+
+#ifdef UNITY_INCLUDE_FLOAT
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualGenericFloat(const _UF expected,
+                                        const _UF actual,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber,
+                                        const UNITY_DISPLAY_STYLE_T style)
+{
+    (void)style;
+    return UnityAssertFloatsWithin(expected * (_UF)UNITY_FLOAT_PRECISION, expected, actual, msg, lineNumber);
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualGenericFloatArray(UNITY_PTR_ATTRIBUTE const void* expected,
+                                             UNITY_PTR_ATTRIBUTE const void* actual,
+                                             const _UU32 num_elements,
+                                             const char* msg,
+                                             const UNITY_LINE_TYPE lineNumber,
+                                             const UNITY_DISPLAY_STYLE_T style)
+{
+    (void)style;
+    return UnityAssertEqualFloatArray((UNITY_PTR_ATTRIBUTE const _UF*)expected, (UNITY_PTR_ATTRIBUTE const _UF*)actual, num_elements, msg, lineNumber);
+}
+#endif
+
+#ifdef UNITY_INCLUDE_DOUBLE
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualGenericDouble(const _UD expected,
+                                         const _UD actual,
+                                         const char* msg,
+                                         const UNITY_LINE_TYPE lineNumber,
+                                         const UNITY_DISPLAY_STYLE_T style)
+{
+    (void)style;
+    return UnityAssertDoublesWithin(expected * (_UD)UNITY_DOUBLE_PRECISION, expected, actual, msg, lineNumber);
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualGenericDoubleArray(UNITY_PTR_ATTRIBUTE const void* expected,
+                                              UNITY_PTR_ATTRIBUTE const void* actual,
+                                              const _UU32 num_elements,
+                                              const char* msg,
+                                              const UNITY_LINE_TYPE lineNumber,
+                                              const UNITY_DISPLAY_STYLE_T style)
+{
+    (void)style;
+    return UnityAssertEqualDoubleArray((UNITY_PTR_ATTRIBUTE const _UD*)expected, (UNITY_PTR_ATTRIBUTE const _UD*)actual, num_elements, msg, lineNumber);
+}
+#endif
+#endif // defined(UNITY_SUPPORT_GENERIC)
+
+//-----------------------------------------------
+// Unordered Arrays
+//-----------------------------------------------
+
+// Each thread sorts in its own arena and only uses a buffer it lent itself
+#ifdef UNITY_SCRATCH_SIZE
+static UNITY_THREAD_LOCAL _UU32 UnityScratchStatic[UNITY_SCRATCH_SIZE / sizeof(_UU32)];
+#endif
+static UNITY_THREAD_LOCAL _UU32* UnityScratchLent;
+static UNITY_THREAD_LOCAL _UU32 UnityScratchLentLength;
+
+/// Lend Unity some memory for the unordered comparisons (two _UU32 per element sorts
+/// them in O(n log n)). Pass NULL to go back to the UNITY_SCRATCH_SIZE arena, if any;
+/// UnityConcludeTest does that too, so a buffer only stays lent until its test ends.
+void UnitySetScratch(void* buffer, const _UU32 size)
+{
+    UnityScratchLent = (_UU32*)buffer;
+    UnityScratchLentLength = (buffer == NULL) ? 0 : size / (_UU32)sizeof(_UU32);
+}
+
+/// The memory to sort the indexes of num_elements elements in, or NULL when there is not enough
+static _UU32* UnityScratchFor(const _UU32 num_elements)
+{
+    if (UnityScratchLent != NULL)
+        return (num_elements <= (UnityScratchLentLength / 2)) ? UnityScratchLent : NULL;
+#ifdef UNITY_SCRATCH_SIZE
+    if (num_elements <= (_UU32)(UNITY_SCRATCH_SIZE / sizeof(_UU32) / 2))
+        return UnityScratchStatic;
+#endif
+    return NULL;
+}
+
+typedef struct _UNITY_UNMATCHED_T
+{
+    const char* Label;
+    UNITY_PTR_ATTRIBUTE const unsigned char* Base;
+    _UU32 Size;
+    UNITY_DISPLAY_STYLE_T Style;
+    _UU32 Count;
+} UNITY_UNMATCHED_T;
+
+static _U_SINT UnityReadSigned(UNITY_PTR_ATTRIBUTE const void* ptr, const _UU32 size)
+{
+    switch (size)
+    {
+        case 1:  return *(UNITY_PTR_ATTRIBUTE const _US8*)ptr;
+        case 2:  return *(UNITY_PTR_ATTRIBUTE const _US16*)ptr;
+#ifdef UNITY_SUPPORT_64
+        case 8:  return *(UNITY_PTR_ATTRIBUTE const _US64*)ptr;
+#endif
+        default: return *(UNITY_PTR_ATTRIBUTE const _US32*)ptr;
+    }
+}
+
+/// Lists an unmatched element (its value, or its index for memory records). Only counts
+/// when there is no Label, which is how we find out whether anything differs at all.
+static void UnityUnmatchedAdd(UNITY_UNMATCHED_T* unmatched, const _UU32 index)
+{
+    if ((unmatched->Label != NULL) && (unmatched->Count < UNITY_UNORDERED_REPORT_LIMIT))
+    {
+        UnityPrint((unmatched->Count == 0) ? unmatched->Label : UnityStrListSeparator);
+        if (unmatched->Style == UNITY_DISPLAY_STYLE_UNKNOWN)
+            UnityPrintNumberUnsigned(index);
+        else
+            UnityPrintNumberByStyle(UnityReadSigned(&unmatched->Base[index * unmatched->Size], unmatched->Size), unmatched->Style);
+    }
+    unmatched->Count++;
+}
+
+static void UnityHeapSiftDown(_UU32* index, _UU32 root, const _UU32 count, UNITY_PTR_ATTRIBUTE const unsigned char* base, const _UU32 size)
+{
+    _UU32 child;
+    _UU32 swap;
+
+    while ((child = (root * 2) + 1) < count)
+    {
+        if (((child + 1) < count) && (memcmp(&base[index[child] * size], &base[index[child + 1] * size], size) < 0))
+            child++;
+        if (memcmp(&base[index[root] * size], &base[index[child] * size], size) >= 0)
+            return;
+        swap = index[root];
+        index[root] = index[child];
+        index[child] = swap;
+        root = child;
+    }
+}
+
+/// Heapsort the element indices by their bytes. Any total order will do to line up
+/// equal elements, and heapsort needs neither recursion nor extra memory.
+static void UnitySortIndices(_UU32* index, const _UU32 count, UNITY_PTR_ATTRIBUTE const unsigned char* base, const _UU32 size)
+{
+    _UU32 i;
+    _UU32 swap;
+
+    for (i = 0; i < count; i++)
+        index[i] = i;
+    for (i = count / 2; i-- > 0; )
+        UnityHeapSiftDown(index, i, count, base, size);
+    for (i = count; i-- > 1; )
+    {
+        swap = index[0];
+        index[0] = index[i];
+        index[i] = swap;
+        UnityHeapSiftDown(index, 0, i, base, size);
+    }
+}
+
+/// Adds each element of 'from' that has no partner left in 'other', i.e. the multiset
+/// difference. With sorted indices this is one merge pass; without them an element is
+/// unmatched when 'other' has no more copies of it than 'from' has ahead of it.
+static _UU32 UnityFindUnmatched(UNITY_UNMATCHED_T* unmatched,
+                                UNITY_PTR_ATTRIBUTE const unsigned char* other,
+                                const _UU32 num_elements,
+                                const _UU32* sorted_from,
+                                const _UU32* sorted_other)
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* from = unmatched->Base;
+    const _UU32 size = unmatched->Size;
+    _UU32 i;
+    _UU32 j;
+    _UU32 before;
+    _UU32 copies;
+    int order;
+
+    if (sorted_from != NULL)
+    {
+        for (i = 0, j = 0; i < num_elements; )
+        {
+            order = (j < num_elements) ? memcmp(&from[sorted_from[i] * size], &other[sorted_other[j] * size], size) : -1;
+            if (order == 0)
+            {
+                i++;
+                j++;
+            }
+            else if (order < 0)
+            {
+                UnityUnmatchedAdd(unmatched, sorted_from[i++]);
+            }
+            else
+            {
+                j++;
+            }
+        }
+    }
+    else
+    {
+        for (i = 0; i < num_elements; i++)
+        {
+            before = 0;
+            for (j = 0; j < i; j++)
+            {
+                if (memcmp(&from[j * size], &from[i * size], size) == 0)
+                    before++;
+            }
+            copies = 0;
+            for (j = 0; (j < num_elements) && (copies <= before); j++)
+            {
+                if (memcmp(&other[j * size], &from[i * size], size) == 0)
+                    copies++;
+            }
+            if (copies <= before)
+                UnityUnmatchedAdd(unmatched, i);
+        }
+    }
+    return unmatched->Count;
+}
+
+static void UnityPrintUnmatched(const char* label,
+                                UNITY_PTR_ATTRIBUTE const void* from,
+                                UNITY_PTR_ATTRIBUTE const void* other,
+                                const _UU32 size,
+                                const _UU32 num_elements,
+                                const UNITY_DISPLAY_STYLE_T style,
+                                const _UU32* sorted_from,
+                                const _UU32* sorted_other)
+{
+    UNITY_UNMATCHED_T unmatched;
+
+    unmatched.Label = label;
+    unmatched.Base = (UNITY_PTR_ATTRIBUTE const unsigned char*)from;
+    unmatched.Size = size;
+    unmatched.Style = style;
+    unmatched.Count = 0;
+    if (UnityFindUnmatched(&unmatched, (UNITY_PTR_ATTRIBUTE const unsigned char*)other, num_elements, sorted_from, sorted_other) > UNITY_UNORDERED_REPORT_LIMIT)
+    {
+        UnityPrint(UnityStrMore);
+        UnityPrint(UnityStrTotal);
+        UnityPrintNumberUnsigned(unmatched.Count);
+    }
+}
+
+/// Elements are equal exactly when their bytes are, for integers as well as memory records
+static UNITY_BOOL UnityCompareUnordered(UNITY_PTR_ATTRIBUTE const void* expected,
+                                        UNITY_PTR_ATTRIBUTE const void* actual,
+                                        const _UU32 size,
+                                        const _UU32 num_elements,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber,
+                                        const UNITY_DISPLAY_STYLE_T style)
+{
+    _UU32* scratch;
+    _UU32* sorted_exp = NULL;
+    _UU32* sorted_act = NULL;
+    UNITY_UNMATCHED_T unmatched;
+
+    if ((num_elements == 0) || (size == 0))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE const void*)expected, (UNITY_PTR_ATTRIBUTE const void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    // Already in the same order
+    if (memcmp(expected, actual, num_elements * size) == 0)
+        return 0;
+
+    scratch = UnityScratchFor(num_elements);
+    if (scratch != NULL)
+    {
+        sorted_exp = scratch;
+        sorted_act = &scratch[num_elements];
+        UnitySortIndices(sorted_exp, num_elements, (UNITY_PTR_ATTRIBUTE const unsigned char*)expected, size);
+        UnitySortIndices(sorted_act, num_elements, (UNITY_PTR_ATTRIBUTE const unsigned char*)actual, size);
+    }
+
+    // Both have the same number of elements, so nothing is extra unless something is missing
+    unmatched.Label = NULL;
+    unmatched.Base = (UNITY_PTR_ATTRIBUTE const unsigned char*)expected;
+    unmatched.Size = size;
+    unmatched.Style = style;
+    unmatched.Count = 0;
+    if (UnityFindUnmatched(&unmatched, (UNITY_PTR_ATTRIBUTE const unsigned char*)actual, num_elements, sorted_exp, sorted_act) == 0)
+        return 0;
+
+    UnityTestResultsFailBegin(lineNumber);
+    UnityPrint(UnityStrUnordered);
+    UnityPrintUnmatched((style == UNITY_DISPLAY_STYLE_UNKNOWN) ? UnityStrMissingElement : UnityStrMissing,
+                        expected, actual, size, num_elements, style, sorted_exp, sorted_act);
+    UnityPrintUnmatched((style == UNITY_DISPLAY_STYLE_UNKNOWN) ? UnityStrExtraElement : UnityStrExtra,
+                        actual, expected, size, num_elements, style, sorted_act, sorted_exp);
+    UnityAddMsgIfSpecified(msg);
+    UNITY_FAIL_AND_BAIL;
+}
+
+UNITY_BOOL UnityAssertEqualIntArrayUnordered(UNITY_PTR_ATTRIBUTE const void* expected,
+                                             UNITY_PTR_ATTRIBUTE const void* actual,
+                                             const _UU32 num_elements,
+                                             const char* msg,
+                                             const UNITY_LINE_TYPE lineNumber,
+                                             const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareUnordered(expected, actual, (_UU32)style & 0x0F, num_elements, msg, lineNumber, style);
+}
+
+UNITY_BOOL UnityAssertEqualMemoryUnordered(UNITY_PTR_ATTRIBUTE const void* expected,
+                                           UNITY_PTR_ATTRIBUTE const void* actual,
+                                           const _UU32 length,
+                                           const _UU32 num_elements,
+                                           const char* msg,
+                                           const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareUnordered(expected, actual, length, num_elements, msg, lineNumber, UNITY_DISPLAY_STYLE_UNKNOWN);
+}
+
+//-----------------------------------------------
+// Array Predicates
+//-----------------------------------------------
+
+// The scans below check a whole block of elements without an early exit, so the compiler
+// can vectorize the inner loop, and only go back element by element in the block that fails.
+#define UNITY_DEFINE_ARRAY_SCANS(type, name)                                                    \
+static _UU32 UnityFirstOutside##name(UNITY_PTR_ATTRIBUTE const type* actual,                    \
+                                     const _UU32 num_elements, const type low, const type high) \
+{                                                                                               \
+    _UU32 start;                                                                                \
+    _UU32 end;                                                                                  \
+    _UU32 i;                                                                                    \
+    int outside;                                                                                \
+                                                                                                \
+    for (start = 0; start < num_elements; start = end)                                          \
+    {                                                                                           \
+        end = ((num_elements - start) > UNITY_SCAN_BLOCK) ? (start + UNITY_SCAN_BLOCK) : num_elements; \
+        outside = 0;                                                                            \
+        for (i = start; i < end; i++)                                                           \
+            outside |= (actual[i] < low) | (actual[i] > high);                                  \
+        if (outside)                                                                            \
+        {                                                                                       \
+            for (i = start; (actual[i] >= low) && (actual[i] <= high); i++)                     \
+                ;                                                                               \
+            return i;                                                                           \
+        }                                                                                       \
+    }                                                                                           \
+    return num_elements;                                                                        \
+}                                                                                               \
+                                                                                                \
+static _UU32 UnityFirstUnsorted##name(UNITY_PTR_ATTRIBUTE const type* actual,                   \
+                                      const _UU32 num_elements)                                 \
+{                                                                                               \
+    _UU32 start;                                                                                \
+    _UU32 end;                                                                                  \
+    _UU32 i;                                                                                    \
+    int unsorted;                                                                               \
+                                                                                                \
+    for (start = 1; start < num_elements; start = end)                                          \
+    {                                                                                           \
+        end = ((num_elements - start) > UNITY_SCAN_BLOCK) ? (start + UNITY_SCAN_BLOCK) : num_elements; \
+        unsorted = 0;                                                                           \
+        for (i = start; i < end; i++)                                                           \
+            unsorted |= (actual[i] < actual[i - 1]);                                            \
+        if (unsorted)                                                                           \
+        {                                                                                       \
+            for (i = start; actual[i] >= actual[i - 1]; i++)                                    \
+                ;                                                                               \
+            return i;                                                                           \
+        }                                                                                       \
+    }                                                                                           \
+    return num_elements;                                                                        \
+}
+
+UNITY_DEFINE_ARRAY_SCANS(_US8,  S8)
+UNITY_DEFINE_ARRAY_SCANS(_UU8,  U8)
+UNITY_DEFINE_ARRAY_SCANS(_US16, S16)
+UNITY_DEFINE_ARRAY_SCANS(_UU16, U16)
+UNITY_DEFINE_ARRAY_SCANS(_US32, S32)
+UNITY_DEFINE_ARRAY_SCANS(_UU32, U32)
+#ifdef UNITY_SUPPORT_64
+UNITY_DEFINE_ARRAY_SCANS(_US64, S64)
+UNITY_DEFINE_ARRAY_SCANS(_UU64, U64)
+#endif
+#undef UNITY_DEFINE_ARRAY_SCANS
+
+/// Index of the first element outside [low, high], or num_elements if there is none
+static _UU32 UnityFirstOutside(UNITY_PTR_ATTRIBUTE const void* actual,
+                               const _UU32 num_elements,
+                               const _U_SINT low,
+                               const _U_SINT high,
+                               const UNITY_DISPLAY_STYLE_T style)
+{
+    const int is_signed = ((style & UNITY_DISPLAY_RANGE_INT) == UNITY_DISPLAY_RANGE_INT);
+
+    switch (style & 0x0F)
+    {
+        case 1:
+            if (is_signed)
+                return UnityFirstOutsideS8((UNITY_PTR_ATTRIBUTE const _US8*)actual, num_elements, (_US8)low, (_US8)high);
+            return UnityFirstOutsideU8((UNITY_PTR_ATTRIBUTE const _UU8*)actual, num_elements, (_UU8)low, (_UU8)high);
+        case 2:
+            if (is_signed)
+                return UnityFirstOutsideS16((UNITY_PTR_ATTRIBUTE const _US16*)actual, num_elements, (_US16)low, (_US16)high);
+            return UnityFirstOutsideU16((UNITY_PTR_ATTRIBUTE const _UU16*)actual, num_elements, (_UU16)low, (_UU16)high);
+#ifdef UNITY_SUPPORT_64
+        case 8:
+            if (is_signed)
+                return UnityFirstOutsideS64((UNITY_PTR_ATTRIBUTE const _US64*)actual, num_elements, (_US64)low, (_US64)high);
+            return UnityFirstOutsideU64((UNITY_PTR_ATTRIBUTE const _UU64*)actual, num_elements, (_UU64)low, (_UU64)high);
+#endif
+        default:
+            if (is_signed)
+                return UnityFirstOutsideS32((UNITY_PTR_ATTRIBUTE const _US32*)actual, num_elements, (_US32)low, (_US32)high);
+            return UnityFirstOutsideU32((UNITY_PTR_ATTRIBUTE const _UU32*)actual, num_elements, (_UU32)low, (_UU32)high);
+    }
+}
+
+/// Index of the first element smaller than the one before it, or num_elements if there is none
+static _UU32 UnityFirstUnsorted(UNITY_PTR_ATTRIBUTE const void* actual,
+                                const _UU32 num_elements,
+                                const UNITY_DISPLAY_STYLE_T style)
+{
+    const int is_signed = ((style & UNITY_DISPLAY_RANGE_INT) == UNITY_DISPLAY_RANGE_INT);
+
+    switch (style & 0x0F)
+    {
+        case 1:
+            if (is_signed)
+                return UnityFirstUnsortedS8((UNITY_PTR_ATTRIBUTE const _US8*)actual, num_elements);
+            return UnityFirstUnsortedU8((UNITY_PTR_ATTRIBUTE const _UU8*)actual, num_elements);
+        case 2:
+            if (is_signed)
+                return UnityFirstUnsortedS16((UNITY_PTR_ATTRIBUTE const _US16*)actual, num_elements);
+            return UnityFirstUnsortedU16((UNITY_PTR_ATTRIBUTE const _UU16*)actual, num_elements);
+#ifdef UNITY_SUPPORT_64
+        case 8:
+            if (is_signed)
+                return UnityFirstUnsortedS64((UNITY_PTR_ATTRIBUTE const _US64*)actual, num_elements);
+            return UnityFirstUnsortedU64((UNITY_PTR_ATTRIBUTE const _UU64*)actual, num_elements);
+#endif
+        default:
+            if (is_signed)
+                return UnityFirstUnsortedS32((UNITY_PTR_ATTRIBUTE const _US32*)actual, num_elements);
+            return UnityFirstUnsortedU32((UNITY_PTR_ATTRIBUTE const _UU32*)actual, num_elements);
+    }
+}
+
+static UNITY_BOOL UnityCheckArrayToScan(UNITY_PTR_ATTRIBUTE const void* actual,
+                                        const _UU32 num_elements,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber)
+{
+    if (num_elements == 0)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (actual == NULL)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNullPointerForActual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+/// One assertion for the whole array, failing on the first element outside [low, high].
+/// TEST_ASSERT_EACH_EQUAL_* is the range [expected, expected].
+UNITY_BOOL UnityAssertEachWithinRange(const _U_SINT low,
+                                      const _U_SINT high,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber,
+                                      const UNITY_DISPLAY_STYLE_T style)
+{
+    const _UU32 size = (_UU32)style & 0x0F;
+    _UU32 index;
+
+    UNITY_SKIP_EXECUTION;
+
+    if (UnityCheckArrayToScan(actual, num_elements, msg, lineNumber) != 0)
+        return 1;
+
+    index = UnityFirstOutside(actual, num_elements, low, high, style);
+    if (index < num_elements)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrElement);
+        UnityPrintNumberUnsigned(index);
+        if (low == high)
+        {
+            UnityPrint(UnityStrExpected);
+            UnityPrintNumberByStyle(low, style);
+        }
+        else
+        {
+            UnityPrint(UnityStrWithin);
+            UnityPrintNumberByStyle(low, style);
+            UnityPrint(UnityStrTo);
+            UnityPrintNumberByStyle(high, style);
+        }
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(UnityReadSigned((UNITY_PTR_ATTRIBUTE const unsigned char*)actual + (index * size), size), style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+UNITY_BOOL UnityAssertArraySorted(UNITY_PTR_ATTRIBUTE const void* actual,
+                                  const _UU32 num_elements,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber,
+                                  const UNITY_DISPLAY_STYLE_T style)
+{
+    const _UU32 size = (_UU32)style & 0x0F;
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act = (UNITY_PTR_ATTRIBUTE const unsigned char*)actual;
+    _UU32 index;
+
+    UNITY_SKIP_EXECUTION;
+
+    if (UnityCheckArrayToScan(actual, num_elements, msg, lineNumber) != 0)
+        return 1;
+
+    index = UnityFirstUnsorted(actual, num_elements, style);
+    if (index < num_elements)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNotSorted);
+        UnityPrint(UnityStrElement);
+        UnityPrintNumberUnsigned(index - 1);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(UnityReadSigned(&ptr_act[(index - 1) * size], size), style);
+        UnityPrint(UnityStrElement);
+        UnityPrintNumberUnsigned(index);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(UnityReadSigned(&ptr_act[index * size], size), style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+#if defined(UNITY_INCLUDE_FLOAT) || defined(UNITY_INCLUDE_DOUBLE)
+static void UnityPrintWorstElement(const UNITY_LINE_TYPE lineNumber, const _UU32 index, const _UU32 num_elements)
+{
+    UnityTestResultsFailBegin(lineNumber);
+    if (num_elements > 1)
+    {
+        UnityPrint(UnityStrWorstElement);
+        UnityPrintNumberUnsigned(index);
+    }
+}
+
+static void UnityPrintFailedElements(const _UU32 failed, const _UU32 num_elements)
+{
+    if (num_elements > 1)
+    {
+        UnityPrint(UnityStrFailed);
+        UnityPrintNumberUnsigned(failed);
+        UnityPrint(UnityStrOf);
+        UnityPrintNumberUnsigned(num_elements);
+    }
+}
+#endif
+
+//-----------------------------------------------
+#if defined(UNITY_INCLUDE_FLOAT)
+static int UnityFloatArrayElementsDiffer(const _UF expected, const _UF actual)
+{
+    _UF diff, tol;
+
+    diff = expected - actual;
+    if (diff < 0.0f)
+      diff = 0.0f - diff;
+    tol = UNITY_FLOAT_PRECISION * expected;
+    if (tol < 0.0f)
+        tol = 0.0f - tol;
+
+    //This first part of this condition will catch any NaN or Infinite values
+    return ((diff * 0.0f != 0.0f) || (diff > tol));
+}
+
+UNITY_BOOL UnityAssertEqualFloatArray(UNITY_PTR_ATTRIBUTE const _UF* expected,
+                                UNITY_PTR_ATTRIBUTE const _UF* actual,
+                                const _UU32 num_elements,
+                                const char* msg,
+                                const UNITY_LINE_TYPE lineNumber)
+{
+    _UU32 elements = num_elements;
+    UNITY_PTR_ATTRIBUTE const _UF* ptr_expected = expected;
+    UNITY_PTR_ATTRIBUTE const _UF* ptr_actual = actual;
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+    UNITY_MISMATCHES_T mismatches;
+#endif
+
+    UNITY_SKIP_EXECUTION;
+
+    if (elements == 0)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE const void*)expected, (UNITY_PTR_ATTRIBUTE const void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    while (elements--)
+    {
+        if (UnityFloatArrayElementsDiffer(*ptr_expected, *ptr_actual))
+        {
+            UnityTestResultsFailBegin(lineNumber);
+            UnityPrint(UnityStrElement);
+            UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
+#ifdef UNITY_FLOAT_VERBOSE
+            UnityPrint(UnityStrExpected);
+            UnityPrintFloat(*ptr_expected);
+            UnityPrint(UnityStrWas);
+            UnityPrintFloat(*ptr_actual);
+#else
+            UnityPrint(UnityStrDelta);
+#endif
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+            UnityMismatchBegin(&mismatches, (num_elements - elements - 1));
+            while (elements--)
+            {
+                ptr_expected++;
+                ptr_actual++;
+                if (UnityFloatArrayElementsDiffer(*ptr_expected, *ptr_actual))
+                    UnityMismatchAdd(&mismatches, (num_elements - elements - 1));
+            }
+            UnityMismatchEnd(&mismatches);
+#endif
+            UnityAddMsgIfSpecified(msg);
+            UNITY_FAIL_AND_BAIL;
+        }
+        ptr_expected++;
+        ptr_actual++;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertFloatsWithin(const _UF delta,
+                             const _UF expected,
+                             const _UF actual,
+                             const char* msg,
+                             const UNITY_LINE_TYPE lineNumber)
+{
+    _UF diff = actual - expected;
+    _UF pos_delta = delta;
+
+    UNITY_SKIP_EXECUTION;
+
+    if (diff < 0.0f)
+    {
+        diff = 0.0f - diff;
+    }
+    if (pos_delta < 0.0f)
+    {
+        pos_delta = 0.0f - pos_delta;
+    }
+
+    //This first part of this condition will catch any NaN or Infinite values
+    if ((diff * 0.0f != 0.0f) || (pos_delta < diff))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+#ifdef UNITY_FLOAT_VERBOSE
+        UnityPrint(UnityStrExpected);
+        UnityPrintFloat(expected);
+        UnityPrint(UnityStrWas);
+        UnityPrintFloat(actual);
+#else
+        UnityPrint(UnityStrDelta);
+#endif
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertFloatSpecial(const _UF actual,
+                             const char* msg,
+                             const UNITY_LINE_TYPE lineNumber,
+                             const UNITY_FLOAT_TRAIT_T style)
+{
+    const char* trait_names[] = { UnityStrInf, UnityStrNegInf, UnityStrNaN, UnityStrDet };
+    _U_SINT should_be_trait   = ((_U_SINT)style & 1);
+    _U_SINT is_trait          = !should_be_trait;
+    _U_SINT trait_index       = (_U_SINT)(style >> 1);
+
+    UNITY_SKIP_EXECUTION;
+
+    switch(style)
+    {
+        //To determine Inf / Neg Inf, we compare to an Inf / Neg Inf value we create on the fly
+        //We are using a variable to hold the zero value because some compilers complain about dividing by zero otherwise
+        case UNITY_FLOAT_IS_INF:
+        case UNITY_FLOAT_IS_NOT_INF:
+            is_trait = ((1.0f / f_zero) == actual) ? 1 : 0;
+            break;
+        case UNITY_FLOAT_IS_NEG_INF:
+        case UNITY_FLOAT_IS_NOT_NEG_INF:
+            is_trait = ((-1.0f / f_zero) == actual) ? 1 : 0;
+            break;
+
+        //NaN is the only floating point value that does NOT equal itself. Therefore if Actual == Actual, then it is NOT NaN.
+        case UNITY_FLOAT_IS_NAN:
+        case UNITY_FLOAT_IS_NOT_NAN:
+            is_trait = (actual == actual) ? 0 : 1;
+            break;
+
+        //A determinate number is non infinite and not NaN. (therefore the opposite of the two above)
+        case UNITY_FLOAT_IS_DET:
+        case UNITY_FLOAT_IS_NOT_DET:
+            if ( (actual != actual) || ((1.0f / f_zero) == actual) || ((-1.0f / f_zero) == actual) )
+                is_trait = 0;
+            else
+                is_trait = 1;
+            break;
+    default:
+        ;
+    }
+
+    if (is_trait != should_be_trait)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpected);
+        if (!should_be_trait)
+            UnityPrint(UnityStrNot);
+        UnityPrint(trait_names[trait_index]);
+        UnityPrint(UnityStrWas);
+#ifdef UNITY_FLOAT_VERBOSE
+        UnityPrintFloat(actual);
+#else
+        if (should_be_trait)
+            UnityPrint(UnityStrNot);
+        UnityPrint(trait_names[trait_index]);
+#endif
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+//-----------------------------------------------
+/// Maps the bit pattern of an IEEE single precision float onto an unsigned integer that runs in the same
+/// order as the values, with -0 and +0 on the same integer, so the distance between two
+/// of them is the number of representable values (ULPs) between them
+static _UU32 UnityFloatToOrdered(const _UF value)
+{
+    _UU32 bits;
+    _UU32 negative;
+
+    memcpy(&bits, &value, sizeof(bits));
+    negative = (_UU32)0 - (bits >> 31);
+    return (_UU32)0x80000000UL + (((bits & (_UU32)0x7FFFFFFFUL) ^ negative) - negative);
+}
+
+/// ULP distance between two floats; NaN on either side counts as the largest distance of all
+static _UU32 UnityFloatUlpDistance(const _UF expected, const _UF actual)
+{
+    const _UU32 ordered_exp = UnityFloatToOrdered(expected);
+    const _UU32 ordered_act = UnityFloatToOrdered(actual);
+    const _UU32 distance = (ordered_exp > ordered_act) ? (ordered_exp - ordered_act) : (ordered_act - ordered_exp);
+
+    return distance | ((_UU32)0 - (_UU32)((expected != expected) | (actual != actual)));
+}
+
+/// Counts the elements more than max_ulps apart and finds the worst distance. The loop only
+/// accumulates, with no early exit or index capture, so GCC -O3 vectorizes it; the worst
+/// element is looked up afterwards, and only when there is a failure
+static _UU32 UnityFloatUlpScan(UNITY_PTR_ATTRIBUTE const _UF* expected,
+                               UNITY_PTR_ATTRIBUTE const _UF* actual,
+                               const _UU32 num_elements,
+                               const _UU32 max_ulps,
+                               _UU32* worst)
+{
+    _UU32 distance;
+    _UU32 worst_distance = 0;
+    _UU32 failed = 0;
+    _UU32 i;
+
+    for (i = 0; i < num_elements; i++)
+    {
+        distance = UnityFloatUlpDistance(expected[i], actual[i]);
+        failed += (distance > max_ulps);
+        worst_distance = (distance > worst_distance) ? distance : worst_distance;
+    }
+    *worst = worst_distance;
+    return failed;
+}
+
+static UNITY_BOOL UnityCompareFloatsUlp(const _UU32 max_ulps,
+                                      UNITY_PTR_ATTRIBUTE const _UF* expected,
+                                      UNITY_PTR_ATTRIBUTE const _UF* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber)
+{
+    _UU32 worst;
+    _UU32 index;
+    _UU32 failed;
+
+    if (sizeof(_UF) != sizeof(_UU32))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrErrUlp);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (num_elements == 0)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE const void*)expected, (UNITY_PTR_ATTRIBUTE const void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    failed = UnityFloatUlpScan(expected, actual, num_elements, max_ulps, &worst);
+    if (failed > 0)
+    {
+        for (index = 0; UnityFloatUlpDistance(expected[index], actual[index]) != worst; index++)
+            ;
+        UnityPrintWorstElement(lineNumber, index, num_elements);
+#ifdef UNITY_FLOAT_VERBOSE
+        UnityPrint(UnityStrExpected);
+        UnityPrintFloat(expected[index]);
+        UnityPrint(UnityStrWas);
+        UnityPrintFloat(actual[index]);
+#endif
+        UnityPrint(UnityStrOffBy);
+        if (worst == ~(_UU32)0)
+            UnityPrint(UnityStrNaN);
+        else
+            UnityPrintNumberUnsigned(worst);
+        UnityPrint(UnityStrUlp);
+        UnityPrint(UnityStrAllowed);
+        UnityPrintNumberUnsigned(max_ulps);
+        UnityPrintFailedElements(failed, num_elements);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+UNITY_BOOL UnityAssertFloatsWithinUlp(const _UU32 max_ulps,
+                                    const _UF expected,
+                                    const _UF actual,
+                                    const char* msg,
+                                    const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareFloatsUlp(max_ulps, &expected, &actual, 1, msg, lineNumber);
+}
+
+UNITY_BOOL UnityAssertFloatArrayWithinUlp(const _UU32 max_ulps,
+                                        UNITY_PTR_ATTRIBUTE const _UF* expected,
+                                        UNITY_PTR_ATTRIBUTE const _UF* actual,
+                                        const _UU32 num_elements,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareFloatsUlp(max_ulps, expected, actual, num_elements, msg, lineNumber);
+}
+
+/// The larger of abs_tol and rel_tol * |expected|
+static _UF UnityFloatTolerance(const _UF expected, const _UF abs_tol, const _UF rel_tol)
+{
+    const _UF tol = rel_tol * ((expected < 0.0f) ? -expected : expected);
+
+    return (tol > abs_tol) ? tol : abs_tol;
+}
+
+/// Non-zero when |actual - expected| is over the tolerance, NaN or infinite. Equal values always
+/// pass, so infinities of the same sign are within any tolerance
+static int UnityFloatOutsideTolerance(const _UF expected, const _UF actual, const _UF abs_tol, const _UF rel_tol)
+{
+    _UF diff = actual - expected;
+
+    diff = (diff < 0.0f) ? -diff : diff;
+    return (actual != expected) & ((diff > UnityFloatTolerance(expected, abs_tol, rel_tol)) | ((diff * 0.0f) != 0.0f));
+}
+
+/// Counts the elements outside the tolerance. The loop only accumulates, with no branches,
+/// early exit or index capture, so GCC -O3 vectorizes it
+static _UU32 UnityFloatToleranceScan(UNITY_PTR_ATTRIBUTE const _UF* expected,
+                                     UNITY_PTR_ATTRIBUTE const _UF* actual,
+                                     const _UU32 num_elements,
+                                     const _UF abs_tol,
+                                     const _UF rel_tol)
+{
+    _UU32 failed = 0;
+    _UU32 i;
+
+    for (i = 0; i < num_elements; i++)
+        failed += (_UU32)UnityFloatOutsideTolerance(expected[i], actual[i], abs_tol, rel_tol);
+    return failed;
+}
+
+/// The failing element furthest outside its tolerance, counting a NaN or infinite difference as
+/// the furthest of all. Only called once the scan has found a failure
+static _UU32 UnityFloatToleranceWorst(UNITY_PTR_ATTRIBUTE const _UF* expected,
+                                      UNITY_PTR_ATTRIBUTE const _UF* actual,
+                                      const _UU32 num_elements,
+                                      const _UF abs_tol,
+                                      const _UF rel_tol)
+{
+    const _UF infinity = 1.0f / f_zero;
+    _UF diff;
+    _UF excess;
+    _UF worst = 0.0f;
+    _UU32 index = 0;
+    _UU32 i;
+
+    for (i = 0; i < num_elements; i++)
+    {
+        if (!UnityFloatOutsideTolerance(expected[i], actual[i], abs_tol, rel_tol))
+            continue;
+        diff = actual[i] - expected[i];
+        diff = (diff < 0.0f) ? -diff : diff;
+        excess = ((diff * 0.0f) == 0.0f) ? (diff - UnityFloatTolerance(expected[i], abs_tol, rel_tol)) : infinity;
+        if (excess > worst)
+        {
+            worst = excess;
+            index = i;
+        }
+    }
+    return index;
+}
+
+static UNITY_BOOL UnityCompareFloatsTolerance(const _UF abs_tol,
+                                            const _UF rel_tol,
+                                            UNITY_PTR_ATTRIBUTE const _UF* expected,
+                                            UNITY_PTR_ATTRIBUTE const _UF* actual,
+                                            const _UU32 num_elements,
+                                            const char* msg,
+                                            const UNITY_LINE_TYPE lineNumber)
+{
+    const _UF pos_abs_tol = (abs_tol < 0.0f) ? -abs_tol : abs_tol;
+    const _UF pos_rel_tol = (rel_tol < 0.0f) ? -rel_tol : rel_tol;
+    _UU32 index;
+    _UU32 failed;
+
+    if (num_elements == 0)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE const void*)expected, (UNITY_PTR_ATTRIBUTE const void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    failed = UnityFloatToleranceScan(expected, actual, num_elements, pos_abs_tol, pos_rel_tol);
+    if (failed > 0)
+    {
+        index = UnityFloatToleranceWorst(expected, actual, num_elements, pos_abs_tol, pos_rel_tol);
+        UnityPrintWorstElement(lineNumber, index, num_elements);
+#ifdef UNITY_FLOAT_VERBOSE
+        UnityPrint(UnityStrExpected);
+        UnityPrintFloat(expected[index]);
+        UnityPrint(UnityStrWas);
+        UnityPrintFloat(actual[index]);
+        UnityPrint(UnityStrAllowed);
+        UnityPrintFloat(UnityFloatTolerance(expected[index], pos_abs_tol, pos_rel_tol));
+#else
+        UnityPrint(UnityStrDelta);
+#endif
+        UnityPrintFailedElements(failed, num_elements);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+UNITY_BOOL UnityAssertFloatsWithinTolerance(const _UF abs_tol,
+                                          const _UF rel_tol,
+                                          const _UF expected,
+                                          const _UF actual,
+                                          const char* msg,
+                                          const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareFloatsTolerance(abs_tol, rel_tol, &expected, &actual, 1, msg, lineNumber);
+}
+
+UNITY_BOOL UnityAssertFloatArrayWithinTolerance(const _UF abs_tol,
+                                              const _UF rel_tol,
+                                              UNITY_PTR_ATTRIBUTE const _UF* expected,
+                                              UNITY_PTR_ATTRIBUTE const _UF* actual,
+                                              const _UU32 num_elements,
+                                              const char* msg,
+                                              const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareFloatsTolerance(abs_tol, rel_tol, expected, actual, num_elements, msg, lineNumber);
+}
+
+#endif // defined(UNITY_INCLUDE_FLOAT)
+
+//-----------------------------------------------
+#if defined(UNITY_INCLUDE_DOUBLE)
+static int UnityDoubleArrayElementsDiffer(const _UD expected, const _UD actual)
+{
+    _UD diff, tol;
+
+    diff = expected - actual;
+    if (diff < 0.0)
+      diff = 0.0 - diff;
+    tol = UNITY_DOUBLE_PRECISION * expected;
+    if (tol < 0.0)
+        tol = 0.0 - tol;
+
+    //This first part of this condition will catch any NaN or Infinite values
+    return ((diff * 0.0 != 0.0) || (diff > tol));
+}
+
+UNITY_BOOL UnityAssertEqualDoubleArray(UNITY_PTR_ATTRIBUTE const _UD* expected,
+                                 UNITY_PTR_ATTRIBUTE const _UD* actual,
+                                 const _UU32 num_elements,
+                                 const char* msg,
+                                 const UNITY_LINE_TYPE lineNumber)
+{
+    _UU32 elements = num_elements;
+    UNITY_PTR_ATTRIBUTE const _UD* ptr_expected = expected;
+    UNITY_PTR_ATTRIBUTE const _UD* ptr_actual = actual;
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+    UNITY_MISMATCHES_T mismatches;
+#endif
+
+    UNITY_SKIP_EXECUTION;
+
+    if (elements == 0)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE void*)expected, (UNITY_PTR_ATTRIBUTE void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    while (elements--)
+    {
+        if (UnityDoubleArrayElementsDiffer(*ptr_expected, *ptr_actual))
+        {
+            UnityTestResultsFailBegin(lineNumber);
+            UnityPrint(UnityStrElement);
+            UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
+#ifdef UNITY_DOUBLE_VERBOSE
+            UnityPrint(UnityStrExpected);
+            UnityPrintDouble(*ptr_expected);
+            UnityPrint(UnityStrWas);
+            UnityPrintDouble(*ptr_actual);
+#else
+            UnityPrint(UnityStrDelta);
+#endif
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+            UnityMismatchBegin(&mismatches, (num_elements - elements - 1));
+            while (elements--)
+            {
+                ptr_expected++;
+                ptr_actual++;
+                if (UnityDoubleArrayElementsDiffer(*ptr_expected, *ptr_actual))
+                    UnityMismatchAdd(&mismatches, (num_elements - elements - 1));
+            }
+            UnityMismatchEnd(&mismatches);
+#endif
+            UnityAddMsgIfSpecified(msg);
+            UNITY_FAIL_AND_BAIL;
+        }
+        ptr_expected++;
+        ptr_actual++;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertDoublesWithin(const _UD delta,
+                              const _UD expected,
+                              const _UD actual,
+                              const char* msg,
+                              const UNITY_LINE_TYPE lineNumber)
+{
+    _UD diff = actual - expected;
+    _UD pos_delta = delta;
+
+    UNITY_SKIP_EXECUTION;
+
+    if (diff < 0.0)
+    {
+        diff = 0.0 - diff;
+    }
+    if (pos_delta < 0.0)
+    {
+        pos_delta = 0.0 - pos_delta;
+    }
+
+    //This first part of this condition will catch any NaN or Infinite values
+    if ((diff * 0.0 != 0.0) || (pos_delta < diff))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+#ifdef UNITY_DOUBLE_VERBOSE
+        UnityPrint(UnityStrExpected);
+        UnityPrintDouble(expected);
+        UnityPrint(UnityStrWas);
+        UnityPrintDouble(actual);
+#else
+        UnityPrint(UnityStrDelta);
+#endif
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertDoubleSpecial(const _UD actual,
+                              const char* msg,
+                              const UNITY_LINE_TYPE lineNumber,
+                              const UNITY_FLOAT_TRAIT_T style)
+{
+    const char* trait_names[] = { UnityStrInf, UnityStrNegInf, UnityStrNaN, UnityStrDet };
+    _U_SINT should_be_trait   = ((_U_SINT)style & 1);
+    _U_SINT is_trait          = !should_be_trait;
+    _U_SINT trait_index       = style >> 1;
+
+    UNITY_SKIP_EXECUTION;
+
+    switch(style)
+    {
+        //To determine Inf / Neg Inf, we compare to an Inf / Neg Inf value we create on the fly
+        //We are using a variable to hold the zero value because some compilers complain about dividing by zero otherwise
+        case UNITY_FLOAT_IS_INF:
+        case UNITY_FLOAT_IS_NOT_INF:
+            is_trait = ((1.0 / d_zero) == actual) ? 1 : 0;
+            break;
+        case UNITY_FLOAT_IS_NEG_INF:
+        case UNITY_FLOAT_IS_NOT_NEG_INF:
+            is_trait = ((-1.0 / d_zero) == actual) ? 1 : 0;
+            break;
+
+        //NaN is the only floating point value that does NOT equal itself. Therefore if Actual == Actual, then it is NOT NaN.
+        case UNITY_FLOAT_IS_NAN:
+        case UNITY_FLOAT_IS_NOT_NAN:
+            is_trait = (actual == actual) ? 0 : 1;
+            break;
+
+        //A determinate number is non infinite and not NaN. (therefore the opposite of the two above)
+        case UNITY_FLOAT_IS_DET:
+        case UNITY_FLOAT_IS_NOT_DET:
+            if ( (actual != actual) || ((1.0 / d_zero) == actual) || ((-1.0 / d_zero) == actual) )
+                is_trait = 0;
+            else
+                is_trait = 1;
+            break;
+    default:
+        ;
+    }
+
+    if (is_trait != should_be_trait)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpected);
+        if (!should_be_trait)
+            UnityPrint(UnityStrNot);
+        UnityPrint(trait_names[trait_index]);
+        UnityPrint(UnityStrWas);
+#ifdef UNITY_DOUBLE_VERBOSE
+        UnityPrintDouble(actual);
+#else
+        if (should_be_trait)
+            UnityPrint(UnityStrNot);
+        UnityPrint(trait_names[trait_index]);
+#endif
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+#ifdef UNITY_SUPPORT_64
+/// Maps the bit pattern of an IEEE double onto an unsigned integer that runs in the same
+/// order as the values, with -0 and +0 on the same integer, so the distance between two
+/// of them is the number of representable values (ULPs) between them
+static _UU64 UnityDoubleToOrdered(const _UD value)
+{
+    _UU64 bits;
+    _UU64 negative;
+
+    memcpy(&bits, &value, sizeof(bits));
+    negative = (_UU64)0 - (bits >> 63);
+    return ((_UU64)1 << 63) + (((bits & (((_UU64)1 << 63) - 1)) ^ negative) - negative);
+}
+
+/// ULP distance between two doubles; NaN on either side counts as the largest distance of all
+static _UU64 UnityDoubleUlpDistance(const _UD expected, const _UD actual)
+{
+    const _UU64 ordered_exp = UnityDoubleToOrdered(expected);
+    const _UU64 ordered_act = UnityDoubleToOrdered(actual);
+    const _UU64 distance = (ordered_exp > ordered_act) ? (ordered_exp - ordered_act) : (ordered_act - ordered_exp);
+
+    return distance | ((_UU64)0 - (_UU64)((expected != expected) | (actual != actual)));
+}
+
+/// Counts the elements more than max_ulps apart and finds the worst distance, like the float
+/// scan. GCC -O3 vectorizes it from SSE4.2 on x86-64, which has the 64-bit compares
+static _UU32 UnityDoubleUlpScan(UNITY_PTR_ATTRIBUTE const _UD* expected,
+                               UNITY_PTR_ATTRIBUTE const _UD* actual,
+                               const _UU32 num_elements,
+                               const _UU64 max_ulps,
+                               _UU64* worst)
+{
+    _UU64 distance;
+    _UU64 worst_distance = 0;
+    _UU32 failed = 0;
+    _UU32 i;
+
+    for (i = 0; i < num_elements; i++)
+    {
+        distance = UnityDoubleUlpDistance(expected[i], actual[i]);
+        failed += (distance > max_ulps);
+        worst_distance = (distance > worst_distance) ? distance : worst_distance;
+    }
+    *worst = worst_distance;
+    return failed;
+}
+
+static UNITY_BOOL UnityCompareDoublesUlp(const _UU64 max_ulps,
+                                      UNITY_PTR_ATTRIBUTE const _UD* expected,
+                                      UNITY_PTR_ATTRIBUTE const _UD* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber)
+{
+    _UU64 worst;
+    _UU32 index;
+    _UU32 failed;
+
+    if (sizeof(_UD) != sizeof(_UU64))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrErrUlp);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (num_elements == 0)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE const void*)expected, (UNITY_PTR_ATTRIBUTE const void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    failed = UnityDoubleUlpScan(expected, actual, num_elements, max_ulps, &worst);
+    if (failed > 0)
+    {
+        for (index = 0; UnityDoubleUlpDistance(expected[index], actual[index]) != worst; index++)
+            ;
+        UnityPrintWorstElement(lineNumber, index, num_elements);
+#ifdef UNITY_DOUBLE_VERBOSE
+        UnityPrint(UnityStrExpected);
+        UnityPrintDouble(expected[index]);
+        UnityPrint(UnityStrWas);
+        UnityPrintDouble(actual[index]);
+#endif
+        UnityPrint(UnityStrOffBy);
+        if (worst == ~(_UU64)0)
+            UnityPrint(UnityStrNaN);
+        else
+            UnityPrintNumberUnsigned(worst);
+        UnityPrint(UnityStrUlp);
+        UnityPrint(UnityStrAllowed);
+        UnityPrintNumberUnsigned(max_ulps);
+        UnityPrintFailedElements(failed, num_elements);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+UNITY_BOOL UnityAssertDoublesWithinUlp(const _UU64 max_ulps,
+                                    const _UD expected,
+                                    const _UD actual,
+                                    const char* msg,
+                                    const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareDoublesUlp(max_ulps, &expected, &actual, 1, msg, lineNumber);
+}
+
+UNITY_BOOL UnityAssertDoubleArrayWithinUlp(const _UU64 max_ulps,
+                                        UNITY_PTR_ATTRIBUTE const _UD* expected,
+                                        UNITY_PTR_ATTRIBUTE const _UD* actual,
+                                        const _UU32 num_elements,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareDoublesUlp(max_ulps, expected, actual, num_elements, msg, lineNumber);
+}
+#endif // defined(UNITY_SUPPORT_64)
+
+/// The larger of abs_tol and rel_tol * |expected|
+static _UD UnityDoubleTolerance(const _UD expected, const _UD abs_tol, const _UD rel_tol)
+{
+    const _UD tol = rel_tol * ((expected < 0.0) ? -expected : expected);
+
+    return (tol > abs_tol) ? tol : abs_tol;
+}
+
+/// Non-zero when |actual - expected| is over the tolerance, NaN or infinite. Equal values always
+/// pass, so infinities of the same sign are within any tolerance
+static int UnityDoubleOutsideTolerance(const _UD expected, const _UD actual, const _UD abs_tol, const _UD rel_tol)
+{
+    _UD diff = actual - expected;
+
+    diff = (diff < 0.0) ? -diff : diff;
+    return (actual != expected) & ((diff > UnityDoubleTolerance(expected, abs_tol, rel_tol)) | ((diff * 0.0) != 0.0));
+}
+
+/// Counts the elements outside the tolerance. The loop only accumulates, with no branches,
+/// early exit or index capture, so GCC -O3 vectorizes it from SSE4.2 on x86-64
+static _UU32 UnityDoubleToleranceScan(UNITY_PTR_ATTRIBUTE const _UD* expected,
+                                     UNITY_PTR_ATTRIBUTE const _UD* actual,
+                                     const _UU32 num_elements,
+                                     const _UD abs_tol,
+                                     const _UD rel_tol)
+{
+    _UU32 failed = 0;
+    _UU32 i;
+
+    for (i = 0; i < num_elements; i++)
+        failed += (_UU32)UnityDoubleOutsideTolerance(expected[i], actual[i], abs_tol, rel_tol);
+    return failed;
+}
+
+/// The failing element furthest outside its tolerance, counting a NaN or infinite difference as
+/// the furthest of all. Only called once the scan has found a failure
+static _UU32 UnityDoubleToleranceWorst(UNITY_PTR_ATTRIBUTE const _UD* expected,
+                                      UNITY_PTR_ATTRIBUTE const _UD* actual,
+                                      const _UU32 num_elements,
+                                      const _UD abs_tol,
+                                      const _UD rel_tol)
+{
+    const _UD infinity = 1.0 / d_zero;
+    _UD diff;
+    _UD excess;
+    _UD worst = 0.0;
+    _UU32 index = 0;
+    _UU32 i;
+
+    for (i = 0; i < num_elements; i++)
+    {
+        if (!UnityDoubleOutsideTolerance(expected[i], actual[i], abs_tol, rel_tol))
+            continue;
+        diff = actual[i] - expected[i];
+        diff = (diff < 0.0) ? -diff : diff;
+        excess = ((diff * 0.0) == 0.0) ? (diff - UnityDoubleTolerance(expected[i], abs_tol, rel_tol)) : infinity;
+        if (excess > worst)
+        {
+            worst = excess;
+            index = i;
+        }
+    }
+    return index;
+}
+
+static UNITY_BOOL UnityCompareDoublesTolerance(const _UD abs_tol,
+                                            const _UD rel_tol,
+                                            UNITY_PTR_ATTRIBUTE const _UD* expected,
+                                            UNITY_PTR_ATTRIBUTE const _UD* actual,
+                                            const _UU32 num_elements,
+                                            const char* msg,
+                                            const UNITY_LINE_TYPE lineNumber)
+{
+    const _UD pos_abs_tol = (abs_tol < 0.0) ? -abs_tol : abs_tol;
+    const _UD pos_rel_tol = (rel_tol < 0.0) ? -rel_tol : rel_tol;
+    _UU32 index;
+    _UU32 failed;
+
+    if (num_elements == 0)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE const void*)expected, (UNITY_PTR_ATTRIBUTE const void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    failed = UnityDoubleToleranceScan(expected, actual, num_elements, pos_abs_tol, pos_rel_tol);
+    if (failed > 0)
+    {
+        index = UnityDoubleToleranceWorst(expected, actual, num_elements, pos_abs_tol, pos_rel_tol);
+        UnityPrintWorstElement(lineNumber, index, num_elements);
+#ifdef UNITY_DOUBLE_VERBOSE
+        UnityPrint(UnityStrExpected);
+        UnityPrintDouble(expected[index]);
+        UnityPrint(UnityStrWas);
+        UnityPrintDouble(actual[index]);
+        UnityPrint(UnityStrAllowed);
+        UnityPrintDouble(UnityDoubleTolerance(expected[index], pos_abs_tol, pos_rel_tol));
+#else
+        UnityPrint(UnityStrDelta);
+#endif
+        UnityPrintFailedElements(failed, num_elements);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+UNITY_BOOL UnityAssertDoublesWithinTolerance(const _UD abs_tol,
+                                          const _UD rel_tol,
+                                          const _UD expected,
+                                          const _UD actual,
+                                          const char* msg,
+                                          const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareDoublesTolerance(abs_tol, rel_tol, &expected, &actual, 1, msg, lineNumber);
+}
+
+UNITY_BOOL UnityAssertDoubleArrayWithinTolerance(const _UD abs_tol,
+                                              const _UD rel_tol,
+                                              UNITY_PTR_ATTRIBUTE const _UD* expected,
+                                              UNITY_PTR_ATTRIBUTE const _UD* actual,
+                                              const _UU32 num_elements,
+                                              const char* msg,
+                                              const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareDoublesTolerance(abs_tol, rel_tol, expected, actual, num_elements, msg, lineNumber);
+}
+
+#endif // defined(UNITY_INCLUDE_DOUBLE)
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertNumbersWithin( const _U_UINT delta,
+                               const _U_SINT expected,
+                               const _U_SINT actual,
+                               const char* msg,
+                               const UNITY_LINE_TYPE lineNumber,
+                               const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_BOOL failed;
+
+    UNITY_SKIP_EXECUTION;
+
+    if ((style & UNITY_DISPLAY_RANGE_INT) == UNITY_DISPLAY_RANGE_INT)
+    {
+        if (actual > expected)
+            failed = ((_U_UINT)(actual - expected) > delta);
+        else
+            failed = ((_U_UINT)(expected - actual) > delta);
+    }
+    else
+    {
+        if ((_U_UINT)actual > (_U_UINT)expected)
+            failed = ((_U_UINT)(actual - expected) > delta);
+        else
+            failed = ((_U_UINT)(expected - actual) > delta);
+    }
+
+    if (failed)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrDelta);
+        UnityPrintNumberByStyle((_U_SINT)delta, style);
+        UnityPrint(UnityStrExpected);
+        UnityPrintNumberByStyle(expected, style);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle(actual, style);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualString(const char* expected,
+                            const char* actual,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber)
+{
+    _UU32 i;
+    UNITY_BOOL failed = 0;
+
+    UNITY_SKIP_EXECUTION;
+
+    // if both pointers not null compare the strings
+    if (expected && actual)
+    {
+        for (i = 0; expected[i] || actual[i]; i++)
+        {
+            if (expected[i] != actual[i])
+            {
+                failed = 1;
+                break;
+            }
+        }
+    }
+    else
+    { // handle case of one pointers being null (if both null, test should pass)
+        if (expected != actual)
+        {
+            failed = 1;
+        }
+    }
+
+    if (failed)
+    {
+      UnityTestResultsFailBegin(lineNumber);
+      UnityPrintExpectedAndActualStrings(expected, actual);
+      UnityAddMsgIfSpecified(msg);
+      UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualStringLen(const char* expected,
+                            const char* actual,
+                            const _UU32 length,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber)
+{
+    _UU32 i;
+    UNITY_BOOL failed = 0;
+
+    UNITY_SKIP_EXECUTION;
+
+    // if both pointers not null compare the strings
+    if (expected && actual)
+    {
+        for (i = 0; (expected[i] || actual[i]) && i < length; i++)
+        {
+            if (expected[i] != actual[i])
+            {
+                failed = 1;
+                break;
+            }
+        }
+    }
+    else
+    { // handle case of one pointers being null (if both null, test should pass)
+        if (expected != actual)
+        {
+            failed = 1;
+        }
+    }
+
+    if (failed)
+    {
+      UnityTestResultsFailBegin(lineNumber);
+      UnityPrintExpectedAndActualStringsLen(expected, actual, length);
+      UnityAddMsgIfSpecified(msg);
+      UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------
+UNITY_BOOL UnityAssertEqualStringArray( const char** expected,
+                                  const char** actual,
+                                  const _UU32 num_elements,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber)
+{
+    _UU32 i, j = 0;
+    UNITY_BOOL failed = 0;
+
+    UNITY_SKIP_EXECUTION;
+
+    // if no elements, it's an error
+    if (num_elements == 0)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE void*)expected, (UNITY_PTR_ATTRIBUTE void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    do
+    {
+        // if both pointers not null compare the strings
+        if (expected[j] && actual[j])
+        {
+            for (i = 0; expected[j][i] || actual[j][i]; i++)
+            {
+                if (expected[j][i] != actual[j][i])
+                {
+                    failed = 1;
+                    break;
+                }
+            }
+        }
+        else
+        { // handle case of one pointers being null (if both null, test should pass)
+            if (expected[j] != actual[j])
+            {
+                failed = 1;
+            }
+        }
+
+        if (failed)
+        {
+            UnityTestResultsFailBegin(lineNumber);
+            if (num_elements > 1)
+            {
+                UnityPrint(UnityStrElement);
+                UnityPrintNumberByStyle((j), UNITY_DISPLAY_STYLE_UINT);
+            }
+            UnityPrintExpectedAndActualStrings((const char*)(expected[j]), (const char*)(actual[j]));
+            UnityAddMsgIfSpecified(msg);
+            UNITY_FAIL_AND_BAIL;
+        }
+    } while (++j < num_elements);
+
+    return 0;
+}
+
+//-----------------------------------------------
+/// The comparison behind UnityAssertEqualMemory, shared with the file assertions so
+/// the assertion is only counted once.
+static UNITY_BOOL UnityCompareMemory( UNITY_PTR_ATTRIBUTE const void* expected,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 length,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_PTR_ATTRIBUTE unsigned char* ptr_exp = (UNITY_PTR_ATTRIBUTE unsigned char*)expected;
+    UNITY_PTR_ATTRIBUTE unsigned char* ptr_act = (UNITY_PTR_ATTRIBUTE unsigned char*)actual;
+    _UU32 elements = num_elements;
+    _UU32 bytes;
+
+    if ((elements == 0) || (length == 0))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE void*)expected, (UNITY_PTR_ATTRIBUTE void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    while (elements--)
+    {
+        /////////////////////////////////////
+        bytes = length;
+        while (bytes--)
+        {
+            if (*ptr_exp != *ptr_act)
+            {
+                UnityTestResultsFailBegin(lineNumber);
+                UnityPrint(UnityStrMemory);
+                if (num_elements > 1)
+                {
+                    UnityPrint(UnityStrElement);
+                    UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
+                }
+                UnityPrint(UnityStrByte);
+                UnityPrintNumberByStyle((length - bytes - 1), UNITY_DISPLAY_STYLE_UINT);
+                UnityPrint(UnityStrExpected);
+                UnityPrintNumberByStyle(*ptr_exp, UNITY_DISPLAY_STYLE_HEX8);
+                UnityPrint(UnityStrWas);
+                UnityPrintNumberByStyle(*ptr_act, UNITY_DISPLAY_STYLE_HEX8);
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+                UnityPrintMismatchedElements(expected, actual, ((num_elements - elements - 1) * length) + (length - bytes - 1), num_elements * length, 1);
+#endif
+                UnityAddMsgIfSpecified(msg);
+#ifdef UNITY_MEMORY_DIFF
+                UnityPrintMemoryDiff(expected, actual, ((num_elements - elements - 1) * length) + (length - bytes - 1), num_elements * length);
+#endif
+                UNITY_FAIL_AND_BAIL;
+            }
+            ptr_exp += 1;
+            ptr_act += 1;
+        }
+        /////////////////////////////////////
+
+    }
+    return 0;
+}
+
+UNITY_BOOL UnityAssertEqualMemory( UNITY_PTR_ATTRIBUTE const void* expected,
+                             UNITY_PTR_ATTRIBUTE const void* actual,
+                             const _UU32 length,
+                             const _UU32 num_elements,
+                             const char* msg,
+                             const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    return UnityCompareMemory(expected, actual, length, num_elements, msg, lineNumber);
+}
+
+//-----------------------------------------------
+#ifdef UNITY_INCLUDE_FILE
+typedef struct _UNITY_FILE_T
+{
+    const char* Path;
+    _UU32 Size;
+#ifdef UNITY_FILE_MMAP
+    int Descriptor;
+    UNITY_PTR_ATTRIBUTE const unsigned char* Data;
+#else
+    FILE* Stream;
+#endif
+} UNITY_FILE_T;
+
+/// Golden files are rewritten instead of checked when UNITY_UPDATE_GOLDEN=1 is in the environment
+static int UnityUpdateGolden(void)
+{
+    const char* update = getenv(UNITY_UPDATE_GOLDEN_ENV);
+
+    return (update != NULL) && (update[0] == '1') && (update[1] == '\0');
+}
+
+#ifdef UNITY_FILE_MMAP
+/// The whole file is mapped read-only, so it is compared in place without a copy on the heap
+static int UnityFileOpen(UNITY_FILE_T* file, const char* path)
+{
+    struct stat info;
+    void* map;
+
+    file->Path = path;
+    file->Size = 0;
+    file->Data = NULL;
+    file->Descriptor = open(path, O_RDONLY);
+    if (file->Descriptor < 0)
+        return 0;
+
+    if ((fstat(file->Descriptor, &info) != 0) || ((off_t)(_UU32)info.st_size != info.st_size))
+    {
+        close(file->Descriptor);
+        return 0;
+    }
+
+    file->Size = (_UU32)info.st_size;
+    if (file->Size > 0)
+    {
+        map = mmap(NULL, file->Size, PROT_READ, MAP_PRIVATE, file->Descriptor, 0);
+        if (map == MAP_FAILED)
+        {
+            close(file->Descriptor);
+            return 0;
+        }
+        file->Data = (UNITY_PTR_ATTRIBUTE const unsigned char*)map;
+    }
+    return 1;
+}
+
+static void UnityFileClose(UNITY_FILE_T* file)
+{
+    if (file->Data != NULL)
+    {
+        munmap((void*)file->Data, file->Size);
+    }
+    close(file->Descriptor);
+}
+#else
+static int UnityFileOpen(UNITY_FILE_T* file, const char* path)
+{
+    long size;
+
+    file->Path = path;
+    file->Size = 0;
+    file->Stream = fopen(path, "rb");
+    if (file->Stream == NULL)
+        return 0;
+
+    if ((fseek(file->Stream, 0, SEEK_END) != 0) || ((size = ftell(file->Stream)) < 0) || (fseek(file->Stream, 0, SEEK_SET) != 0))
+    {
+        fclose(file->Stream);
+        return 0;
+    }
+    file->Size = (_UU32)size;
+    return 1;
+}
+
+static void UnityFileClose(UNITY_FILE_T* file)
+{
+    fclose(file->Stream);
+}
+
+static UNITY_THREAD_LOCAL unsigned char UnityFileBlockExp[UNITY_FILE_BLOCK_SIZE];
+static UNITY_THREAD_LOCAL unsigned char UnityFileBlockAct[UNITY_FILE_BLOCK_SIZE];
+
+/// Reads the next 'count' bytes of the golden file into UnityFileBlockExp, and of the actual file
+/// into UnityFileBlockAct. A buffer given as 'actual' is used in place from 'offset'. Returns the
+/// actual bytes, or NULL with the path that could not be read in 'failed'
+static UNITY_PTR_ATTRIBUTE const unsigned char* UnityFileReadBlock(UNITY_FILE_T* expected,
+                                                                   UNITY_PTR_ATTRIBUTE const unsigned char* actual,
+                                                                   UNITY_FILE_T* actual_file,
+                                                                   const _UU32 offset,
+                                                                   const _UU32 count,
+                                                                   const char** failed)
+{
+    *failed = expected->Path;
+    if (fread(UnityFileBlockExp, 1, count, expected->Stream) != count)
+        return NULL;
+    if (actual_file == NULL)
+        return &actual[offset];
+
+    *failed = actual_file->Path;
+    if (fread(UnityFileBlockAct, 1, count, actual_file->Stream) != count)
+        return NULL;
+    return UnityFileBlockAct;
+}
+
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+/// Lists the differences from byte 'first' of the block at 'offset' to the end of the files. The
+/// rest is read through the same blocks, so a read error just ends the list early
+static void UnityPrintFileMismatches(UNITY_FILE_T* expected,
+                                     UNITY_PTR_ATTRIBUTE const unsigned char* actual,
+                                     UNITY_FILE_T* actual_file,
+                                     UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act,
+                                     _UU32 offset,
+                                     const _UU32 first,
+                                     _UU32 count)
+{
+    UNITY_MISMATCHES_T mismatches;
+    const char* failed;
+    _UU32 i = first + 1;
+
+    UnityMismatchBegin(&mismatches, offset + first);
+    while (ptr_act != NULL)
+    {
+        if (memcmp(&UnityFileBlockExp[i], &ptr_act[i], (size_t)(count - i)) != 0)
+        {
+            for (; i < count; i++)
+            {
+                if (UnityFileBlockExp[i] != ptr_act[i])
+                    UnityMismatchAdd(&mismatches, offset + i);
+            }
+        }
+        offset += count;
+        count = expected->Size - offset;
+        if (count == 0)
+            break;
+        if (count > UNITY_FILE_BLOCK_SIZE)
+            count = UNITY_FILE_BLOCK_SIZE;
+        ptr_act = UnityFileReadBlock(expected, actual, actual_file, offset, count, &failed);
+        i = 0;
+    }
+    UnityMismatchEnd(&mismatches);
+}
+#endif
+
+#ifdef UNITY_MEMORY_DIFF
+/// Reads the bytes around 'index' back into the blocks to print them as UnityPrintMemoryDiff does
+static void UnityPrintFileDiff(UNITY_FILE_T* expected,
+                               UNITY_PTR_ATTRIBUTE const unsigned char* actual,
+                               UNITY_FILE_T* actual_file,
+                               const _UU32 index)
+{
+    const _UU32 start = UnityMemoryDiffStart(index);
+    _UU32 count = ((expected->Size - start) > UNITY_MEMORY_DIFF_WINDOW) ? UNITY_MEMORY_DIFF_WINDOW : (expected->Size - start);
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act;
+    const char* failed;
+
+    if (count > UNITY_FILE_BLOCK_SIZE)
+        count = UNITY_FILE_BLOCK_SIZE;
+    if ((fseek(expected->Stream, (long)start, SEEK_SET) != 0) ||
+        ((actual_file != NULL) && (fseek(actual_file->Stream, (long)start, SEEK_SET) != 0)))
+        return;
+    ptr_act = UnityFileReadBlock(expected, actual, actual_file, start, count, &failed);
+    if (ptr_act != NULL)
+        UnityPrintMemoryDiffRows(UnityFileBlockExp, ptr_act, start, count);
+}
+#endif
+#endif
+
+static UNITY_BOOL UnityFileFail(const char* failure, const char* path, const char* msg, const UNITY_LINE_TYPE lineNumber)
+{
+    UnityTestResultsFailBegin(lineNumber);
+    UnityPrint(failure);
+    UnityPrint(path);
+    UNITY_OUTPUT_CHAR('\'');
+    UnityAddMsgIfSpecified(msg);
+    UNITY_FAIL_AND_BAIL;
+}
+
+/// Compares an opened golden file with either a buffer or a second opened file of the same size
+static UNITY_BOOL UnityCompareFile(UNITY_FILE_T* expected,
+                                   UNITY_PTR_ATTRIBUTE const unsigned char* actual,
+                                   UNITY_FILE_T* actual_file,
+                                   const char* msg,
+                                   const UNITY_LINE_TYPE lineNumber)
+{
+#ifdef UNITY_FILE_MMAP
+    if (expected->Size == 0)
+        return 0;
+    if (actual_file != NULL)
+        actual = actual_file->Data;
+    return UnityCompareMemory(expected->Data, actual, expected->Size, 1, msg, lineNumber);
+#else
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act;
+    const char* failed;
+    _UU32 offset;
+    _UU32 count;
+    _UU32 i;
+
+    for (offset = 0; offset < expected->Size; offset += count)
+    {
+        count = expected->Size - offset;
+        if (count > UNITY_FILE_BLOCK_SIZE)
+            count = UNITY_FILE_BLOCK_SIZE;
+
+        ptr_act = UnityFileReadBlock(expected, actual, actual_file, offset, count, &failed);
+        if (ptr_act == NULL)
+            return UnityFileFail(UnityStrFileRead, failed, msg, lineNumber);
+
+        if (memcmp(UnityFileBlockExp, ptr_act, count) != 0)
+        {
+            for (i = 0; UnityFileBlockExp[i] == ptr_act[i]; i++)
+                ;
+            UnityTestResultsFailBegin(lineNumber);
+            UnityPrint(UnityStrMemory);
+            UnityPrint(UnityStrByte);
+            UnityPrintNumberUnsigned(offset + i);
+            UnityPrint(UnityStrExpected);
+            UnityPrintNumberByStyle(UnityFileBlockExp[i], UNITY_DISPLAY_STYLE_HEX8);
+            UnityPrint(UnityStrWas);
+            UnityPrintNumberByStyle(ptr_act[i], UNITY_DISPLAY_STYLE_HEX8);
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+            UnityPrintFileMismatches(expected, actual, actual_file, ptr_act, offset, i, count);
+#endif
+            UnityAddMsgIfSpecified(msg);
+#ifdef UNITY_MEMORY_DIFF
+            UnityPrintFileDiff(expected, actual, actual_file, offset + i);
+#endif
+            UNITY_FAIL_AND_BAIL;
+        }
+    }
+    return 0;
+#endif
+}
+
+static UNITY_BOOL UnityCheckFileSize(const _UU32 expected, const _UU32 actual, const char* msg, const UNITY_LINE_TYPE lineNumber)
+{
+    if (expected == actual)
+        return 0;
+
+    UnityTestResultsFailBegin(lineNumber);
+    UnityPrint(UnityStrFileSize);
+    UnityPrint(UnityStrExpected);
+    UnityPrintNumberUnsigned(expected);
+    UnityPrint(UnityStrWas);
+    UnityPrintNumberUnsigned(actual);
+    UnityAddMsgIfSpecified(msg);
+    UNITY_FAIL_AND_BAIL;
+}
+
+static int UnityWriteGolden(const char* path, UNITY_PTR_ATTRIBUTE const void* data, const _UU32 length)
+{
+    FILE* golden = fopen(path, "wb");
+    int written;
+
+    if (golden == NULL)
+        return 0;
+    written = (fwrite(data, 1, length, golden) == length);
+    return (fclose(golden) == 0) && written;
+}
+
+static int UnityCopyGolden(const char* path, const char* source_path)
+{
+    static UNITY_THREAD_LOCAL unsigned char block[UNITY_FILE_BLOCK_SIZE];
+    FILE* source = fopen(source_path, "rb");
+    FILE* golden;
+    size_t count;
+    int written = 1;
+
+    if (source == NULL)
+        return 0;
+    golden = fopen(path, "wb");
+    if (golden == NULL)
+    {
+        fclose(source);
+        return 0;
+    }
+    while (written && ((count = fread(block, 1, sizeof(block), source)) > 0))
+    {
+        written = (fwrite(block, 1, count, golden) == count);
+    }
+    written = written && !ferror(source);
+    fclose(source);
+    return (fclose(golden) == 0) && written;
+}
+
+UNITY_BOOL UnityAssertEqualFile(const char* path,
+                                UNITY_PTR_ATTRIBUTE const void* actual,
+                                const _UU32 length,
+                                const char* msg,
+                                const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_FILE_T golden;
+    UNITY_BOOL result;
+
+    UNITY_SKIP_EXECUTION;
+
+    if ((actual == NULL) && (length > 0))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNullPointerForActual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if (UnityUpdateGolden())
+    {
+        if (UnityWriteGolden(path, actual, length))
+            return 0;
+        return UnityFileFail(UnityStrFileWrite, path, msg, lineNumber);
+    }
+
+    if (!UnityFileOpen(&golden, path))
+        return UnityFileFail(UnityStrFileRead, path, msg, lineNumber);
+
+    result = UnityCheckFileSize(golden.Size, length, msg, lineNumber);
+    if (result == 0)
+        result = UnityCompareFile(&golden, (UNITY_PTR_ATTRIBUTE const unsigned char*)actual, NULL, msg, lineNumber);
+    UnityFileClose(&golden);
+    return result;
+}
+
+UNITY_BOOL UnityAssertFilesEqual(const char* expected_path,
+                                 const char* actual_path,
+                                 const char* msg,
+                                 const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_FILE_T golden;
+    UNITY_FILE_T actual;
+    UNITY_BOOL result;
+
+    UNITY_SKIP_EXECUTION;
+
+    if (UnityUpdateGolden())
+    {
+        // a file compared with itself is already up to date; opening it to write would empty it
+        if ((strcmp(expected_path, actual_path) == 0) || UnityCopyGolden(expected_path, actual_path))
+            return 0;
+        return UnityFileFail(UnityStrFileWrite, expected_path, msg, lineNumber);
+    }
+
+    if (!UnityFileOpen(&golden, expected_path))
+        return UnityFileFail(UnityStrFileRead, expected_path, msg, lineNumber);
+    if (!UnityFileOpen(&actual, actual_path))
+    {
+        UnityFileClose(&golden);
+        return UnityFileFail(UnityStrFileRead, actual_path, msg, lineNumber);
+    }
+
+    result = UnityCheckFileSize(golden.Size, actual.Size, msg, lineNumber);
+    if (result == 0)
+        result = UnityCompareFile(&golden, NULL, &actual, msg, lineNumber);
+    UnityFileClose(&actual);
+    UnityFileClose(&golden);
+    return result;
+}
+#endif // defined(UNITY_INCLUDE_FILE)
 
 //-----------------------------------------------
-UNITY_BOOL UnityAssertLessOrEqualUnsignedNumber(const _U_UINT border,
-                            const _U_UINT actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_DISPLAY_STYLE_T style)
+#ifdef UNITY_INCLUDE_DIGEST
+UNITY_BOOL UnityAssertMemoryDigest(const _U_UINT expected,
+                                   UNITY_PTR_ATTRIBUTE const void* actual,
+                                   const _UU32 length,
+                                   const char* msg,
+                                   const UNITY_LINE_TYPE lineNumber,
+                                   const UNITY_DIGEST_T digest)
 {
+    _U_UINT digest_actual;
+
     UNITY_SKIP_EXECUTION;
 
-    if (border < actual) {
+    if (actual == NULL)
+    {
         UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpectedLessThanOrEqualTo);
-        UnityPrintNumberByStyle(border, style);
+        UnityPrint(UnityStrNullPointerForActual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    digest_actual = UnityDigest(actual, length, digest);
+    if (digest_actual != expected)
+    {
+        UnityPrintDigestMismatch(lineNumber, digest);
+        UnityPrint(UnityStrExpected);
+        UnityPrintDigest(expected, digest);
         UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
+        UnityPrintDigest(digest_actual, digest);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+    return 0;
+}
+
+//-----------------------------------------------
+/// 'expected' holds one digest per block of block_size bytes (the last block may be
+/// shorter), so a mismatch can be narrowed down to the block it is in.
+UNITY_BOOL UnityAssertMemoryDigestBlocks(UNITY_PTR_ATTRIBUTE const void* expected,
+                                         UNITY_PTR_ATTRIBUTE const void* actual,
+                                         const _UU32 length,
+                                         const _UU32 block_size,
+                                         const char* msg,
+                                         const UNITY_LINE_TYPE lineNumber,
+                                         const UNITY_DIGEST_T digest)
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act = (UNITY_PTR_ATTRIBUTE const unsigned char*)actual;
+    _UU32 blocks;
+    _UU32 block;
+    _UU32 start;
+    _UU32 size;
+    _U_UINT digest_expected;
+    _U_UINT digest_actual;
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+    UNITY_MISMATCHES_T mismatches;
+#endif
+
+    UNITY_SKIP_EXECUTION;
+
+    if ((length == 0) || (block_size == 0))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrPointless);
         UnityAddMsgIfSpecified(msg);
         UNITY_FAIL_AND_BAIL;
     }
-    return 0;
+
+    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE const void*)expected, (UNITY_PTR_ATTRIBUTE const void*)actual, lineNumber, msg) == 1)
+        return 1;
+
+    blocks = ((length - 1) / block_size) + 1;
+    for (block = 0; block < blocks; block++)
+    {
+        start = block * block_size;
+        size = ((length - start) > block_size) ? block_size : (length - start);
+#ifdef UNITY_SUPPORT_64
+        if (digest == UNITY_DIGEST_XXH64)
+            digest_expected = ((UNITY_PTR_ATTRIBUTE const _UU64*)expected)[block];
+        else
+#endif
+            digest_expected = ((UNITY_PTR_ATTRIBUTE const _UU32*)expected)[block];
+        digest_actual = UnityDigest(&ptr_act[start], size, digest);
+
+        if (digest_actual != digest_expected)
+        {
+            UnityPrintDigestMismatch(lineNumber, digest);
+            UnityPrint(UnityStrBlock);
+            UnityPrintNumberUnsigned(block);
+            UnityPrint(UnityStrBytes);
+            UnityPrintNumberUnsigned(start);
+            UNITY_OUTPUT_CHAR('-');
+            UnityPrintNumberUnsigned(start + size - 1);
+            UnityPrint(UnityStrExpected);
+            UnityPrintDigest(digest_expected, digest);
+            UnityPrint(UnityStrWas);
+            UnityPrintDigest(digest_actual, digest);
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+            UnityMismatchBegin(&mismatches, block);
+            for (block++; block < blocks; block++)
+            {
+                start = block * block_size;
+                size = ((length - start) > block_size) ? block_size : (length - start);
+#ifdef UNITY_SUPPORT_64
+                if (digest == UNITY_DIGEST_XXH64)
+                    digest_expected = ((UNITY_PTR_ATTRIBUTE const _UU64*)expected)[block];
+                else
+#endif
+                    digest_expected = ((UNITY_PTR_ATTRIBUTE const _UU32*)expected)[block];
+                if (UnityDigest(&ptr_act[start], size, digest) != digest_expected)
+                    UnityMismatchAdd(&mismatches, block);
+            }
+            UnityMismatchEnd(&mismatches);
+#endif
+            UnityAddMsgIfSpecified(msg);
+            UNITY_FAIL_AND_BAIL;
+        }
+    }
+    return 0;
+}
+#endif // defined(UNITY_INCLUDE_DIGEST)
+
+#ifdef UNITY_INCLUDE_PROPERTY
+//-----------------------------------------------
+// Property-Based Tests
+//-----------------------------------------------
+
+// Generators never see the random numbers directly; they take "choices" from a stream
+// that is recorded while a case is generated.  A failing case is shrunk by editing that
+// recording (dropping runs of choices, then lowering each one) and replaying it, so any
+// generator built from the ones below shrinks for free.  Every generator maps smaller
+// choices to simpler values: numbers nearer zero (or the bound nearest it), shorter
+// buffers and strings, earlier alternatives.
+static struct _UnityProperty
+{
+    UnityTestFunction Function;
+    _UU32 State[4];
+    _UU32 Choices[UNITY_PROPERTY_MAX_CHOICES];
+    _UU32 Best[UNITY_PROPERTY_MAX_CHOICES];
+    _UU32 Count;
+    _UU32 BestCount;
+    _UU32 Position;
+    _UU32 Tries;
+    UNITY_BOOL Replaying;
+    UNITY_BOOL Echo;
+    UNITY_BOOL Rejected;
+} UnityProperty;
+
+static _UU32 UnityPropertySeed = UNITY_PROPERTY_SEED;
+
+static const char UnityPropertyAlphabet[] =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+
+#define UNITY_PROPERTY_ROTL(x, r) ((_UU32)(((x) << (r)) | ((x) >> (32 - (r)))))
+
+/// xoshiro128** seeded through a splitmix-style hash, so nearby seeds give unrelated cases
+static void UnityPropertySeedState(_UU32 seed)
+{
+    _UU32 z;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        seed += 0x9E3779B9UL;
+        z = seed;
+        z = (z ^ (z >> 16)) * 0x85EBCA6BUL;
+        z = (z ^ (z >> 13)) * 0xC2B2AE35UL;
+        UnityProperty.State[i] = (z ^ (z >> 16)) | (_UU32)(i == 0);
+    }
+}
+
+static _UU32 UnityPropertyRandom(void)
+{
+    _UU32* s = UnityProperty.State;
+    const _UU32 result = (_UU32)(UNITY_PROPERTY_ROTL((_UU32)(s[1] * 5UL), 7) * 9UL);
+    const _UU32 t = (_UU32)(s[1] << 9);
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = UNITY_PROPERTY_ROTL(s[3], 11);
+    return result;
+}
+
+/// next choice below bound (any 32-bit value for a bound of 0): fresh and recorded
+/// while generating, from the recording while replaying (0, the simplest choice, once
+/// it runs out).  The reduced value is what gets recorded, so lowering a recorded
+/// choice always lowers the generated value
+static _UU32 UnityPropertyDraw(const _UU32 bound)
+{
+    _UU32 value;
+
+    if (UnityProperty.Replaying)
+    {
+        value = (UnityProperty.Position < UnityProperty.Count) ? UnityProperty.Choices[UnityProperty.Position] : 0;
+    }
+    else
+    {
+        value = UnityPropertyRandom();
+    }
+    if (bound != 0)
+    {
+        value %= bound;
+    }
+    if (!UnityProperty.Replaying && (UnityProperty.Position < UNITY_PROPERTY_MAX_CHOICES))
+    {
+        UnityProperty.Choices[UnityProperty.Position] = value;
+    }
+    UnityProperty.Position++;
+    return value;
+}
+
+/// a choice in [0, span], taking a second choice only when span needs more than 32 bits
+static _U_UINT UnityPropertyDrawUpTo(const _U_UINT span)
+{
+    _U_UINT value;
+
+#ifdef UNITY_SUPPORT_64
+    if (span > 0xFFFFFFFFu)
+    {
+        value = ((_U_UINT)UnityPropertyDraw(0) << 32) | (_U_UINT)UnityPropertyDraw(0);
+        return (span == (_U_UINT)(-1)) ? value : (value % (span + 1));
+    }
+#endif
+    value = (_U_UINT)UnityPropertyDraw((_UU32)(span + 1));
+    return value;
+}
+
+/// overwrite a choice recorded while generating, so that it replays as value
+static void UnityPropertyRecord(const _UU32 position, const _UU32 value)
+{
+    if (!UnityProperty.Replaying && (position < UNITY_PROPERTY_MAX_CHOICES))
+    {
+        UnityProperty.Choices[position] = value;
+    }
+}
+
+/// a choice in [0, span] where edges are tried more often than a uniform draw would: while
+/// generating, 1 in 16 cases each take the offset of the lower or of the upper bound (*edge
+/// is 1 or 2, else 0).  That is decided outside the recording, and the offset taken is
+/// recorded as if it had been drawn, so an edge case shrinks like any other.
+static _U_UINT UnityPropertyDrawOffset(const _U_UINT span, const _U_UINT lower, const _U_UINT upper, _UU32* edge)
+{
+    const _UU32 shape = UnityProperty.Replaying ? 0 : (UnityPropertyRandom() % 16);
+    const _UU32 position = UnityProperty.Position;
+    _U_UINT offset = UnityPropertyDrawUpTo(span);
+
+    *edge = (shape <= 2) ? shape : 0;
+    if (*edge != 0)
+    {
+        offset = (*edge == 1) ? lower : upper;
+#ifdef UNITY_SUPPORT_64
+        if (span > 0xFFFFFFFFu)
+        {
+            UnityPropertyRecord(position, (_UU32)(offset >> 32));
+            UnityPropertyRecord(position + 1, (_UU32)offset);
+            return offset;
+        }
+#endif
+        UnityPropertyRecord(position, (_UU32)offset);
+    }
+    return offset;
+}
+
+static void UnityPropertyGivenBegin(const UNITY_LINE_TYPE line)
+{
+    UnityTestResultsBegin(Unity.TestFile, line);
+    UnityPrint(UnityStrGiven);
+}
+
+//-----------------------------------------------
+_U_SINT UnityGenInt(const _U_SINT low, const _U_SINT high, const UNITY_LINE_TYPE line)
+{
+    // the distance from the value nearest zero and, when the range has values on both
+    // sides of it, the side (0 for above) are separate choices, so a smaller distance is
+    // always nearer zero.  A distance past the end of the side drawn goes to the other one
+    const _U_SINT origin = (low > 0) ? low : ((high < 0) ? high : 0);
+    const _U_UINT up = (_U_UINT)high - (_U_UINT)origin;
+    const _U_UINT down = (_U_UINT)origin - (_U_UINT)low;
+    _UU32 edge;
+    _U_UINT offset;
+    _UU32 side = 0;
+    _U_SINT value;
+
+    if (high < low)
+    {
+        return low;
+    }
+    offset = UnityPropertyDrawOffset((up > down) ? up : down, down, up, &edge);
+    if ((up != 0) && (down != 0))
+    {
+        side = UnityPropertyDraw(2);
+        if (edge != 0)
+        {
+            side = (edge == 1) ? 1 : 0;
+            UnityPropertyRecord(UnityProperty.Position - 1, side);
+        }
+    }
+    if ((side == 0) ? (offset <= up) : (offset > down))
+    {
+        value = (_U_SINT)((_U_UINT)origin + offset);
+    }
+    else
+    {
+        value = (_U_SINT)((_U_UINT)origin - offset);
+    }
+
+    if (UnityProperty.Echo)
+    {
+        UnityPropertyGivenBegin(line);
+        UnityPrintNumber(value);
+        UNITY_PRINT_EOL;
+    }
+    return value;
+}
+
+//-----------------------------------------------
+_U_UINT UnityGenUInt(const _U_UINT low, const _U_UINT high, const UNITY_LINE_TYPE line)
+{
+    _UU32 edge;
+    _U_UINT value;
+
+    if (high < low)
+    {
+        return low;
+    }
+    value = low + UnityPropertyDrawOffset(high - low, 0, high - low, &edge);
+    if (UnityProperty.Echo)
+    {
+        UnityPropertyGivenBegin(line);
+        UnityPrintNumberUnsigned(value);
+        UNITY_PRINT_EOL;
+    }
+    return value;
+}
+
+//-----------------------------------------------
+_UU32 UnityGenChoice(const _UU32 count, const UNITY_LINE_TYPE line)
+{
+    const _UU32 value = (count > 1) ? UnityPropertyDraw(count) : 0;
+
+    if (UnityProperty.Echo)
+    {
+        UnityPropertyGivenBegin(line);
+        UnityPrintNumberUnsigned(value);
+        UNITY_PRINT_EOL;
+    }
+    return value;
+}
+
+//-----------------------------------------------
+_UU32 UnityGenBytes(void* buffer, const _UU32 min_length, const _UU32 max_length, const UNITY_LINE_TYPE line)
+{
+    unsigned char* bytes = (unsigned char*)buffer;
+    _UU32 length = min_length;
+    _UU32 i;
+
+    if (max_length > min_length)
+    {
+        length += (_UU32)UnityPropertyDrawUpTo(max_length - min_length);
+    }
+    for (i = 0; i < length; i++)
+    {
+        bytes[i] = (unsigned char)UnityPropertyDraw(256);
+    }
+    if (UnityProperty.Echo)
+    {
+        UnityPropertyGivenBegin(line);
+        UnityPrintNumberUnsigned(length);
+        UnityPrint(UnityStrGivenBytes);
+        for (i = 0; i < length; i++)
+        {
+            UNITY_OUTPUT_CHAR(' ');
+            UnityPrintHexDigits(bytes[i], 2);
+        }
+        UNITY_PRINT_EOL;
+    }
+    return length;
+}
+
+//-----------------------------------------------
+_UU32 UnityGenString(char* buffer, const _UU32 size, const char* alphabet, const UNITY_LINE_TYPE line)
+{
+    const char* letters = (alphabet != NULL) ? alphabet : UnityPropertyAlphabet;
+    const _UU32 letter_count = (_UU32)strlen(letters);
+    _UU32 length = 0;
+    _UU32 i;
+
+    if ((size > 1) && (letter_count > 0))
+    {
+        length = (_UU32)UnityPropertyDrawUpTo(size - 1);
+    }
+    for (i = 0; i < length; i++)
+    {
+        buffer[i] = letters[UnityPropertyDraw(letter_count)];
+    }
+    if (size > 0)
+    {
+        buffer[length] = '\0';
+    }
+    if (UnityProperty.Echo)
+    {
+        UnityPropertyGivenBegin(line);
+        UNITY_OUTPUT_CHAR('\'');
+        UnityPrintLen(buffer, length);
+        UNITY_OUTPUT_CHAR('\'');
+        UNITY_PRINT_EOL;
+    }
+    return length;
+}
+
+#ifdef UNITY_INCLUDE_FLOAT
+//-----------------------------------------------
+_UF UnityGenFloat(const _UF low, const _UF high, const UNITY_LINE_TYPE line)
+{
+    // a fraction of the way from the value nearest zero towards one of the bounds; the
+    // top 1/16 of the choices land on the bound itself, so edges are tried often and a
+    // failing bound still shrinks smoothly towards zero
+    const _UF origin = (low > 0.0f) ? low : ((high < 0.0f) ? high : 0.0f);
+    const _UU32 side = UnityPropertyDraw(2);
+    const _UU32 choice = UnityPropertyDraw(0);
+    const _UF fraction = (choice >= 0xF0000000UL) ? (_UF)1.0f : ((_UF)choice / (_UF)4026531840.0f);
+    _UF value;
+
+    if (side != 0)
+    {
+        value = origin - (origin - low) * fraction;
+    }
+    else
+    {
+        value = origin + (high - origin) * fraction;
+    }
+
+    if (UnityProperty.Echo)
+    {
+        UnityPropertyGivenBegin(line);
+#ifdef UNITY_FLOAT_VERBOSE
+        UnityPrintFloat(value);
+#else
+        {
+            // without the float printer, show the bit pattern
+            _U_UINT bits = 0;
+
+            memcpy(&bits, &value, (sizeof(value) < sizeof(bits)) ? sizeof(value) : sizeof(bits));
+            UnityPrintNumberHex(bits, (char)(2 * ((sizeof(value) < sizeof(bits)) ? sizeof(value) : sizeof(bits))));
+        }
+#endif
+        UNITY_PRINT_EOL;
+    }
+    return value;
 }
+#endif
 
 //-----------------------------------------------
-UNITY_BOOL UnityAssertLessUnsignedNumber(const _U_UINT border,
-                            const _U_UINT actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_DISPLAY_STYLE_T style)
+void UnityPropertyReject(void)
 {
-    UNITY_SKIP_EXECUTION;
+    UnityProperty.Rejected = 1;
+}
 
-    if (border <= actual) {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpectedLessThan);
-        UnityPrintNumberByStyle(border, style);
-        UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
-    }
-    return 0;
+//-----------------------------------------------
+void UnitySetPropertySeed(const _UU32 seed)
+{
+    UnityPropertySeed = seed;
 }
 
 //-----------------------------------------------
-UNITY_BOOL UnityAssertEqualIntArray(UNITY_PTR_ATTRIBUTE const void* expected,
-                              UNITY_PTR_ATTRIBUTE const void* actual,
-                              const _UU32 num_elements,
-                              const char* msg,
-                              const UNITY_LINE_TYPE lineNumber,
-                              const UNITY_DISPLAY_STYLE_T style)
+static void UnityPropertyRunCase(void)
 {
-    _UU32 elements = num_elements;
-    UNITY_PTR_ATTRIBUTE const void* ptr_exp = (UNITY_PTR_ATTRIBUTE const void*)expected;
-    UNITY_PTR_ATTRIBUTE const void* ptr_act = (UNITY_PTR_ATTRIBUTE const void*)actual;
+    Unity.CurrentTestFailed = 0;
+    Unity.CurrentTestIgnored = 0;
+    UnityProperty.Rejected = 0;
+    UnityProperty.Position = 0;
+    UnityProperty.Function();
+}
 
-    UNITY_SKIP_EXECUTION;
+/// replay Choices[0, count); when it still fails it becomes the smallest counterexample so far
+static UNITY_BOOL UnityPropertyTry(const _UU32 count)
+{
+    _UU32 used;
 
-    if (elements == 0)
+    if (UnityProperty.Tries >= UNITY_PROPERTY_SHRINK_LIMIT)
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrPointless);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        return 0;
+    }
+    UnityProperty.Tries++;
+    UnityProperty.Count = count;
+    UnityProperty.Replaying = 1;
+    UnityPropertyRunCase();
+    if (!Unity.CurrentTestFailed || Unity.CurrentTestIgnored || UnityProperty.Rejected)
+    {
+        return 0;
     }
 
-    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE void*)expected, (UNITY_PTR_ATTRIBUTE void*)actual, lineNumber, msg) == 1)
-        return 1;
+    // choices past the end replay as 0 anyway, so trailing zeros need not be kept
+    used = (UnityProperty.Position < count) ? UnityProperty.Position : count;
+    while ((used > 0) && (UnityProperty.Choices[used - 1] == 0))
+    {
+        used--;
+    }
+    memcpy(UnityProperty.Best, UnityProperty.Choices, used * sizeof(_UU32));
+    UnityProperty.BestCount = used;
+    return 1;
+}
 
-    // If style is UNITY_DISPLAY_STYLE_INT, we'll fall into the default case rather than the INT16 or INT32 (etc) case
-    // as UNITY_DISPLAY_STYLE_INT includes a flag for UNITY_DISPLAY_RANGE_AUTO, which the width-specific
-    // variants do not. Therefore remove this flag.
-    switch(style & (UNITY_DISPLAY_STYLE_T)(~UNITY_DISPLAY_RANGE_AUTO))
+/// each pass drops runs of choices, zeroes runs of choices, then binary searches every
+/// choice down towards 0, until a whole round finds nothing smaller or the budget is spent
+static void UnityPropertyShrink(void)
+{
+    const _UU32 size_bytes = sizeof(_UU32);
+    UNITY_BOOL improved = 1;
+    _UU32 size;
+    _UU32 i;
+    _UU32 low;
+    _UU32 high;
+    _UU32 middle;
+
+    while (improved && (UnityProperty.Tries < UNITY_PROPERTY_SHRINK_LIMIT))
     {
-        case UNITY_DISPLAY_STYLE_HEX8:
-        case UNITY_DISPLAY_STYLE_INT8:
-        case UNITY_DISPLAY_STYLE_UINT8:
-            while (elements--)
+        improved = 0;
+        for (size = 8; size > 0; size /= 2)
+        {
+            for (i = 0; i + size <= UnityProperty.BestCount; )
             {
-                if (*(UNITY_PTR_ATTRIBUTE const _US8*)ptr_exp != *(UNITY_PTR_ATTRIBUTE const _US8*)ptr_act)
+                memcpy(UnityProperty.Choices, UnityProperty.Best, i * size_bytes);
+                memcpy(&UnityProperty.Choices[i], &UnityProperty.Best[i + size], (UnityProperty.BestCount - i - size) * size_bytes);
+                if (UnityPropertyTry(UnityProperty.BestCount - size))
                 {
-                    UnityTestResultsFailBegin(lineNumber);
-                    UnityPrint(UnityStrElement);
-                    UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
-                    UnityPrint(UnityStrExpected);
-                    UnityPrintNumberByStyle(*(UNITY_PTR_ATTRIBUTE const _US8*)ptr_exp, style);
-                    UnityPrint(UnityStrWas);
-                    UnityPrintNumberByStyle(*(UNITY_PTR_ATTRIBUTE const _US8*)ptr_act, style);
-                    UnityAddMsgIfSpecified(msg);
-                    UNITY_FAIL_AND_BAIL;
+                    improved = 1;
+                }
+                else
+                {
+                    i++;
                 }
-                ptr_exp = (UNITY_PTR_ATTRIBUTE const void*)((_UP)ptr_exp + 1);
-                ptr_act = (UNITY_PTR_ATTRIBUTE const void*)((_UP)ptr_act + 1);
             }
-            break;
-        case UNITY_DISPLAY_STYLE_HEX16:
-        case UNITY_DISPLAY_STYLE_INT16:
-        case UNITY_DISPLAY_STYLE_UINT16:
-            while (elements--)
+        }
+
+        for (size = 8; size > 1; size /= 2)
+        {
+            for (i = 0; i + size <= UnityProperty.BestCount; i += size)
             {
-                if (*(UNITY_PTR_ATTRIBUTE _US16*)ptr_exp != *(UNITY_PTR_ATTRIBUTE _US16*)ptr_act)
+                memcpy(UnityProperty.Choices, UnityProperty.Best, UnityProperty.BestCount * size_bytes);
+                memset(&UnityProperty.Choices[i], 0, size * size_bytes);
+                if ((memcmp(UnityProperty.Choices, UnityProperty.Best, UnityProperty.BestCount * size_bytes) != 0) &&
+                    UnityPropertyTry(UnityProperty.BestCount))
                 {
-                    UnityTestResultsFailBegin(lineNumber);
-                    UnityPrint(UnityStrElement);
-                    UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
-                    UnityPrint(UnityStrExpected);
-                    UnityPrintNumberByStyle(*(UNITY_PTR_ATTRIBUTE _US16*)ptr_exp, style);
-                    UnityPrint(UnityStrWas);
-                    UnityPrintNumberByStyle(*(UNITY_PTR_ATTRIBUTE _US16*)ptr_act, style);
-                    UnityAddMsgIfSpecified(msg);
-                    UNITY_FAIL_AND_BAIL;
+                    improved = 1;
                 }
-                ptr_exp = (UNITY_PTR_ATTRIBUTE const void*)((_UP)ptr_exp + 2);
-                ptr_act = (UNITY_PTR_ATTRIBUTE const void*)((_UP)ptr_act + 2);
             }
-            break;
-#ifdef UNITY_SUPPORT_64
-        case UNITY_DISPLAY_STYLE_HEX64:
-        case UNITY_DISPLAY_STYLE_INT64:
-        case UNITY_DISPLAY_STYLE_UINT64:
-            while (elements--)
+        }
+
+        for (i = 0; i < UnityProperty.BestCount; i++)
+        {
+            // 0 first: choices such as a generator's edge case are not ordered by size
+            low = 1;
+            high = UnityProperty.Best[i];
+            if (high != 0)
             {
-                if (*(UNITY_PTR_ATTRIBUTE _US64*)ptr_exp != *(UNITY_PTR_ATTRIBUTE _US64*)ptr_act)
+                memcpy(UnityProperty.Choices, UnityProperty.Best, UnityProperty.BestCount * size_bytes);
+                UnityProperty.Choices[i] = 0;
+                if (UnityPropertyTry(UnityProperty.BestCount))
                 {
-                    UnityTestResultsFailBegin(lineNumber);
-                    UnityPrint(UnityStrElement);
-                    UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
-                    UnityPrint(UnityStrExpected);
-                    UnityPrintNumberByStyle(*(UNITY_PTR_ATTRIBUTE _US64*)ptr_exp, style);
-                    UnityPrint(UnityStrWas);
-                    UnityPrintNumberByStyle(*(UNITY_PTR_ATTRIBUTE _US64*)ptr_act, style);
-                    UnityAddMsgIfSpecified(msg);
-                    UNITY_FAIL_AND_BAIL;
+                    improved = 1;
+                    continue;
                 }
-                ptr_exp = (UNITY_PTR_ATTRIBUTE const void*)((_UP)ptr_exp + 8);
-                ptr_act = (UNITY_PTR_ATTRIBUTE const void*)((_UP)ptr_act + 8);
             }
-            break;
-#endif
-        default:
-            while (elements--)
+            while ((low < high) && (i < UnityProperty.BestCount))
             {
-                if (*(UNITY_PTR_ATTRIBUTE _US32*)ptr_exp != *(UNITY_PTR_ATTRIBUTE _US32*)ptr_act)
+                middle = low + (high - low) / 2;
+                memcpy(UnityProperty.Choices, UnityProperty.Best, UnityProperty.BestCount * size_bytes);
+                UnityProperty.Choices[i] = middle;
+                if (UnityPropertyTry(UnityProperty.BestCount))
                 {
-                    UnityTestResultsFailBegin(lineNumber);
-                    UnityPrint(UnityStrElement);
-                    UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
-                    UnityPrint(UnityStrExpected);
-                    UnityPrintNumberByStyle(*(UNITY_PTR_ATTRIBUTE _US32*)ptr_exp, style);
-                    UnityPrint(UnityStrWas);
-                    UnityPrintNumberByStyle(*(UNITY_PTR_ATTRIBUTE _US32*)ptr_act, style);
-                    UnityAddMsgIfSpecified(msg);
-                    UNITY_FAIL_AND_BAIL;
+                    improved = 1;
+                    high = (i < UnityProperty.BestCount) ? UnityProperty.Best[i] : 0;
+                }
+                else
+                {
+                    low = middle + 1;
                 }
-                ptr_exp = (UNITY_PTR_ATTRIBUTE const void*)((_UP)ptr_exp + 4);
-                ptr_act = (UNITY_PTR_ATTRIBUTE const void*)((_UP)ptr_act + 4);
             }
-            break;
+        }
     }
-    return 0;
 }
 
 //-----------------------------------------------
-#if defined(UNITY_INCLUDE_FLOAT)
-UNITY_BOOL UnityAssertEqualFloatArray(UNITY_PTR_ATTRIBUTE const _UF* expected,
-                                UNITY_PTR_ATTRIBUTE const _UF* actual,
-                                const _UU32 num_elements,
-                                const char* msg,
-                                const UNITY_LINE_TYPE lineNumber)
+void UnityRunProperty(UnityTestFunction property, const _UU32 iterations, const UNITY_LINE_TYPE line)
 {
-    _UU32 elements = num_elements;
-    UNITY_PTR_ATTRIBUTE const _UF* ptr_expected = expected;
-    UNITY_PTR_ATTRIBUTE const _UF* ptr_actual = actual;
-    _UF diff, tol;
-
-    UNITY_SKIP_EXECUTION;
+    _UU32 i;
+    _UU32 seed = UnityPropertySeed;
+    _UU32 accepted = 0;
 
-    if (elements == 0)
+    if (Unity.CurrentTestFailed || Unity.CurrentTestIgnored)
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrPointless);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        return;
     }
 
-    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE const void*)expected, (UNITY_PTR_ATTRIBUTE const void*)actual, lineNumber, msg) == 1)
-        return 1;
-
-    while (elements--)
+    UnityProperty.Function = property;
+    UnityProperty.Tries = 0;
+    UnityOutputMuted = 1;
+    for (i = 0; i < iterations; i++)
     {
-        diff = *ptr_expected - *ptr_actual;
-        if (diff < 0.0f)
-          diff = 0.0f - diff;
-        tol = UNITY_FLOAT_PRECISION * *ptr_expected;
-        if (tol < 0.0f)
-            tol = 0.0f - tol;
-
-        //This first part of this condition will catch any NaN or Infinite values
-        if ((diff * 0.0f != 0.0f) || (diff > tol))
+        // each case has a seed of its own, so the printed one replays it as case 1
+        seed = UnityPropertySeed + i * (_UU32)0x9E3779B9UL;
+        UnityPropertySeedState(seed);
+        UnityProperty.Replaying = 0;
+        UnityPropertyRunCase();
+        if (Unity.CurrentTestFailed || Unity.CurrentTestIgnored)
         {
-            UnityTestResultsFailBegin(lineNumber);
-            UnityPrint(UnityStrElement);
-            UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
-#ifdef UNITY_FLOAT_VERBOSE
-            UnityPrint(UnityStrExpected);
-            UnityPrintFloat(*ptr_expected);
-            UnityPrint(UnityStrWas);
-            UnityPrintFloat(*ptr_actual);
-#else
-            UnityPrint(UnityStrDelta);
-#endif
-            UnityAddMsgIfSpecified(msg);
-            UNITY_FAIL_AND_BAIL;
+            break;
+        }
+        if (!UnityProperty.Rejected)
+        {
+            accepted++;
         }
-        ptr_expected++;
-        ptr_actual++;
-    }
-    return 0;
-}
-
-//-----------------------------------------------
-UNITY_BOOL UnityAssertFloatsWithin(const _UF delta,
-                             const _UF expected,
-                             const _UF actual,
-                             const char* msg,
-                             const UNITY_LINE_TYPE lineNumber)
-{
-    _UF diff = actual - expected;
-    _UF pos_delta = delta;
-
-    UNITY_SKIP_EXECUTION;
-
-    if (diff < 0.0f)
-    {
-        diff = 0.0f - diff;
-    }
-    if (pos_delta < 0.0f)
-    {
-        pos_delta = 0.0f - pos_delta;
-    }
-
-    //This first part of this condition will catch any NaN or Infinite values
-    if ((diff * 0.0f != 0.0f) || (pos_delta < diff))
-    {
-        UnityTestResultsFailBegin(lineNumber);
-#ifdef UNITY_FLOAT_VERBOSE
-        UnityPrint(UnityStrExpected);
-        UnityPrintFloat(expected);
-        UnityPrint(UnityStrWas);
-        UnityPrintFloat(actual);
-#else
-        UnityPrint(UnityStrDelta);
-#endif
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
     }
-    return 0;
-}
-
-//-----------------------------------------------
-UNITY_BOOL UnityAssertFloatSpecial(const _UF actual,
-                             const char* msg,
-                             const UNITY_LINE_TYPE lineNumber,
-                             const UNITY_FLOAT_TRAIT_T style)
-{
-    const char* trait_names[] = { UnityStrInf, UnityStrNegInf, UnityStrNaN, UnityStrDet };
-    _U_SINT should_be_trait   = ((_U_SINT)style & 1);
-    _U_SINT is_trait          = !should_be_trait;
-    _U_SINT trait_index       = (_U_SINT)(style >> 1);
-
-    UNITY_SKIP_EXECUTION;
+    UnityProperty.Replaying = 0;
+    UnityOutputMuted = 0;
 
-    switch(style)
+    if (Unity.CurrentTestIgnored)
     {
-        //To determine Inf / Neg Inf, we compare to an Inf / Neg Inf value we create on the fly
-        //We are using a variable to hold the zero value because some compilers complain about dividing by zero otherwise
-        case UNITY_FLOAT_IS_INF:
-        case UNITY_FLOAT_IS_NOT_INF:
-            is_trait = ((1.0f / f_zero) == actual) ? 1 : 0;
-            break;
-        case UNITY_FLOAT_IS_NEG_INF:
-        case UNITY_FLOAT_IS_NOT_NEG_INF:
-            is_trait = ((-1.0f / f_zero) == actual) ? 1 : 0;
-            break;
-
-        //NaN is the only floating point value that does NOT equal itself. Therefore if Actual == Actual, then it is NOT NaN.
-        case UNITY_FLOAT_IS_NAN:
-        case UNITY_FLOAT_IS_NOT_NAN:
-            is_trait = (actual == actual) ? 0 : 1;
-            break;
-
-        //A determinate number is non infinite and not NaN. (therefore the opposite of the two above)
-        case UNITY_FLOAT_IS_DET:
-        case UNITY_FLOAT_IS_NOT_DET:
-            if ( (actual != actual) || ((1.0f / f_zero) == actual) || ((-1.0f / f_zero) == actual) )
-                is_trait = 0;
-            else
-                is_trait = 1;
-            break;
-    default:
-        ;
+        // replay the case quietly skipped above so its ignore message is printed
+        UnityPropertySeedState(seed);
+        UnityPropertyRunCase();
+        return;
     }
-
-    if (is_trait != should_be_trait)
+    if (!Unity.CurrentTestFailed)
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpected);
-        if (!should_be_trait)
-            UnityPrint(UnityStrNot);
-        UnityPrint(trait_names[trait_index]);
-        UnityPrint(UnityStrWas);
-#ifdef UNITY_FLOAT_VERBOSE
-        UnityPrintFloat(actual);
-#else
-        if (should_be_trait)
-            UnityPrint(UnityStrNot);
-        UnityPrint(trait_names[trait_index]);
-#endif
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        // a property that never got past its assumptions has not been tested at all
+        if ((accepted == 0) && (iterations > 0))
+        {
+            UnityTestResultsFailBegin(line);
+            UnityPrint(UnityStrAllCases);
+            UnityPrintNumberUnsigned(iterations);
+            UnityPrint(UnityStrDiscarded);
+            UNITY_OUTPUT_CHAR('\n');
+            Unity.CurrentTestFailed = 1;
+        }
+        return;
     }
-    return 0;
-}
-#endif // defined(UNITY_INCLUDE_FLOAT)
-
-//-----------------------------------------------
-#if defined(UNITY_INCLUDE_DOUBLE)
-UNITY_BOOL UnityAssertEqualDoubleArray(UNITY_PTR_ATTRIBUTE const _UD* expected,
-                                 UNITY_PTR_ATTRIBUTE const _UD* actual,
-                                 const _UU32 num_elements,
-                                 const char* msg,
-                                 const UNITY_LINE_TYPE lineNumber)
-{
-    _UU32 elements = num_elements;
-    UNITY_PTR_ATTRIBUTE const _UD* ptr_expected = expected;
-    UNITY_PTR_ATTRIBUTE const _UD* ptr_actual = actual;
-    _UD diff, tol;
 
-    UNITY_SKIP_EXECUTION;
+    UnityProperty.BestCount = (UnityProperty.Position < UNITY_PROPERTY_MAX_CHOICES) ? UnityProperty.Position : UNITY_PROPERTY_MAX_CHOICES;
+    memcpy(UnityProperty.Best, UnityProperty.Choices, UnityProperty.BestCount * sizeof(_UU32));
+    UnityOutputMuted = 1;
+    UnityPropertyShrink();
+    UnityOutputMuted = 0;
 
-    if (elements == 0)
+    UnityTestResultsBegin(Unity.TestFile, line);
+    UnityPrint(UnityStrFalsified);
+    UnityPrintNumberUnsigned(i + 1);
+    UnityPrint(UnityStrOf);
+    UnityPrintNumberUnsigned(iterations);
+    UnityPrint(UnityStrCases);
+    UnityPrintNumberUnsigned(UnityProperty.Tries);
+    UnityPrint(UnityStrShrinks);
+    UnityPrintNumberHex(seed, 8);
+    UNITY_PRINT_EOL;
+
+    memcpy(UnityProperty.Choices, UnityProperty.Best, UnityProperty.BestCount * sizeof(_UU32));
+    UnityProperty.Count = UnityProperty.BestCount;
+    UnityProperty.Replaying = 1;
+    UnityProperty.Echo = 1;
+    UnityPropertyRunCase();
+    UnityProperty.Echo = 0;
+    UnityProperty.Replaying = 0;
+    if (!Unity.CurrentTestFailed)
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrPointless);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        UnityTestResultsFailBegin(line);
+        UnityPrint(UnityStrNotReplayed);
+        UNITY_OUTPUT_CHAR('\n');
+        Unity.CurrentTestFailed = 1;
     }
+}
+#endif // defined(UNITY_INCLUDE_PROPERTY)
 
-    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE void*)expected, (UNITY_PTR_ATTRIBUTE void*)actual, lineNumber, msg) == 1)
-        return 1;
+#ifdef UNITY_INCLUDE_DATA_FILE
+//-----------------------------------------------
+// Data File Tests
+//-----------------------------------------------
 
-    while (elements--)
-    {
-        diff = *ptr_expected - *ptr_actual;
-        if (diff < 0.0)
-          diff = 0.0 - diff;
-        tol = UNITY_DOUBLE_PRECISION * *ptr_expected;
-        if (tol < 0.0)
-            tol = 0.0 - tol;
+// A table file (written by auto/csv_to_table.rb) is a 16 byte header of little-endian
+// _UU32s: the magic "UDT1", the row count, the row size and the offset of the first row.
+// The column names and types sit between the header and the rows.  Rows are fixed-size
+// records laid out like a C struct, so each one is handed to the test in place.
+#define UNITY_DATA_MAGIC       (0x31544455UL)
+#define UNITY_DATA_HEADER_SIZE (16)
 
-        //This first part of this condition will catch any NaN or Infinite values
-        if ((diff * 0.0 != 0.0) || (diff > tol))
-        {
-            UnityTestResultsFailBegin(lineNumber);
-            UnityPrint(UnityStrElement);
-            UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
-#ifdef UNITY_DOUBLE_VERBOSE
-            UnityPrint(UnityStrExpected);
-            UnityPrintDouble(*ptr_expected);
-            UnityPrint(UnityStrWas);
-            UnityPrintDouble(*ptr_actual);
-#else
-            UnityPrint(UnityStrDelta);
+static struct _UnityDataFile
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* Row;
+    _UU32 RowSize;
+    _UU32 Index;
+    UNITY_BOOL Active;
+    UNITY_BOOL SizeMismatch;
+} UnityData;
+
+#ifndef UNITY_FILE_MMAP
+/// Rows are read into here when the table is not mapped, aligned for any field type
+static union
+{
+    unsigned char Bytes[UNITY_DATA_ROW_MAX];
+    _U_UINT Integer;
+    void* Pointer;
+#ifdef UNITY_INCLUDE_DOUBLE
+    _UD Double;
 #endif
-            UnityAddMsgIfSpecified(msg);
-            UNITY_FAIL_AND_BAIL;
-        }
-        ptr_expected++;
-        ptr_actual++;
+} UnityDataBuffer;
+#endif
+
+/// Failures inside a row are labelled with its index: test_Name[row]
+static void UnityPrintDataRow(void)
+{
+    if (UnityData.Active)
+    {
+        UNITY_OUTPUT_CHAR('[');
+        UnityPrintNumberUnsigned(UnityData.Index);
+        UNITY_OUTPUT_CHAR(']');
     }
-    return 0;
 }
 
-//-----------------------------------------------
-UNITY_BOOL UnityAssertDoublesWithin(const _UD delta,
-                              const _UD expected,
-                              const _UD actual,
-                              const char* msg,
-                              const UNITY_LINE_TYPE lineNumber)
+static _UU32 UnityDataWord(UNITY_PTR_ATTRIBUTE const unsigned char* bytes)
 {
-    _UD diff = actual - expected;
-    _UD pos_delta = delta;
+    return (_UU32)bytes[0] | ((_UU32)bytes[1] << 8) | ((_UU32)bytes[2] << 16) | ((_UU32)bytes[3] << 24);
+}
 
-    UNITY_SKIP_EXECUTION;
+/// Points at length bytes of the table at offset: in place when mapped, otherwise read into buffer
+static UNITY_PTR_ATTRIBUTE const unsigned char* UnityDataRead(UNITY_FILE_T* table, const _UU32 offset, unsigned char* buffer, const _UU32 length)
+{
+#ifdef UNITY_FILE_MMAP
+    (void)buffer;
+    (void)length;
+    return &table->Data[offset];
+#else
+    if ((fseek(table->Stream, (long)offset, SEEK_SET) != 0) || (fread(buffer, 1, length, table->Stream) != length))
+        return NULL;
+    return buffer;
+#endif
+}
 
-    if (diff < 0.0)
+void UnityRunDataFile(UnityTestFunction row_test, const char* path, const UNITY_LINE_TYPE line)
+{
+    UNITY_FILE_T table;
+    unsigned char header[UNITY_DATA_HEADER_SIZE];
+    UNITY_PTR_ATTRIBUTE const unsigned char* fields = NULL;
+    _UU32 rows = 0;
+    _UU32 row_size = 0;
+    _UU32 offset = 0;
+    _UU32 failures = 0;
+
+    if (!UnityFileOpen(&table, path))
     {
-        diff = 0.0 - diff;
+        UnityFileFail(UnityStrFileRead, path, NULL, line);
+        return;
     }
-    if (pos_delta < 0.0)
+
+    if (table.Size >= UNITY_DATA_HEADER_SIZE)
+        fields = UnityDataRead(&table, 0, header, UNITY_DATA_HEADER_SIZE);
+    if (fields != NULL)
     {
-        pos_delta = 0.0 - pos_delta;
+        rows = UnityDataWord(&fields[4]);
+        row_size = UnityDataWord(&fields[8]);
+        offset = UnityDataWord(&fields[12]);
+    }
+    // the first row must be 8 byte aligned, and the rows must fill the rest of the file exactly
+    if ((fields == NULL) || (UnityDataWord(fields) != UNITY_DATA_MAGIC) || (row_size == 0) ||
+        (offset < UNITY_DATA_HEADER_SIZE) || ((offset & 7) != 0) || (offset > table.Size) ||
+        (((table.Size - offset) % row_size) != 0) || (((table.Size - offset) / row_size) != rows))
+    {
+        UnityFileClose(&table);
+        UnityFileFail(UnityStrDataFile, path, NULL, line);
+        return;
+    }
+#ifndef UNITY_FILE_MMAP
+    if (row_size > UNITY_DATA_ROW_MAX)
+    {
+        UnityFileClose(&table);
+        UnityFileFail(UnityStrDataRowMax, path, NULL, line);
+        return;
     }
+#endif
 
-    //This first part of this condition will catch any NaN or Infinite values
-    if ((diff * 0.0 != 0.0) || (pos_delta < diff))
+    // a failing row is reported and the next one run, up to UNITY_DATA_FAILURE_LIMIT of them
+    UnityData.RowSize = row_size;
+    UnityData.SizeMismatch = 0;
+    UnityData.Active = 1;
+    for (UnityData.Index = 0; UnityData.Index < rows; UnityData.Index++)
     {
-        UnityTestResultsFailBegin(lineNumber);
-#ifdef UNITY_DOUBLE_VERBOSE
-        UnityPrint(UnityStrExpected);
-        UnityPrintDouble(expected);
-        UnityPrint(UnityStrWas);
-        UnityPrintDouble(actual);
+#ifdef UNITY_FILE_MMAP
+        UnityData.Row = UnityDataRead(&table, offset + UnityData.Index * row_size, NULL, row_size);
 #else
-        UnityPrint(UnityStrDelta);
+        UnityData.Row = UnityDataRead(&table, offset + UnityData.Index * row_size, UnityDataBuffer.Bytes, row_size);
+        if (UnityData.Row == NULL)
+        {
+            UnityFileFail(UnityStrFileRead, path, NULL, line);
+            break;
+        }
 #endif
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        row_test();
+        if (Unity.CurrentTestIgnored || UnityData.SizeMismatch)
+            break;
+        if (Unity.CurrentTestFailed)
+        {
+            Unity.CurrentTestFailed = 0;
+            if (++failures == UNITY_DATA_FAILURE_LIMIT)
+                break;
+        }
     }
-    return 0;
+    UnityData.Active = 0;
+    UnityFileClose(&table);
+
+    if (failures == 0)
+        return;
+    if (UnityData.Index + 1 < rows)
+    {
+        UnityTestResultsFailBegin(line);
+        UnityPrint(UnityStrDataStopped);
+        UnityPrintNumberUnsigned(failures);
+        UnityPrint(UnityStrDataFailedRows);
+        UnityPrintNumberUnsigned(rows);
+        UNITY_PRINT_EOL;
+    }
+    Unity.CurrentTestFailed = 1;
 }
 
-//-----------------------------------------------
-UNITY_BOOL UnityAssertDoubleSpecial(const _UD actual,
-                              const char* msg,
-                              const UNITY_LINE_TYPE lineNumber,
-                              const UNITY_FLOAT_TRAIT_T style)
+/// The row being run, or NULL (after failing) when it is not the size of the caller's row type
+UNITY_PTR_ATTRIBUTE const void* UnityDataRow(const _UU32 row_size, const UNITY_LINE_TYPE line)
 {
-    const char* trait_names[] = { UnityStrInf, UnityStrNegInf, UnityStrNaN, UnityStrDet };
-    _U_SINT should_be_trait   = ((_U_SINT)style & 1);
-    _U_SINT is_trait          = !should_be_trait;
-    _U_SINT trait_index       = style >> 1;
+    if (UnityData.Active && (row_size == UnityData.RowSize))
+        return UnityData.Row;
 
-    UNITY_SKIP_EXECUTION;
+    UnityTestResultsFailBegin(line);
+    UnityPrint(UnityStrDataRowSize);
+    UnityPrint(UnityStrExpected);
+    UnityPrintNumberUnsigned(UnityData.RowSize);
+    UnityPrint(UnityStrWas);
+    UnityPrintNumberUnsigned(row_size);
+    UNITY_PRINT_EOL;
+    Unity.CurrentTestFailed = 1;
+    UnityData.SizeMismatch = 1;
+    return NULL;
+}
 
-    switch(style)
-    {
-        //To determine Inf / Neg Inf, we compare to an Inf / Neg Inf value we create on the fly
-        //We are using a variable to hold the zero value because some compilers complain about dividing by zero otherwise
-        case UNITY_FLOAT_IS_INF:
-        case UNITY_FLOAT_IS_NOT_INF:
-            is_trait = ((1.0 / d_zero) == actual) ? 1 : 0;
-            break;
-        case UNITY_FLOAT_IS_NEG_INF:
-        case UNITY_FLOAT_IS_NOT_NEG_INF:
-            is_trait = ((-1.0 / d_zero) == actual) ? 1 : 0;
-            break;
+_UU32 UnityDataRowIndex(void)
+{
+    return UnityData.Index;
+}
+#endif // defined(UNITY_INCLUDE_DATA_FILE)
 
-        //NaN is the only floating point value that does NOT equal itself. Therefore if Actual == Actual, then it is NOT NaN.
-        case UNITY_FLOAT_IS_NAN:
-        case UNITY_FLOAT_IS_NOT_NAN:
-            is_trait = (actual == actual) ? 0 : 1;
-            break;
+#ifdef UNITY_INCLUDE_CONCURRENT
+//-----------------------------------------------
+// Concurrent Tests
+//-----------------------------------------------
 
-        //A determinate number is non infinite and not NaN. (therefore the opposite of the two above)
-        case UNITY_FLOAT_IS_DET:
-        case UNITY_FLOAT_IS_NOT_DET:
-            if ( (actual != actual) || ((1.0 / d_zero) == actual) || ((-1.0 / d_zero) == actual) )
-                is_trait = 0;
-            else
-                is_trait = 1;
-            break;
-    default:
-        ;
-    }
+// Each thread counts itself in and then spins until the last one has arrived, so they are
+// released within nanoseconds of each other instead of one scheduler wakeup apart; that is
+// what makes races show up.  The spin pauses the core, and now and then yields it, so that
+// with more threads than cores the ones still starting get to run.  A thread then runs the
+// body until it has done its iterations or any thread has failed.
+typedef struct
+{
+    pthread_t Thread;
+    _UU32 Index;
+    _UU32 Iteration;
+    _UU32 Elapsed;
+    UNITY_BOOL Failed;
+} UNITY_CONCURRENT_THREAD_T;
+
+static struct _UnityConcurrent
+{
+    UnityTestFunction Body;
+    _UU32 Threads;
+    _UU32 Iterations;
+    _UU32 Arrived;
+    UNITY_BOOL Pinned;
+    UNITY_CONCURRENT_THREAD_T Thread[UNITY_CONCURRENT_MAX_THREADS];
+} UnityConcurrent;
+
+static UNITY_THREAD_LOCAL UNITY_CONCURRENT_THREAD_T* UnityConcurrentSelf;
+
+#ifndef UNITY_CLOCK_US
+static _UU32 UnityConcurrentClock(void)
+{
+    struct timespec now;
 
-    if (is_trait != should_be_trait)
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (_UU32)now.tv_sec * 1000000u + (_UU32)(now.tv_nsec / 1000);
+}
+#define UNITY_CLOCK_US() UnityConcurrentClock()
+#endif
+
+static void UnityConcurrentPin(const _UU32 index)
+{
+#ifdef __linux__
+    cpu_set_t cores;
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (online < 1)
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrExpected);
-        if (!should_be_trait)
-            UnityPrint(UnityStrNot);
-        UnityPrint(trait_names[trait_index]);
-        UnityPrint(UnityStrWas);
-#ifdef UNITY_DOUBLE_VERBOSE
-        UnityPrintFloat(actual);
+        return;
+    }
+    CPU_ZERO(&cores);
+    CPU_SET((size_t)(index % (_UU32)online), &cores);
+    pthread_setaffinity_np(pthread_self(), sizeof(cores), &cores);
 #else
-        if (should_be_trait)
-            UnityPrint(UnityStrNot);
-        UnityPrint(trait_names[trait_index]);
+    (void)index;
 #endif
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
-    }
-    return 0;
 }
 
-#endif // defined(UNITY_INCLUDE_DOUBLE)
-
-//-----------------------------------------------
-UNITY_BOOL UnityAssertNumbersWithin( const _U_UINT delta,
-                               const _U_SINT expected,
-                               const _U_SINT actual,
-                               const char* msg,
-                               const UNITY_LINE_TYPE lineNumber,
-                               const UNITY_DISPLAY_STYLE_T style)
+static void* UnityConcurrentThread(void* argument)
 {
-    UNITY_SKIP_EXECUTION;
+    UNITY_CONCURRENT_THREAD_T* self = (UNITY_CONCURRENT_THREAD_T*)argument;
+    _UU32 start;
+    _UU32 spins = 0;
 
-    if ((style & UNITY_DISPLAY_RANGE_INT) == UNITY_DISPLAY_RANGE_INT)
+    UnityConcurrentSelf = self;
+    UnitySetThreadIndex(self->Index);
+    if (UnityConcurrent.Pinned)
     {
-        if (actual > expected)
-            Unity.CurrentTestFailed = ((_U_UINT)(actual - expected) > delta);
-        else
-            Unity.CurrentTestFailed = ((_U_UINT)(expected - actual) > delta);
+        UnityConcurrentPin(self->Index);
     }
-    else
+
+    UNITY_ATOMIC_ADD(UnityConcurrent.Arrived, 1);
+    while (UNITY_ATOMIC_LOAD(UnityConcurrent.Arrived) < UNITY_ATOMIC_LOAD(UnityConcurrent.Threads))
     {
-        if ((_U_UINT)actual > (_U_UINT)expected)
-            Unity.CurrentTestFailed = ((_U_UINT)(actual - expected) > delta);
+        if ((++spins % 1024u) == 0)
+        {
+            sched_yield();
+        }
         else
-            Unity.CurrentTestFailed = ((_U_UINT)(expected - actual) > delta);
+        {
+            UNITY_CPU_PAUSE();
+        }
     }
 
-    if (Unity.CurrentTestFailed)
+    start = UNITY_CLOCK_US();
+    for (self->Iteration = 0; self->Iteration < UnityConcurrent.Iterations; self->Iteration++)
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrDelta);
-        UnityPrintNumberByStyle((_U_SINT)delta, style);
-        UnityPrint(UnityStrExpected);
-        UnityPrintNumberByStyle(expected, style);
-        UnityPrint(UnityStrWas);
-        UnityPrintNumberByStyle(actual, style);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        if (UNITY_CURRENT_TEST_ENDED())
+        {
+            break;
+        }
+        UnityConcurrent.Body();
     }
-    return 0;
+    self->Elapsed = UNITY_CLOCK_US() - start;
+    self->Failed = UnityThreadFailed();
+    return NULL;
 }
 
-//-----------------------------------------------
-UNITY_BOOL UnityAssertEqualString(const char* expected,
-                            const char* actual,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber)
+/// count operations per second of elapsed microseconds, a digit pair at a time so that
+/// neither a 32 bit nor a 64 bit _U_UINT overflows on runs of under 40 seconds
+static _U_UINT UnityConcurrentRate(const _UU32 count, const _UU32 elapsed)
+{
+    _U_UINT rate = ((_U_UINT)count / elapsed) * 1000000u;
+    _U_UINT rest = (_U_UINT)count % elapsed;
+    _U_UINT scale = 1000000u;
+
+    while (scale > 1u)
+    {
+        rest *= 100u;
+        scale /= 100u;
+        rate += (rest / elapsed) * scale;
+        rest %= elapsed;
+    }
+    return rate;
+}
+
+void UnityRunConcurrent(UnityTestFunction body, const _UU32 threads, const _UU32 iterations, const UNITY_BOOL pinned, const UNITY_LINE_TYPE line)
 {
+    UNITY_CONCURRENT_THREAD_T* thread;
+    _UU32 started;
+    _UU32 failed = 0;
     _UU32 i;
 
-    UNITY_SKIP_EXECUTION;
+    if (Unity.CurrentTestFailed || Unity.CurrentTestIgnored)
+    {
+        return;
+    }
+    if ((threads == 0) || (threads > UNITY_CONCURRENT_MAX_THREADS))
+    {
+        UnityTestResultsFailBegin(line);
+        UnityPrint(UnityStrConcurrentThreads);
+        UNITY_PRINT_EOL;
+        Unity.CurrentTestFailed = 1;
+        return;
+    }
 
-    // if both pointers not null compare the strings
-    if (expected && actual)
+    UnityConcurrent.Body = body;
+    UnityConcurrent.Iterations = iterations;
+    UnityConcurrent.Pinned = pinned;
+    UnityConcurrent.Arrived = 0;
+    UNITY_ATOMIC_STORE(UnityConcurrent.Threads, threads);
+    for (started = 0; started < threads; started++)
     {
-        for (i = 0; expected[i] || actual[i]; i++)
+        thread = &UnityConcurrent.Thread[started];
+        thread->Index = started;
+        thread->Iteration = 0;
+        thread->Elapsed = 0;
+        thread->Failed = 0;
+        if (pthread_create(&thread->Thread, NULL, UnityConcurrentThread, thread) != 0)
         {
-            if (expected[i] != actual[i])
-            {
-                Unity.CurrentTestFailed = 1;
-                break;
-            }
+            // release the threads already waiting for the ones that will never come
+            UNITY_ATOMIC_STORE(UnityConcurrent.Threads, started);
+            UnityTestResultsFailBegin(line);
+            UnityPrint(UnityStrThreadStart);
+            UnityPrintNumberUnsigned((_U_UINT)started);
+            UNITY_PRINT_EOL;
+            UNITY_ATOMIC_STORE(Unity.CurrentTestFailed, 1);
+            break;
         }
     }
-    else
-    { // handle case of one pointers being null (if both null, test should pass)
-        if (expected != actual)
+    for (i = 0; i < started; i++)
+    {
+        pthread_join(UnityConcurrent.Thread[i].Thread, NULL);
+        if (UnityConcurrent.Thread[i].Failed)
         {
-            Unity.CurrentTestFailed = 1;
+            failed++;
         }
     }
+    UnityFlushThreadOutput();
 
+    if (Unity.CurrentTestIgnored)
+    {
+        return;
+    }
     if (Unity.CurrentTestFailed)
     {
-      UnityTestResultsFailBegin(lineNumber);
-      UnityPrintExpectedAndActualStrings(expected, actual);
-      UnityAddMsgIfSpecified(msg);
-      UNITY_FAIL_AND_BAIL;
+        if (failed > 0)
+        {
+            UnityTestResultsFailBegin(line);
+            UNITY_OUTPUT_CHAR(' ');
+            UnityPrintNumberUnsigned((_U_UINT)failed);
+            UnityPrint(UnityStrOf);
+            UnityPrintNumberUnsigned((_U_UINT)threads);
+            UnityPrint(UnityStrConcurrentFailed);
+            UNITY_PRINT_EOL;
+        }
+        return;
     }
-    return 0;
+    for (i = 0; i < threads; i++)
+    {
+        thread = &UnityConcurrent.Thread[i];
+        UnityTestResultsBegin(Unity.TestFile, line);
+        UnityPrint(UnityStrThread);
+        UnityPrintNumberUnsigned((_U_UINT)i);
+        UNITY_OUTPUT_CHAR(' ');
+        UnityPrintNumberUnsigned((_U_UINT)thread->Iteration);
+        UnityPrint(UnityStrOps);
+        UnityPrintNumberUnsigned((_U_UINT)thread->Elapsed);
+        UnityPrint(UnityStrMicroseconds);
+        if (thread->Elapsed > 0)
+        {
+            UnityPrintNumberUnsigned(UnityConcurrentRate(thread->Iteration, thread->Elapsed));
+            UnityPrint(UnityStrOpsPerSecond);
+        }
+        UNITY_PRINT_EOL;
+    }
+}
+
+_UU32 UnityConcurrentIteration(void)
+{
+    return (UnityConcurrentSelf != NULL) ? UnityConcurrentSelf->Iteration : 0;
 }
+#endif // defined(UNITY_INCLUDE_CONCURRENT)
 
+#ifdef UNITY_INCLUDE_INTERLEAVE
 //-----------------------------------------------
-UNITY_BOOL UnityAssertEqualStringLen(const char* expected,
-                            const char* actual,
-                            const _UU32 length,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber)
+// Interleaved Tests
+//-----------------------------------------------
+
+// The threads a schedule spawns are real threads, but only the one holding the turn runs.
+// It hands the turn on at UNITY_YIELD() and when it returns, and the scheduler gives it to
+// one of the threads still running: at random from the schedule's seed, or for
+// TEST_INTERLEAVED_ALL the next choice of a depth-first walk over every order that departs
+// from round robin at most UNITY_INTERLEAVE_MAX_PREEMPTIONS times.  Nothing else decides
+// which thread runs, so the same seed or walk position replays a schedule.
+#define UNITY_INTERLEAVE_JOINER       (UNITY_INTERLEAVE_MAX_THREADS)
+#define UNITY_INTERLEAVE_REPORT_STEPS (64)
+
+static struct _UnityInterleave
+{
+    UnityTestFunction Function[UNITY_INTERLEAVE_MAX_THREADS];
+    pthread_t Thread[UNITY_INTERLEAVE_MAX_THREADS];
+    _UU32 Index[UNITY_INTERLEAVE_MAX_THREADS];
+    UNITY_BOOL Done[UNITY_INTERLEAVE_MAX_THREADS];
+    _UU32 Threads;
+    _UU32 Running;
+    _UU32 Steps;
+    _UU32 Replay;
+    _UU32 Preemptions;
+    _UU32 State;
+    UNITY_BOOL Systematic;
+    UNITY_BOOL Stuck;
+    unsigned char Ran[UNITY_INTERLEAVE_MAX_STEPS];
+    unsigned char Choice[UNITY_INTERLEAVE_MAX_STEPS];
+    unsigned char Options[UNITY_INTERLEAVE_MAX_STEPS];
+} UnityInterleave;
+
+static pthread_mutex_t UnityInterleaveLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t UnityInterleaveTurn = PTHREAD_COND_INITIALIZER;
+static _UU32 UnityInterleaveSeed = UNITY_INTERLEAVE_SEED;
+
+/// one more than the index of the spawned thread this is, and 0 on every other thread
+static UNITY_THREAD_LOCAL _UU32 UnityInterleaveSelf;
+
+void UnitySetInterleaveSeed(const _UU32 seed)
+{
+    UnityInterleaveSeed = seed;
+}
+
+/// xorshift32, plenty for picking between a few threads
+static _UU32 UnityInterleaveRandom(void)
+{
+    _UU32 x = UnityInterleave.State;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    UnityInterleave.State = x;
+    return x;
+}
+
+/// give the turn to the next thread, or back to UNITY_JOIN() when none is left; called holding the lock.
+/// The threads are offered starting after the one giving the turn up, so the first option (all the
+/// depth-first walk takes at new turns) is round robin.  Any other option is a preemption, and once a
+/// schedule has used its UNITY_INTERLEAVE_MAX_PREEMPTIONS only the first is offered, so a thread spinning
+/// on UNITY_YIELD() keeps the turn a bounded number of times and the walk ends
+static void UnityInterleaveSchedule(void)
 {
+    _UU32 runnable[UNITY_INTERLEAVE_MAX_THREADS];
+    _UU32 count = 0;
+    _UU32 choice = 0;
+    _UU32 first = 0;
     _UU32 i;
+    _UU32 thread;
 
-    UNITY_SKIP_EXECUTION;
-
-    // if both pointers not null compare the strings
-    if (expected && actual)
+    if (UnityInterleave.Running != UNITY_INTERLEAVE_JOINER)
     {
-        for (i = 0; (expected[i] || actual[i]) && i < length; i++)
+        first = UnityInterleave.Running + 1;
+    }
+    for (i = 0; i < UnityInterleave.Threads; i++)
+    {
+        thread = (first + i) % UnityInterleave.Threads;
+        if (!UnityInterleave.Done[thread])
         {
-            if (expected[i] != actual[i])
-            {
-                Unity.CurrentTestFailed = 1;
-                break;
-            }
+            runnable[count++] = thread;
         }
     }
+    if (count == 0)
+    {
+        UnityInterleave.Running = UNITY_INTERLEAVE_JOINER;
+    }
+    else if (UnityInterleave.Steps == UNITY_INTERLEAVE_MAX_STEPS)
+    {
+        // out of turns: each thread gives up at its next yield, in index order
+        UnityInterleave.Stuck = 1;
+        UnityInterleave.Running = runnable[0];
+    }
     else
-    { // handle case of one pointers being null (if both null, test should pass)
-        if (expected != actual)
+    {
+        if (!UnityInterleave.Systematic)
         {
-            Unity.CurrentTestFailed = 1;
+            choice = UnityInterleaveRandom() % count;
+        }
+        else
+        {
+            if (UnityInterleave.Preemptions >= (_UU32)UNITY_INTERLEAVE_MAX_PREEMPTIONS)
+            {
+                count = 1;
+            }
+            if ((UnityInterleave.Steps < UnityInterleave.Replay) && (UnityInterleave.Choice[UnityInterleave.Steps] < count))
+            {
+                choice = UnityInterleave.Choice[UnityInterleave.Steps];
+            }
+            UnityInterleave.Choice[UnityInterleave.Steps] = (unsigned char)choice;
+            UnityInterleave.Options[UnityInterleave.Steps] = (unsigned char)count;
+            if (choice > 0)
+            {
+                UnityInterleave.Preemptions++;
+            }
         }
+        UnityInterleave.Running = runnable[choice];
+        UnityInterleave.Ran[UnityInterleave.Steps++] = (unsigned char)runnable[choice];
     }
+    pthread_cond_broadcast(&UnityInterleaveTurn);
+}
 
-    if (Unity.CurrentTestFailed)
+static void UnityInterleaveWait(const _UU32 self)
+{
+    while (UnityInterleave.Running != self)
     {
-      UnityTestResultsFailBegin(lineNumber);
-      UnityPrintExpectedAndActualStringsLen(expected, actual, length);
-      UnityAddMsgIfSpecified(msg);
-      UNITY_FAIL_AND_BAIL;
+        pthread_cond_wait(&UnityInterleaveTurn, &UnityInterleaveLock);
     }
 }
 
+static void* UnityInterleaveThread(void* argument)
+{
+    const _UU32 self = *(const _UU32*)argument;
 
-//-----------------------------------------------
-UNITY_BOOL UnityAssertEqualStringArray( const char** expected,
-                                  const char** actual,
-                                  const _UU32 num_elements,
-                                  const char* msg,
-                                  const UNITY_LINE_TYPE lineNumber)
+    UnitySetThreadIndex(self);
+    UnityInterleaveSelf = self + 1;
+    pthread_mutex_lock(&UnityInterleaveLock);
+    UnityInterleaveWait(self);
+    pthread_mutex_unlock(&UnityInterleaveLock);
+
+    if (!UNITY_CURRENT_TEST_ENDED())
+    {
+        UnityInterleave.Function[self]();
+    }
+
+    pthread_mutex_lock(&UnityInterleaveLock);
+    UnityInterleave.Done[self] = 1;
+    UnityInterleaveSchedule();
+    pthread_mutex_unlock(&UnityInterleaveLock);
+    return NULL;
+}
+
+void UnityInterleaveYield(void)
 {
-    _UU32 i, j = 0;
+    _UU32 self;
 
-    UNITY_SKIP_EXECUTION;
+    if (UnityInterleaveSelf == 0)
+    {
+        return;
+    }
+    self = UnityInterleaveSelf - 1;
 
-    // if no elements, it's an error
-    if (num_elements == 0)
+    pthread_mutex_lock(&UnityInterleaveLock);
+    if (UNITY_CURRENT_TEST_ENDED() || UnityInterleave.Stuck)
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrPointless);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        // nothing this thread does now counts, and it may be waiting for one that has stopped
+        UnityInterleave.Done[self] = 1;
+        UnityInterleaveSchedule();
+        pthread_mutex_unlock(&UnityInterleaveLock);
+        pthread_exit(NULL);
     }
+    UnityInterleaveSchedule();
+    UnityInterleaveWait(self);
+    pthread_mutex_unlock(&UnityInterleaveLock);
+}
 
-    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE void*)expected, (UNITY_PTR_ATTRIBUTE void*)actual, lineNumber, msg) == 1)
-        return 1;
+void UnityInterleaveSpawn(UnityTestFunction function, const UNITY_LINE_TYPE line)
+{
+    if (UnityInterleave.Threads == UNITY_INTERLEAVE_MAX_THREADS)
+    {
+        UnityTestResultsFailBegin(line);
+        UnityPrint(UnityStrSpawnLimit);
+        UNITY_PRINT_EOL;
+        Unity.CurrentTestFailed = 1;
+        return;
+    }
+    UnityInterleave.Function[UnityInterleave.Threads++] = function;
+}
 
-    do
+void UnityInterleaveJoin(const UNITY_LINE_TYPE line)
+{
+    _UU32 started;
+    _UU32 i;
+
+    UnityInterleave.Running = UNITY_INTERLEAVE_JOINER;
+    for (started = 0; started < UnityInterleave.Threads; started++)
     {
-        // if both pointers not null compare the strings
-        if (expected[j] && actual[j])
+        UnityInterleave.Index[started] = started;
+        UnityInterleave.Done[started] = 0;
+        if (pthread_create(&UnityInterleave.Thread[started], NULL, UnityInterleaveThread, &UnityInterleave.Index[started]) != 0)
         {
-            for (i = 0; expected[j][i] || actual[j][i]; i++)
-            {
-                if (expected[j][i] != actual[j][i])
-                {
-                    Unity.CurrentTestFailed = 1;
-                    break;
-                }
-            }
-        }
-        else
-        { // handle case of one pointers being null (if both null, test should pass)
-            if (expected[j] != actual[j])
-            {
-                Unity.CurrentTestFailed = 1;
-            }
+            UnityTestResultsFailBegin(line);
+            UnityPrint(UnityStrThreadStart);
+            UnityPrintNumberUnsigned((_U_UINT)started);
+            UNITY_PRINT_EOL;
+            UNITY_ATOMIC_STORE(Unity.CurrentTestFailed, 1);
+            break;
         }
+    }
+    for (i = started; i < UnityInterleave.Threads; i++)
+    {
+        UnityInterleave.Done[i] = 1;
+    }
 
-        if (Unity.CurrentTestFailed)
-        {
-            UnityTestResultsFailBegin(lineNumber);
-            if (num_elements > 1)
-            {
-                UnityPrint(UnityStrElement);
-                UnityPrintNumberByStyle((j), UNITY_DISPLAY_STYLE_UINT);
-            }
-            UnityPrintExpectedAndActualStrings((const char*)(expected[j]), (const char*)(actual[j]));
-            UnityAddMsgIfSpecified(msg);
-            UNITY_FAIL_AND_BAIL;
-        }
-    } while (++j < num_elements);
+    pthread_mutex_lock(&UnityInterleaveLock);
+    UnityInterleaveSchedule();
+    UnityInterleaveWait(UNITY_INTERLEAVE_JOINER);
+    pthread_mutex_unlock(&UnityInterleaveLock);
+    for (i = 0; i < started; i++)
+    {
+        pthread_join(UnityInterleave.Thread[i], NULL);
+    }
+    UnityInterleave.Threads = 0;
+    UnityFlushThreadOutput();
 
-    return 0;
+    if (UnityInterleave.Stuck)
+    {
+        UnityTestResultsFailBegin(line);
+        UnityPrint(UnityStrScheduleStuck);
+        UNITY_PRINT_EOL;
+        Unity.CurrentTestFailed = 1;
+    }
 }
 
-//-----------------------------------------------
-UNITY_BOOL UnityAssertEqualMemory( UNITY_PTR_ATTRIBUTE const void* expected,
-                             UNITY_PTR_ATTRIBUTE const void* actual,
-                             const _UU32 length,
-                             const _UU32 num_elements,
-                             const char* msg,
-                             const UNITY_LINE_TYPE lineNumber)
+/// move the depth-first walk on to the next order: take the next option at the last turn
+/// that has one left, and the first option at every turn after it
+static UNITY_BOOL UnityInterleaveBacktrack(void)
 {
-    UNITY_PTR_ATTRIBUTE unsigned char* ptr_exp = (UNITY_PTR_ATTRIBUTE unsigned char*)expected;
-    UNITY_PTR_ATTRIBUTE unsigned char* ptr_act = (UNITY_PTR_ATTRIBUTE unsigned char*)actual;
-    _UU32 elements = num_elements;
-    _UU32 bytes;
-
-    UNITY_SKIP_EXECUTION;
+    _UU32 step = UnityInterleave.Steps;
 
-    if ((elements == 0) || (length == 0))
+    while ((step > 0) && ((_UU32)UnityInterleave.Choice[step - 1] + 1u >= (_UU32)UnityInterleave.Options[step - 1]))
     {
-        UnityTestResultsFailBegin(lineNumber);
-        UnityPrint(UnityStrPointless);
-        UnityAddMsgIfSpecified(msg);
-        UNITY_FAIL_AND_BAIL;
+        step--;
     }
+    if (step == 0)
+    {
+        return 0;
+    }
+    UnityInterleave.Choice[step - 1]++;
+    UnityInterleave.Replay = step;
+    return 1;
+}
 
-    if (UnityCheckArraysForNull((UNITY_PTR_ATTRIBUTE void*)expected, (UNITY_PTR_ATTRIBUTE void*)actual, lineNumber, msg) == 1)
-        return 1;
+void UnityRunInterleaved(UnityTestFunction body, const _UU32 schedules, const UNITY_LINE_TYPE line)
+{
+    const _UU32 limit = (schedules == 0) ? (_UU32)UNITY_INTERLEAVE_MAX_SCHEDULES : schedules;
+    _UU32 seed = UnityInterleaveSeed;
+    _UU32 i;
+    _UU32 step;
 
-    while (elements--)
+    if (Unity.CurrentTestFailed || Unity.CurrentTestIgnored)
     {
-        /////////////////////////////////////
-        bytes = length;
-        while (bytes--)
+        return;
+    }
+
+    UnityInterleave.Systematic = (UNITY_BOOL)(schedules == 0);
+    UnityInterleave.Replay = 0;
+    for (i = 0; i < limit; i++)
+    {
+        // each schedule has a seed of its own, so the printed one replays it as schedule 1
+        seed = UnityInterleaveSeed + i * (_UU32)0x9E3779B9UL;
+        UnityInterleave.State = ((seed ^ (seed >> 16)) * 0x85EBCA6BUL) | 1u;
+        UnityInterleave.Steps = 0;
+        UnityInterleave.Preemptions = 0;
+        UnityInterleave.Stuck = 0;
+        UnityInterleave.Threads = 0;
+        body();
+        if (Unity.CurrentTestFailed || Unity.CurrentTestIgnored)
         {
-            if (*ptr_exp != *ptr_act)
-            {
-                UnityTestResultsFailBegin(lineNumber);
-                UnityPrint(UnityStrMemory);
-                if (num_elements > 1)
-                {
-                    UnityPrint(UnityStrElement);
-                    UnityPrintNumberByStyle((num_elements - elements - 1), UNITY_DISPLAY_STYLE_UINT);
-                }
-                UnityPrint(UnityStrByte);
-                UnityPrintNumberByStyle((length - bytes - 1), UNITY_DISPLAY_STYLE_UINT);
-                UnityPrint(UnityStrExpected);
-                UnityPrintNumberByStyle(*ptr_exp, UNITY_DISPLAY_STYLE_HEX8);
-                UnityPrint(UnityStrWas);
-                UnityPrintNumberByStyle(*ptr_act, UNITY_DISPLAY_STYLE_HEX8);
-                UnityAddMsgIfSpecified(msg);
-                UNITY_FAIL_AND_BAIL;
-            }
-            ptr_exp += 1;
-            ptr_act += 1;
+            break;
         }
-        /////////////////////////////////////
+        if (UnityInterleave.Systematic && !UnityInterleaveBacktrack())
+        {
+            return;
+        }
+    }
+    if (!Unity.CurrentTestFailed)
+    {
+        return;
+    }
 
+    UnityTestResultsFailBegin(line);
+    UnityPrint(UnityStrSchedule);
+    UnityPrintNumberUnsigned((_U_UINT)(i + 1));
+    if (!UnityInterleave.Systematic)
+    {
+        UnityPrint(UnityStrOf);
+        UnityPrintNumberUnsigned((_U_UINT)limit);
     }
-    return 0;
+    UnityPrint(UnityStrScheduleFailed);
+    if (!UnityInterleave.Systematic)
+    {
+        UnityPrint(UnityStrScheduleSeed);
+        UnityPrintNumberHex(seed, 8);
+    }
+    UnityPrint(UnityStrThreadsRan);
+    for (step = 0; (step < UnityInterleave.Steps) && (step < UNITY_INTERLEAVE_REPORT_STEPS); step++)
+    {
+        UNITY_OUTPUT_CHAR(' ');
+        UnityPrintNumberUnsigned((_U_UINT)UnityInterleave.Ran[step]);
+    }
+    if (UnityInterleave.Steps > UNITY_INTERLEAVE_REPORT_STEPS)
+    {
+        UnityPrint(" ...");
+    }
+    UNITY_PRINT_EOL;
 }
+#endif // defined(UNITY_INCLUDE_INTERLEAVE)
 
 //-----------------------------------------------
 // Control Functions
@@ -1393,6 +5868,14 @@ UNITY_BOOL UnityFail(const char* msg, const UNITY_LINE_TYPE line)
     UNITY_FAIL_AND_BAIL;
 }
 
+//-----------------------------------------------
+/// Ends a failure whose details were printed after UnityTestResultsFailBegin, as the C++ front-end does
+UNITY_BOOL UnityTestResultsFailEnd(const char* msg)
+{
+    UnityAddMsgIfSpecified(msg);
+    UNITY_FAIL_AND_BAIL;
+}
+
 //-----------------------------------------------
 UNITY_BOOL UnityIgnore(const char* msg, const UNITY_LINE_TYPE line)
 {
@@ -1410,7 +5893,8 @@ UNITY_BOOL UnityIgnore(const char* msg, const UNITY_LINE_TYPE line)
 }
 
 //-----------------------------------------------
-#ifdef UNITY_SUPPORT_WEAK
+// An amalgamated runner defines setUp and tearDown itself when the test does not.
+#if defined(UNITY_SUPPORT_WEAK) && !defined(UNITY_AMALGAMATED)
 UNITY_WEAK_ATTRIBUTE void setUp(void) { }
 UNITY_WEAK_ATTRIBUTE void tearDown(void) { }
 #else
@@ -1441,11 +5925,92 @@ void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int
     UnityConcludeTest();
 }
 
+//-----------------------------------------------
+// Thread Safety
+//-----------------------------------------------
+
+#ifdef UNITY_THREAD_SAFE
+void UnitySetThreadName(const char* name)
+{
+    UnityThreadName = name;
+}
+
+//-----------------------------------------------
+/// Numbers this thread and names it by that number, so its failures read test_Name@index
+void UnitySetThreadIndex(_UU32 index)
+{
+    char digits[10];
+    int count = 0;
+    char* name = UnityThreadNumberName;
+
+    UnityThreadNumber = index;
+    do
+    {
+        digits[count++] = (char)('0' + (index % 10u));
+        index /= 10u;
+    } while (index > 0u);
+    while (count > 0)
+    {
+        *name++ = digits[--count];
+    }
+    *name = '\0';
+    UnityThreadName = UnityThreadNumberName;
+}
+
+//-----------------------------------------------
+_UU32 UnityThreadIndex(void)
+{
+    return UnityThreadNumber;
+}
+
+//-----------------------------------------------
+UNITY_BOOL UnityThreadFailed(void)
+{
+    return (UNITY_BOOL)((UnityThreadFailedTest != 0) && (UnityThreadFailedTest == Unity.NumberOfTests));
+}
+
+//-----------------------------------------------
+void UnityFlushThreadOutput(void)
+{
+    UNITY_OUTPUT_RECORD_T* record;
+    _UU32 dropped;
+    _UU32 i;
+
+    // only the thread that called UnityBegin takes lines off the queue
+    if (!UnityThreadIsMain)
+    {
+        return;
+    }
+    for (;;)
+    {
+        record = &UnityOutputQueue[UnityOutputQueueHead % UNITY_OUTPUT_QUEUE_SIZE];
+        if (UNITY_ATOMIC_LOAD(record->Sequence) != UnityOutputQueueHead + 1)
+        {
+            break;
+        }
+        for (i = 0; i < record->Length; i++)
+        {
+            UNITY_OUTPUT_CHAR(record->Text[i]);
+        }
+        UNITY_ATOMIC_STORE(record->Sequence, UnityOutputQueueHead + UNITY_OUTPUT_QUEUE_SIZE);
+        UnityOutputQueueHead++;
+    }
+    dropped = UNITY_ATOMIC_LOAD(UnityOutputDropped);
+    if (dropped > 0)
+    {
+        UNITY_ATOMIC_ADD(UnityOutputDropped, (_UU32)0 - dropped);
+        UnityPrintNumberUnsigned((_U_UINT)dropped);
+        UnityPrint(UnityStrThreadDropped);
+        UNITY_PRINT_EOL;
+    }
+}
+#endif // defined(UNITY_THREAD_SAFE)
+
 //-----------------------------------------------
 void UnityBegin(const char* filename, unity_void_fn up, unity_void_fn down)
 {
     //Clear the entire Unity structure
-    unsigned char i;
+    unsigned int i;
     char* Buffer = (char*)((void*)(&Unity));
 
     for (i = 0; i < sizeof(Unity); i++) {
@@ -1454,24 +6019,61 @@ void UnityBegin(const char* filename, unity_void_fn up, unity_void_fn down)
     Unity.TestFile = filename;
     Unity.setUp = up;
     Unity.tearDown = down;
+#ifdef UNITY_THREAD_SAFE
+    UnityThreadIsMain = 1;
+    UnityOutputQueueHead = 0;
+    UnityOutputQueueTail = 0;
+    UnityOutputDropped = 0;
+    for (i = 0; i < UNITY_OUTPUT_QUEUE_SIZE; i++)
+    {
+        UnityOutputQueue[i].Sequence = (_UU32)i;
+    }
+#endif
 
     UNITY_OUTPUT_START();
+#ifdef UNITY_OUTPUT_JUNIT
+    UnityJUnitBegin();
+#endif
+#ifdef UNITY_INCLUDE_EXEC_TIME
+    Unity.CurrentTestStartTime = UNITY_CLOCK_MS();
+#ifdef UNITY_INCLUDE_ASSERTION_STATS
+    Unity.StartTime = Unity.CurrentTestStartTime;
+#endif
+#endif
 }
 
 //-----------------------------------------------
 int UnityEnd(void)
 {
+#ifdef UNITY_THREAD_SAFE
+    UnityFlushThreadOutput();
+#endif
     UnityPrint(UnityStrBreaker);
     UNITY_PRINT_EOL;
-    UnityPrintNumber((_U_SINT)(Unity.NumberOfTests));
+    // counters are unsigned and may be wider than an int, so never print them signed
+    UnityPrintNumberUnsigned((_U_UINT)(Unity.NumberOfTests));
     UnityPrint(UnityStrResultsTests);
-    UnityPrintNumber((_U_SINT)(Unity.NumberOfAssertions));
+    UnityPrintNumberUnsigned((_U_UINT)(Unity.NumberOfAssertions));
     UnityPrint(UnityStrResultsAssertions);
-    UnityPrintNumber((_U_SINT)(Unity.TestFailures));
+    UnityPrintNumberUnsigned((_U_UINT)(Unity.TestFailures));
     UnityPrint(UnityStrResultsFailures);
-    UnityPrintNumber((_U_SINT)(Unity.TestIgnores));
+    UnityPrintNumberUnsigned((_U_UINT)(Unity.TestIgnores));
     UnityPrint(UnityStrResultsIgnored);
     UNITY_PRINT_EOL;
+    if (Unity.NumberOfSubtests > 0)
+    {
+        UnityPrintNumberUnsigned((_U_UINT)(Unity.NumberOfSubtests));
+        UnityPrint(UnityStrResultsSubtests);
+        UnityPrintNumberUnsigned((_U_UINT)(Unity.SubtestFailures));
+        UnityPrint(UnityStrResultsSubtestsFailed);
+        UnityPrintNumberUnsigned((_U_UINT)(Unity.SubtestIgnores));
+        UnityPrint(UnityStrResultsIgnored);
+        UNITY_PRINT_EOL;
+    }
+#if defined(UNITY_INCLUDE_ASSERTION_STATS) && defined(UNITY_INCLUDE_EXEC_TIME)
+    UnityPrintAssertionStats(Unity.NumberOfAssertions, UNITY_CLOCK_MS() - Unity.StartTime);
+    UNITY_PRINT_EOL;
+#endif
     if (Unity.TestFailures == 0U)
     {
         UnityPrintOk();
@@ -1481,8 +6083,54 @@ int UnityEnd(void)
         UnityPrintFail();
     }
     UNITY_PRINT_EOL;
+#ifdef UNITY_OUTPUT_JUNIT
+    UnityJUnitEnd();
+#endif
     UNITY_OUTPUT_COMPLETE();
-    return (int)(Unity.TestFailures);
+    // saturate rather than let a huge failure count wrap to zero or go negative
+    return (Unity.TestFailures > 32767u) ? 32767 : (int)(Unity.TestFailures);
+}
+
+//-----------------------------------------------
+// Subtests
+//-----------------------------------------------
+
+/// Opens the scope of one UNITY_SUBTEST.  Subtests do not nest: a second one closes the first.
+/// The test's own result is set aside meanwhile, so the subtest starts clean
+void UnitySubtestBegin(const char* name)
+{
+    if (Unity.CurrentSubtestName != NULL)
+    {
+        UnitySubtestEnd();
+    }
+    Unity.CurrentTestOuterFailed = Unity.CurrentTestFailed;
+    Unity.CurrentTestOuterIgnored = Unity.CurrentTestIgnored;
+    Unity.CurrentTestFailed = 0;
+    Unity.CurrentTestIgnored = 0;
+    Unity.CurrentSubtestName = (name != NULL) ? name : "";
+    Unity.CurrentTestSubtests++;
+    Unity.NumberOfSubtests++;
+}
+
+/// Records the result of the open subtest and puts back the test's own, so the test carries on
+/// after a failure and one from before the subtest still counts
+void UnitySubtestEnd(void)
+{
+    if (Unity.CurrentTestFailed)
+    {
+        Unity.CurrentTestSubtestFailures++;
+        Unity.SubtestFailures++;
+    }
+    else if (Unity.CurrentTestIgnored)
+    {
+        Unity.CurrentTestSubtestIgnores++;
+        Unity.SubtestIgnores++;
+    }
+    Unity.CurrentTestFailed = Unity.CurrentTestOuterFailed;
+    Unity.CurrentTestIgnored = Unity.CurrentTestOuterIgnored;
+    Unity.CurrentTestOuterFailed = 0;
+    Unity.CurrentTestOuterIgnored = 0;
+    Unity.CurrentSubtestName = NULL;
 }
 
 //-----------------------------------------------
@@ -34,18 +34,66 @@ void tearDown(void);
 //     - define UNITY_INCLUDE_FLOAT to allow floating point comparisons
 //     - define UNITY_FLOAT_PRECISION to specify the precision to use when doing TEST_ASSERT_EQUAL_FLOAT
 //     - define UNITY_FLOAT_TYPE to specify doubles instead of single precision floats
-//     - define UNITY_FLOAT_VERBOSE to print floating point values in errors (uses sprintf)
+//     - define UNITY_FLOAT_VERBOSE to print floating point values in errors (shortest digits that read back as the same value; no printf)
 //     - define UNITY_INCLUDE_DOUBLE to allow double floating point comparisons
 //     - define UNITY_DOUBLE_PRECISION to specify the precision to use when doing TEST_ASSERT_EQUAL_DOUBLE
 //     - define UNITY_DOUBLE_TYPE to specify something other than double
-//     - define UNITY_DOUBLE_VERBOSE to print floating point values in errors (uses sprintf)
+//     - define UNITY_DOUBLE_VERBOSE to print floating point values in errors (as above; exact only with UNITY_SUPPORT_64)
+//     - the _WITHIN_ULP assertions allow max_ulps representable values between expected and actual (IEEE 754 only; doubles also need UNITY_SUPPORT_64)
+//     - the _WITHIN_TOLERANCE assertions allow max(abs_tol, rel_tol * |expected|), so values near zero can still be compared
+//     - the array forms of both check every element and report the worst one, its index and how many failed
 
 // Output
 //     - by default, Unity prints to standard out with putchar.  define UNITY_OUTPUT_CHAR(a) with a different function if desired
+//     - define UNITY_OUTPUT_BLOCK(buffer, length) to also take whole formatted numbers in one call (e.g. fwrite(buffer, 1, length, stdout))
+//     - define UNITY_OUTPUT_JUNIT to also write a JUnit XML report while the tests run.  Each <testcase> is written as soon as the test concludes.
+//       - by default the report goes to the file UNITY_JUNIT_FILE ("report.xml").  define UNITY_JUNIT_OUTPUT_CHAR(a), UNITY_JUNIT_OUTPUT_START() and UNITY_JUNIT_OUTPUT_COMPLETE() to send it elsewhere
+//       - define UNITY_JUNIT_MESSAGE_LENGTH to change how much failure text is kept for each test (256 characters by default)
+//     - define UNITY_INCLUDE_EXEC_TIME to measure how long each test takes (wall time from clock_gettime(CLOCK_MONOTONIC) where available, otherwise processor time from clock()).  define UNITY_CLOCK_MS() to return milliseconds from another timer
+//     - define UNITY_INCLUDE_ASSERTION_STATS to print how many assertions each passing test made (and an assertions attribute in the JUnit report).  With UNITY_INCLUDE_EXEC_TIME the time and assertions per second are printed too, per test and for the whole run
+//     - define UNITY_REPORT_ALL_MISMATCHES to have array and memory assertions keep scanning after the first difference and list the differing index ranges and the total count
+//       - define UNITY_MISMATCH_REPORT_LIMIT to change how many ranges are listed (8 by default).  The total always covers the whole buffer
+//     - define UNITY_MEMORY_DIFF to print a hex/ASCII dump of expected and actual around a memory mismatch, with '*' marking the bytes that differ
+//       - define UNITY_MEMORY_DIFF_WINDOW to change how many bytes are shown (16 to 64, 32 by default)
+
+// Arrays In Any Order
+//     - the _ARRAY_UNORDERED assertions pass when both arrays hold the same elements, counting repeats, in any order.  Failures list the missing and extra elements (record indexes for MEMORY), UNITY_UNORDERED_REPORT_LIMIT of each (8 by default)
+//     - by default they take O(n^2) time, comparing elements pairwise with no extra memory.  They sort in O(n log n) instead when given room for two _UU32 indexes per element: define UNITY_SCRATCH_SIZE (bytes) for a static arena, or lend a buffer with UnitySetScratch(buffer, size).  Arrays too large for the room still take the O(n^2) path.  With UNITY_THREAD_SAFE every thread gets its own arena, and a lent buffer is only used by the thread that lent it
+//       - a lent buffer is given back when the test ends, so it may live on the test's stack
+
+// Any Type (C11)
+//     - with a C11 compiler, TEST_ASSERT_EQUAL(expected, actual) picks its assertion from the type of actual with _Generic: integers of any width and signedness (compared by value and printed in their own style, so 64-bit and unsigned values are reported as they are), float and double (as TEST_ASSERT_EQUAL_FLOAT / _DOUBLE, when included), char* strings and other pointers
+//       - TEST_ASSERT_EQUAL_ARRAY(expected, actual, num_elements) does the same from the element type, and goes straight to the loop for that width with no run-time switch on the style.  A float or double array without UNITY_INCLUDE_FLOAT / _DOUBLE is a compile error ("too many arguments to function 'UnityGenericFloatArrayNeedsUNITY_INCLUDE_FLOAT'")
+//       - define UNITY_EXCLUDE_GENERIC to keep the old behaviour (TEST_ASSERT_EQUAL is TEST_ASSERT_EQUAL_INT).  Without C11, TEST_ASSERT_EQUAL_ARRAY fails with a message saying so
+
+// Each Element Of An Array
+//     - TEST_ASSERT_EACH_EQUAL_*, TEST_ASSERT_EACH_*_WITHIN_RANGE and TEST_ASSERT_*_ARRAY_SORTED (non-decreasing) check a whole array as one assertion and report the first element that fails
+//       - elements are checked UNITY_SCAN_BLOCK at a time (64 by default) so the compiler can vectorize the scan
+
+// Digests
+//     - define UNITY_INCLUDE_DIGEST to compare large buffers against a recorded CRC32 or XXH64 (XXH64 also needs UNITY_SUPPORT_64) instead of a full expected copy
+//       - the _BLOCKS variants take one digest per block_size bytes, so a failure names the block that changed.  UnityCrc32() and UnityXxh64() compute the values to record
+
+// Files
+//     - define UNITY_INCLUDE_FILE to compare a buffer or a file against a golden file with TEST_ASSERT_EQUAL_FILE and TEST_ASSERT_FILES_EQUAL
+//       - on Linux the golden file is memory-mapped and compared in place.  define UNITY_FILE_NO_MMAP to read it through stdio instead, UNITY_FILE_BLOCK_SIZE bytes at a time (256 by default)
+//       - run the tests with UNITY_UPDATE_GOLDEN=1 in the environment to rewrite the golden files with the actual contents instead of checking them
 
 // Optimization
-//     - by default, line numbers are stored in unsigned shorts.  Define UNITY_LINE_TYPE with a different type if your files are huge
-//     - by default, test and failure counters are unsigned shorts.  Define UNITY_COUNTER_TYPE with a different type if you want to save space or have more than 65535 Tests.
+//     - by default, line numbers are stored in the widest unsigned int (_U_UINT: 32 bits, or 64 with UNITY_SUPPORT_64).  Define UNITY_LINE_TYPE with a smaller type to save space
+//     - by default, test, assertion and failure counters are also _U_UINT.  Define UNITY_COUNTER_TYPE with a different type if you want to save space, or UNITY_COUNTER_64 for 64-bit counters (needs UNITY_SUPPORT_64) so suites making more than 2^32 assertions do not wrap
+//     - by default, numbers are formatted two digits at a time into a 21 byte stack buffer.  Define UNITY_PRINT_NUMBER_LOW_RAM to print them one digit at a time with no buffer instead.
+
+// Subtests
+//     - UNITY_SUBTEST(name) { ... } runs its block as one subtest of the test.  A failure is reported as test_Name[name] (or test_Name[index] for a NULL name), counted, and the test carries on after the block
+//       - assertions leave the function they are in, so put the checks of a subtest in a function called from its block.  A failed assertion written directly in the block still ends the whole test
+//       - a test with failed subtests fails once, with a count, and the totals show how many subtests ran, failed and were ignored.  A failure before the first subtest still fails the test.  Do not break, goto or return out of the block
+
+// Threads
+//     - define UNITY_THREAD_SAFE to assert from threads a test starts.  The counters become atomic (GCC / Clang __atomic builtins, or your own UNITY_ATOMIC_ADD, _LOAD, _STORE and _CAS) and a failure on any thread fails the current test
+//       - output from other threads is kept a line at a time and printed by the thread that called UnityBegin, at the next result line and when the test ends.  Join your threads before the test returns
+//       - up to UNITY_OUTPUT_QUEUE_SIZE lines (64, a power of two) of UNITY_OUTPUT_RECORD_LENGTH characters (256) can wait at once; further lines are counted as dropped
+//       - UnitySetThreadName(name) labels that thread's failures as test_Name@name, and UnitySetThreadIndex(n) as test_Name@n for TEST_THREAD_INDEX() to return.  UnityThreadFailed() tells a thread whether it failed an assertion in the current test
 
 // Test Cases
 //     - define UNITY_SUPPORT_TEST_CASES to include the TEST_CASE macro, though really it's mostly about the runner generator script
@@ -53,6 +101,40 @@ void tearDown(void);
 // Parameterized Tests
 //     - you'll want to create a define of TEST_CASE(...) which basically evaluates to nothing
 
+// Property-Based Tests
+//     - define UNITY_INCLUDE_PROPERTY to write TEST_PROPERTY(test_Name) { ... } (or TEST_PROPERTY_ITERATIONS(test_Name, n)), a test whose body runs UNITY_PROPERTY_ITERATIONS times on generated input
+//     - inputs come from TEST_GEN_INT, TEST_GEN_UINT, TEST_GEN_BOOL, TEST_GEN_CHOICE, TEST_GEN_BYTES, TEST_GEN_STRING(_OF) and TEST_GEN_FLOAT; build bigger generators by calling these.  TEST_ASSUME(condition) discards a case, and a property that discards every case fails
+//     - a failing case is shrunk to a small counterexample and replayed, printing each generated value and the seed.  Pass that seed to UnitySetPropertySeed (or UNITY_PROPERTY_SEED) to run it first
+//     - setUp and tearDown run once around the whole property, not around each case
+
+// Fuzz Tests
+//     - TEST_FUZZ(test_Name, data, size) { ... } is a test that takes its input as a byte buffer.  The runner generator runs it once per stored input in --fuzz_corpus=dir/test_Name/ (or once on an empty input)
+//     - build the runner with UNITY_FUZZ (and -fsanitize=fuzzer) to get an LLVMFuzzerTestOneInput() instead of main().  It runs UNITY_FUZZ_TARGET (the first TEST_FUZZ by default) and aborts on a failed assertion, so the fuzzer keeps the input as a crash
+//       - copy that input into the corpus directory and regenerate the runner to keep it as a regression test
+
+// Data File Tests
+//     - define UNITY_INCLUDE_DATA_FILE to write TEST_DATA_FILE(test_Name, "vectors.bin") { TEST_DATA_ROW(vector_t, row); ... }, a test whose body runs once per row of a table file
+//       - make the table with auto/csv_to_table.rb, which also writes the matching row struct.  The file is memory-mapped like a golden file (see Files), or read a row at a time through stdio (rows up to UNITY_DATA_ROW_MAX bytes)
+//       - TEST_DATA_ROW must be the first line of the body; it fails the test if the row struct and the table disagree on the row size.  TEST_DATA_ROW_INDEX() is the index of the row being run
+//       - a failing row is reported as test_Name[index] and the next row runs, until UNITY_DATA_FAILURE_LIMIT rows (16 by default) have failed
+
+// Concurrent Tests
+//     - define UNITY_INCLUDE_CONCURRENT (which turns on UNITY_THREAD_SAFE, see Threads) to write TEST_CONCURRENT(test_Name, threads, iterations) { ... }, a test whose body runs iterations times on each of threads pthreads
+//       - the threads wait at a spinning barrier until all of them have started, so they reach the body together.  TEST_THREAD_INDEX() and TEST_ITERATION_INDEX() tell the body where it is
+//       - setUp and tearDown run once around the whole test.  A thread stops at the first failure on any thread; the test then fails with a count of the threads that failed
+//       - a passing test prints the iterations, microseconds and ops/s of each thread.  TEST_CONCURRENT_PINNED pins thread n to core n (modulo the cores online) on Linux
+
+// Interleaved Tests
+//     - define UNITY_INCLUDE_INTERLEAVE (which turns on UNITY_THREAD_SAFE) to write TEST_INTERLEAVED(test_Name, schedules) { ... }, a test whose body runs once per schedule and starts threads with UNITY_SPAWN(function) and UNITY_JOIN()
+//       - only one spawned thread runs at a time.  It hands the turn on at each UNITY_YIELD() in the code under test (which does nothing outside these tests) and when it returns, so a schedule is just the order the turns went in
+//       - TEST_INTERLEAVED picks each turn at random from the schedule's seed; TEST_INTERLEAVED_ALL tries every order in turn, up to UNITY_INTERLEAVE_MAX_SCHEDULES of them, that departs from round robin at most UNITY_INTERLEAVE_MAX_PREEMPTIONS (3) times
+//       - a failing schedule prints the order the threads ran in and (for random schedules) its seed.  Pass that seed to UnitySetInterleaveSeed (or UNITY_INTERLEAVE_SEED) to run it first
+//       - reset the shared state at the top of the body and check it after UNITY_JOIN().  A thread that waits for another must UNITY_YIELD() while it waits; after UNITY_INTERLEAVE_MAX_STEPS turns the schedule fails as stuck
+
+// C++
+//     - include unity.hpp instead (C++11 or later) for TEST_ASSERT_EQ(expected, actual), which picks the comparison and the printing from the argument types at compile time
+//       - integers of any width and signedness, enums, bool, pointers, float and double (within the precisions above), strings of any kind, std::array, std::span and other ranges, and your own types with operator== and a unity::Formatter
+
 //-------------------------------------------------------
 // Test Running Macros
 //-------------------------------------------------------
@@ -68,6 +150,71 @@ void tearDown(void);
 #define TEST_LINE_NUM (Unity.CurrentTestLineNumber)
 #define TEST_IS_IGNORED (Unity.CurrentTestIgnored)
 
+#ifdef UNITY_THREAD_SAFE
+#define TEST_THREAD_INDEX() UnityThreadIndex()
+#endif
+
+//Runs the statement or block after it once, as a subtest
+#define UNITY_SUBTEST(name) for (UnitySubtestBegin(name); Unity.CurrentSubtestName != NULL; UnitySubtestEnd())
+
+//-------------------------------------------------------
+// Property-Based Tests (If Enabled)
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_PROPERTY
+#define TEST_PROPERTY(name)                                                                        TEST_PROPERTY_ITERATIONS(name, UNITY_PROPERTY_ITERATIONS)
+#define TEST_PROPERTY_ITERATIONS(name, iterations)                                                 static void name##_property(void); void name(void) { UnityRunProperty(name##_property, (_UU32)(iterations), __LINE__); } static void name##_property(void)
+#define TEST_ASSUME(condition)                                                                     if (condition) {} else { UnityPropertyReject(); return; }
+#define TEST_GEN_INT(low, high)                                                                    UnityGenInt((_U_SINT)(low), (_U_SINT)(high), __LINE__)
+#define TEST_GEN_UINT(low, high)                                                                   UnityGenUInt((_U_UINT)(low), (_U_UINT)(high), __LINE__)
+#define TEST_GEN_BOOL()                                                                            (UnityGenChoice(2, __LINE__) != 0)
+#define TEST_GEN_CHOICE(count)                                                                     UnityGenChoice((_UU32)(count), __LINE__)
+#define TEST_GEN_BYTES(buffer, min_length, max_length)                                             UnityGenBytes((buffer), (_UU32)(min_length), (_UU32)(max_length), __LINE__)
+#define TEST_GEN_STRING(buffer, size)                                                              UnityGenString((buffer), (_UU32)(size), NULL, __LINE__)
+#define TEST_GEN_STRING_OF(buffer, size, alphabet)                                                 UnityGenString((buffer), (_UU32)(size), (alphabet), __LINE__)
+#define TEST_GEN_FLOAT(low, high)                                                                  UnityGenFloat((_UF)(low), (_UF)(high), __LINE__)
+#endif
+
+//-------------------------------------------------------
+// Data File Tests (If Enabled)
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_DATA_FILE
+#define TEST_DATA_FILE(name, path)                                                                 static void name##_row(void); void name(void) { UnityRunDataFile(name##_row, (path), __LINE__); } static void name##_row(void)
+#define TEST_DATA_ROW(type, row)                                                                   UNITY_PTR_ATTRIBUTE const type* row = (UNITY_PTR_ATTRIBUTE const type*)UnityDataRow((_UU32)sizeof(type), __LINE__); if (row == NULL) return
+#define TEST_DATA_ROW_INDEX()                                                                      UnityDataRowIndex()
+#endif
+
+//-------------------------------------------------------
+// Concurrent Tests (If Enabled)
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_CONCURRENT
+#define TEST_CONCURRENT(name, threads, iterations)                                                 static void name##_concurrent(void); void name(void) { UnityRunConcurrent(name##_concurrent, (_UU32)(threads), (_UU32)(iterations), 0, __LINE__); } static void name##_concurrent(void)
+#define TEST_CONCURRENT_PINNED(name, threads, iterations)                                          static void name##_concurrent(void); void name(void) { UnityRunConcurrent(name##_concurrent, (_UU32)(threads), (_UU32)(iterations), 1, __LINE__); } static void name##_concurrent(void)
+#define TEST_ITERATION_INDEX()                                                                     UnityConcurrentIteration()
+#endif
+
+//-------------------------------------------------------
+// Interleaved Tests (If Enabled)
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_INTERLEAVE
+#define TEST_INTERLEAVED(name, schedules)                                                          static void name##_schedule(void); void name(void) { UnityRunInterleaved(name##_schedule, (_UU32)(schedules), __LINE__); } static void name##_schedule(void)
+#define TEST_INTERLEAVED_ALL(name)                                                                 static void name##_schedule(void); void name(void) { UnityRunInterleaved(name##_schedule, 0, __LINE__); } static void name##_schedule(void)
+#define UNITY_SPAWN(function)                                                                      UnityInterleaveSpawn((function), __LINE__)
+#define UNITY_JOIN()                                                                               UnityInterleaveJoin(__LINE__)
+#define UNITY_YIELD()                                                                              UnityInterleaveYield()
+#else
+#define UNITY_YIELD()
+#endif
+
+//-------------------------------------------------------
+// Fuzz Tests
+//-------------------------------------------------------
+
+#define TEST_FUZZ(name, data, size)                                                                void name(const unsigned char* data, size_t size)
+
 //-------------------------------------------------------
 // Basic Fail and Ignore
 //-------------------------------------------------------
@@ -98,7 +245,7 @@ void tearDown(void);
 #define TEST_ASSERT_EQUAL_INT16(expected, actual)                                                  UNITY_TEST_ASSERT_EQUAL_INT16((expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_INT32(expected, actual)                                                  UNITY_TEST_ASSERT_EQUAL_INT32((expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_INT64(expected, actual)                                                  UNITY_TEST_ASSERT_EQUAL_INT64((expected), (actual), __LINE__, NULL)
-#define TEST_ASSERT_EQUAL(expected, actual)                                                        UNITY_TEST_ASSERT_EQUAL_INT((expected), (actual), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL(expected, actual)                                                        UNITY_TEST_ASSERT_EQUAL((expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_NOT_EQUAL(expected, actual)                                                    UNITY_TEST_ASSERT(((expected) !=  (actual)), __LINE__, " Expected Not-Equal")
 #define TEST_ASSERT_EQUAL_UINT(expected, actual)                                                   UNITY_TEST_ASSERT_EQUAL_UINT( (expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_UINT8(expected, actual)                                                  UNITY_TEST_ASSERT_EQUAL_UINT8( (expected), (actual), __LINE__, NULL)
@@ -233,6 +380,82 @@ void tearDown(void);
 #define TEST_ASSERT_EQUAL_PTR_ARRAY(expected, actual, num_elements)                                UNITY_TEST_ASSERT_EQUAL_PTR_ARRAY((expected), (actual), (num_elements), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_STRING_ARRAY(expected, actual, num_elements)                             UNITY_TEST_ASSERT_EQUAL_STRING_ARRAY((expected), (actual), (num_elements), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_MEMORY_ARRAY(expected, actual, len, num_elements)                        UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((expected), (actual), (len), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_ARRAY(expected, actual, num_elements)                                    UNITY_TEST_ASSERT_EQUAL_ARRAY((expected), (actual), (num_elements), __LINE__, NULL)
+
+//Arrays In Any Order
+#define TEST_ASSERT_EQUAL_INT_ARRAY_UNORDERED(expected, actual, num_elements)                      UNITY_TEST_ASSERT_EQUAL_INT_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_INT8_ARRAY_UNORDERED(expected, actual, num_elements)                     UNITY_TEST_ASSERT_EQUAL_INT8_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_INT16_ARRAY_UNORDERED(expected, actual, num_elements)                    UNITY_TEST_ASSERT_EQUAL_INT16_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_INT32_ARRAY_UNORDERED(expected, actual, num_elements)                    UNITY_TEST_ASSERT_EQUAL_INT32_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_INT64_ARRAY_UNORDERED(expected, actual, num_elements)                    UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT_ARRAY_UNORDERED(expected, actual, num_elements)                     UNITY_TEST_ASSERT_EQUAL_UINT_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT8_ARRAY_UNORDERED(expected, actual, num_elements)                    UNITY_TEST_ASSERT_EQUAL_UINT8_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT16_ARRAY_UNORDERED(expected, actual, num_elements)                   UNITY_TEST_ASSERT_EQUAL_UINT16_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT32_ARRAY_UNORDERED(expected, actual, num_elements)                   UNITY_TEST_ASSERT_EQUAL_UINT32_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT64_ARRAY_UNORDERED(expected, actual, num_elements)                   UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HEX_ARRAY_UNORDERED(expected, actual, num_elements)                      UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HEX8_ARRAY_UNORDERED(expected, actual, num_elements)                     UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HEX16_ARRAY_UNORDERED(expected, actual, num_elements)                    UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HEX32_ARRAY_UNORDERED(expected, actual, num_elements)                    UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HEX64_ARRAY_UNORDERED(expected, actual, num_elements)                    UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_MEMORY_ARRAY_UNORDERED(expected, actual, len, num_elements)              UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY_UNORDERED((expected), (actual), (len), (num_elements), __LINE__, NULL)
+
+//Each Element Of An Array
+#define TEST_ASSERT_EACH_EQUAL_INT(expected, actual, num_elements)                                 UNITY_TEST_ASSERT_EACH_EQUAL_INT((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_INT8(expected, actual, num_elements)                                UNITY_TEST_ASSERT_EACH_EQUAL_INT8((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_INT16(expected, actual, num_elements)                               UNITY_TEST_ASSERT_EACH_EQUAL_INT16((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_INT32(expected, actual, num_elements)                               UNITY_TEST_ASSERT_EACH_EQUAL_INT32((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_INT64(expected, actual, num_elements)                               UNITY_TEST_ASSERT_EACH_EQUAL_INT64((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_UINT(expected, actual, num_elements)                                UNITY_TEST_ASSERT_EACH_EQUAL_UINT((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_UINT8(expected, actual, num_elements)                               UNITY_TEST_ASSERT_EACH_EQUAL_UINT8((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_UINT16(expected, actual, num_elements)                              UNITY_TEST_ASSERT_EACH_EQUAL_UINT16((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_UINT32(expected, actual, num_elements)                              UNITY_TEST_ASSERT_EACH_EQUAL_UINT32((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_UINT64(expected, actual, num_elements)                              UNITY_TEST_ASSERT_EACH_EQUAL_UINT64((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_HEX(expected, actual, num_elements)                                 UNITY_TEST_ASSERT_EACH_EQUAL_HEX32((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_HEX8(expected, actual, num_elements)                                UNITY_TEST_ASSERT_EACH_EQUAL_HEX8((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_HEX16(expected, actual, num_elements)                               UNITY_TEST_ASSERT_EACH_EQUAL_HEX16((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_HEX32(expected, actual, num_elements)                               UNITY_TEST_ASSERT_EACH_EQUAL_HEX32((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_EQUAL_HEX64(expected, actual, num_elements)                               UNITY_TEST_ASSERT_EACH_EQUAL_HEX64((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_INT_WITHIN_RANGE(low, high, actual, num_elements)                         UNITY_TEST_ASSERT_EACH_INT_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_INT8_WITHIN_RANGE(low, high, actual, num_elements)                        UNITY_TEST_ASSERT_EACH_INT8_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_INT16_WITHIN_RANGE(low, high, actual, num_elements)                       UNITY_TEST_ASSERT_EACH_INT16_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_INT32_WITHIN_RANGE(low, high, actual, num_elements)                       UNITY_TEST_ASSERT_EACH_INT32_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_INT64_WITHIN_RANGE(low, high, actual, num_elements)                       UNITY_TEST_ASSERT_EACH_INT64_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_UINT_WITHIN_RANGE(low, high, actual, num_elements)                        UNITY_TEST_ASSERT_EACH_UINT_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_UINT8_WITHIN_RANGE(low, high, actual, num_elements)                       UNITY_TEST_ASSERT_EACH_UINT8_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_UINT16_WITHIN_RANGE(low, high, actual, num_elements)                      UNITY_TEST_ASSERT_EACH_UINT16_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_UINT32_WITHIN_RANGE(low, high, actual, num_elements)                      UNITY_TEST_ASSERT_EACH_UINT32_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_UINT64_WITHIN_RANGE(low, high, actual, num_elements)                      UNITY_TEST_ASSERT_EACH_UINT64_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_HEX_WITHIN_RANGE(low, high, actual, num_elements)                         UNITY_TEST_ASSERT_EACH_HEX32_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_HEX8_WITHIN_RANGE(low, high, actual, num_elements)                        UNITY_TEST_ASSERT_EACH_HEX8_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_HEX16_WITHIN_RANGE(low, high, actual, num_elements)                       UNITY_TEST_ASSERT_EACH_HEX16_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_HEX32_WITHIN_RANGE(low, high, actual, num_elements)                       UNITY_TEST_ASSERT_EACH_HEX32_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EACH_HEX64_WITHIN_RANGE(low, high, actual, num_elements)                       UNITY_TEST_ASSERT_EACH_HEX64_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT_ARRAY_SORTED(actual, num_elements)                                         UNITY_TEST_ASSERT_INT_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT8_ARRAY_SORTED(actual, num_elements)                                        UNITY_TEST_ASSERT_INT8_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT16_ARRAY_SORTED(actual, num_elements)                                       UNITY_TEST_ASSERT_INT16_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT32_ARRAY_SORTED(actual, num_elements)                                       UNITY_TEST_ASSERT_INT32_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT64_ARRAY_SORTED(actual, num_elements)                                       UNITY_TEST_ASSERT_INT64_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT_ARRAY_SORTED(actual, num_elements)                                        UNITY_TEST_ASSERT_UINT_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT8_ARRAY_SORTED(actual, num_elements)                                       UNITY_TEST_ASSERT_UINT8_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT16_ARRAY_SORTED(actual, num_elements)                                      UNITY_TEST_ASSERT_UINT16_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT32_ARRAY_SORTED(actual, num_elements)                                      UNITY_TEST_ASSERT_UINT32_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT64_ARRAY_SORTED(actual, num_elements)                                      UNITY_TEST_ASSERT_UINT64_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX_ARRAY_SORTED(actual, num_elements)                                         UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX8_ARRAY_SORTED(actual, num_elements)                                        UNITY_TEST_ASSERT_HEX8_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX16_ARRAY_SORTED(actual, num_elements)                                       UNITY_TEST_ASSERT_HEX16_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX32_ARRAY_SORTED(actual, num_elements)                                       UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX64_ARRAY_SORTED(actual, num_elements)                                       UNITY_TEST_ASSERT_HEX64_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+
+//Digests (If Enabled)
+#define TEST_ASSERT_MEMORY_CRC32(expected, actual, len)                                            UNITY_TEST_ASSERT_MEMORY_CRC32((expected), (actual), (len), __LINE__, NULL)
+#define TEST_ASSERT_MEMORY_CRC32_BLOCKS(expected_digests, actual, len, block_size)                 UNITY_TEST_ASSERT_MEMORY_CRC32_BLOCKS((expected_digests), (actual), (len), (block_size), __LINE__, NULL)
+#define TEST_ASSERT_MEMORY_XXH64(expected, actual, len)                                            UNITY_TEST_ASSERT_MEMORY_XXH64((expected), (actual), (len), __LINE__, NULL)
+#define TEST_ASSERT_MEMORY_XXH64_BLOCKS(expected_digests, actual, len, block_size)                 UNITY_TEST_ASSERT_MEMORY_XXH64_BLOCKS((expected_digests), (actual), (len), (block_size), __LINE__, NULL)
+
+//Files (If Enabled)
+#define TEST_ASSERT_EQUAL_FILE(path, actual, len)                                                  UNITY_TEST_ASSERT_EQUAL_FILE((path), (actual), (len), __LINE__, NULL)
+#define TEST_ASSERT_FILES_EQUAL(expected_path, actual_path)                                        UNITY_TEST_ASSERT_FILES_EQUAL((expected_path), (actual_path), __LINE__, NULL)
 
 //Floating Point (If Enabled)
 #define TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual)                                          UNITY_TEST_ASSERT_FLOAT_WITHIN((delta), (expected), (actual), __LINE__, NULL)
@@ -246,6 +469,10 @@ void tearDown(void);
 #define TEST_ASSERT_FLOAT_IS_NOT_NEG_INF(actual)                                                   UNITY_TEST_ASSERT_FLOAT_IS_NOT_NEG_INF((actual), __LINE__, NULL)
 #define TEST_ASSERT_FLOAT_IS_NOT_NAN(actual)                                                       UNITY_TEST_ASSERT_FLOAT_IS_NOT_NAN((actual), __LINE__, NULL)
 #define TEST_ASSERT_FLOAT_IS_NOT_DETERMINATE(actual)                                               UNITY_TEST_ASSERT_FLOAT_IS_NOT_DETERMINATE((actual), __LINE__, NULL)
+#define TEST_ASSERT_FLOAT_WITHIN_ULP(max_ulps, expected, actual)                                   UNITY_TEST_ASSERT_FLOAT_WITHIN_ULP((max_ulps), (expected), (actual), __LINE__, NULL)
+#define TEST_ASSERT_FLOAT_ARRAY_WITHIN_ULP(max_ulps, expected, actual, num_elements)               UNITY_TEST_ASSERT_FLOAT_ARRAY_WITHIN_ULP((max_ulps), (expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_FLOAT_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual)                     UNITY_TEST_ASSERT_FLOAT_WITHIN_TOLERANCE((abs_tol), (rel_tol), (expected), (actual), __LINE__, NULL)
+#define TEST_ASSERT_FLOAT_ARRAY_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, num_elements) UNITY_TEST_ASSERT_FLOAT_ARRAY_WITHIN_TOLERANCE((abs_tol), (rel_tol), (expected), (actual), (num_elements), __LINE__, NULL)
 
 //Double (If Enabled)
 #define TEST_ASSERT_DOUBLE_WITHIN(delta, expected, actual)                                         UNITY_TEST_ASSERT_DOUBLE_WITHIN((delta), (expected), (actual), __LINE__, NULL)
@@ -259,6 +486,10 @@ void tearDown(void);
 #define TEST_ASSERT_DOUBLE_IS_NOT_NEG_INF(actual)                                                  UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NEG_INF((actual), __LINE__, NULL)
 #define TEST_ASSERT_DOUBLE_IS_NOT_NAN(actual)                                                      UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NAN((actual), __LINE__, NULL)
 #define TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE(actual)                                              UNITY_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE((actual), __LINE__, NULL)
+#define TEST_ASSERT_DOUBLE_WITHIN_ULP(max_ulps, expected, actual)                                  UNITY_TEST_ASSERT_DOUBLE_WITHIN_ULP((max_ulps), (expected), (actual), __LINE__, NULL)
+#define TEST_ASSERT_DOUBLE_ARRAY_WITHIN_ULP(max_ulps, expected, actual, num_elements)              UNITY_TEST_ASSERT_DOUBLE_ARRAY_WITHIN_ULP((max_ulps), (expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual)                    UNITY_TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE((abs_tol), (rel_tol), (expected), (actual), __LINE__, NULL)
+#define TEST_ASSERT_DOUBLE_ARRAY_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, num_elements) UNITY_TEST_ASSERT_DOUBLE_ARRAY_WITHIN_TOLERANCE((abs_tol), (rel_tol), (expected), (actual), (num_elements), __LINE__, NULL)
 
 //-------------------------------------------------------
 // Test Asserts (with additional messages)
@@ -280,7 +511,7 @@ void tearDown(void);
 #define TEST_ASSERT_EQUAL_INT16_MESSAGE(expected, actual, message)                                 UNITY_TEST_ASSERT_EQUAL_INT16((expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_INT32_MESSAGE(expected, actual, message)                                 UNITY_TEST_ASSERT_EQUAL_INT32((expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_INT64_MESSAGE(expected, actual, message)                                 UNITY_TEST_ASSERT_EQUAL_INT64((expected), (actual), __LINE__, (message))
-#define TEST_ASSERT_EQUAL_MESSAGE(expected, actual, message)                                       UNITY_TEST_ASSERT_EQUAL_INT((expected), (actual), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_MESSAGE(expected, actual, message)                                       UNITY_TEST_ASSERT_EQUAL((expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_NOT_EQUAL_MESSAGE(expected, actual, message)                                   UNITY_TEST_ASSERT(((expected) !=  (actual)), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_UINT_MESSAGE(expected, actual, message)                                  UNITY_TEST_ASSERT_EQUAL_UINT( (expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected, actual, message)                                 UNITY_TEST_ASSERT_EQUAL_UINT8( (expected), (actual), __LINE__, (message))
@@ -390,6 +621,82 @@ void tearDown(void);
 #define TEST_ASSERT_EQUAL_PTR_ARRAY_MESSAGE(expected, actual, num_elements, message)               UNITY_TEST_ASSERT_EQUAL_PTR_ARRAY((expected), (actual), (num_elements), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_STRING_ARRAY_MESSAGE(expected, actual, num_elements, message)            UNITY_TEST_ASSERT_EQUAL_STRING_ARRAY((expected), (actual), (num_elements), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_MEMORY_ARRAY_MESSAGE(expected, actual, len, num_elements, message)       UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((expected), (actual), (len), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_ARRAY_MESSAGE(expected, actual, num_elements, message)                   UNITY_TEST_ASSERT_EQUAL_ARRAY((expected), (actual), (num_elements), __LINE__, (message))
+
+//Arrays In Any Order
+#define TEST_ASSERT_EQUAL_INT_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)     UNITY_TEST_ASSERT_EQUAL_INT_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_INT8_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)    UNITY_TEST_ASSERT_EQUAL_INT8_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_INT16_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)   UNITY_TEST_ASSERT_EQUAL_INT16_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_INT32_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)   UNITY_TEST_ASSERT_EQUAL_INT32_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_INT64_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)   UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)    UNITY_TEST_ASSERT_EQUAL_UINT_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT8_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)   UNITY_TEST_ASSERT_EQUAL_UINT8_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT16_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)  UNITY_TEST_ASSERT_EQUAL_UINT16_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT32_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)  UNITY_TEST_ASSERT_EQUAL_UINT32_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT64_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)  UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HEX_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)     UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HEX8_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)    UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HEX16_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)   UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HEX32_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)   UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HEX64_ARRAY_UNORDERED_MESSAGE(expected, actual, num_elements, message)   UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY_UNORDERED((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_MEMORY_ARRAY_UNORDERED_MESSAGE(expected, actual, len, num_elements, message) UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY_UNORDERED((expected), (actual), (len), (num_elements), __LINE__, (message))
+
+//Each Element Of An Array
+#define TEST_ASSERT_EACH_EQUAL_INT_MESSAGE(expected, actual, num_elements, message)                UNITY_TEST_ASSERT_EACH_EQUAL_INT((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_INT8_MESSAGE(expected, actual, num_elements, message)               UNITY_TEST_ASSERT_EACH_EQUAL_INT8((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_INT16_MESSAGE(expected, actual, num_elements, message)              UNITY_TEST_ASSERT_EACH_EQUAL_INT16((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_INT32_MESSAGE(expected, actual, num_elements, message)              UNITY_TEST_ASSERT_EACH_EQUAL_INT32((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_INT64_MESSAGE(expected, actual, num_elements, message)              UNITY_TEST_ASSERT_EACH_EQUAL_INT64((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_UINT_MESSAGE(expected, actual, num_elements, message)               UNITY_TEST_ASSERT_EACH_EQUAL_UINT((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(expected, actual, num_elements, message)              UNITY_TEST_ASSERT_EACH_EQUAL_UINT8((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_UINT16_MESSAGE(expected, actual, num_elements, message)             UNITY_TEST_ASSERT_EACH_EQUAL_UINT16((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_UINT32_MESSAGE(expected, actual, num_elements, message)             UNITY_TEST_ASSERT_EACH_EQUAL_UINT32((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_UINT64_MESSAGE(expected, actual, num_elements, message)             UNITY_TEST_ASSERT_EACH_EQUAL_UINT64((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_HEX_MESSAGE(expected, actual, num_elements, message)                UNITY_TEST_ASSERT_EACH_EQUAL_HEX32((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_HEX8_MESSAGE(expected, actual, num_elements, message)               UNITY_TEST_ASSERT_EACH_EQUAL_HEX8((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_HEX16_MESSAGE(expected, actual, num_elements, message)              UNITY_TEST_ASSERT_EACH_EQUAL_HEX16((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_HEX32_MESSAGE(expected, actual, num_elements, message)              UNITY_TEST_ASSERT_EACH_EQUAL_HEX32((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_EQUAL_HEX64_MESSAGE(expected, actual, num_elements, message)              UNITY_TEST_ASSERT_EACH_EQUAL_HEX64((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_INT_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)        UNITY_TEST_ASSERT_EACH_INT_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_INT8_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)       UNITY_TEST_ASSERT_EACH_INT8_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_INT16_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)      UNITY_TEST_ASSERT_EACH_INT16_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_INT32_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)      UNITY_TEST_ASSERT_EACH_INT32_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_INT64_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)      UNITY_TEST_ASSERT_EACH_INT64_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_UINT_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)       UNITY_TEST_ASSERT_EACH_UINT_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_UINT8_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)      UNITY_TEST_ASSERT_EACH_UINT8_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_UINT16_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)     UNITY_TEST_ASSERT_EACH_UINT16_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_UINT32_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)     UNITY_TEST_ASSERT_EACH_UINT32_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_UINT64_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)     UNITY_TEST_ASSERT_EACH_UINT64_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_HEX_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)        UNITY_TEST_ASSERT_EACH_HEX32_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_HEX8_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)       UNITY_TEST_ASSERT_EACH_HEX8_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_HEX16_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)      UNITY_TEST_ASSERT_EACH_HEX16_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_HEX32_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)      UNITY_TEST_ASSERT_EACH_HEX32_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EACH_HEX64_WITHIN_RANGE_MESSAGE(low, high, actual, num_elements, message)      UNITY_TEST_ASSERT_EACH_HEX64_WITHIN_RANGE((low), (high), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                        UNITY_TEST_ASSERT_INT_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT8_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                       UNITY_TEST_ASSERT_INT8_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT16_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                      UNITY_TEST_ASSERT_INT16_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT32_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                      UNITY_TEST_ASSERT_INT32_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT64_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                      UNITY_TEST_ASSERT_INT64_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                       UNITY_TEST_ASSERT_UINT_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT8_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                      UNITY_TEST_ASSERT_UINT8_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT16_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                     UNITY_TEST_ASSERT_UINT16_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT32_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                     UNITY_TEST_ASSERT_UINT32_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT64_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                     UNITY_TEST_ASSERT_UINT64_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                        UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX8_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                       UNITY_TEST_ASSERT_HEX8_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX16_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                      UNITY_TEST_ASSERT_HEX16_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX32_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                      UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX64_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                      UNITY_TEST_ASSERT_HEX64_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+
+//Digests (If Enabled)
+#define TEST_ASSERT_MEMORY_CRC32_MESSAGE(expected, actual, len, message)                           UNITY_TEST_ASSERT_MEMORY_CRC32((expected), (actual), (len), __LINE__, (message))
+#define TEST_ASSERT_MEMORY_CRC32_BLOCKS_MESSAGE(expected_digests, actual, len, block_size, message) UNITY_TEST_ASSERT_MEMORY_CRC32_BLOCKS((expected_digests), (actual), (len), (block_size), __LINE__, (message))
+#define TEST_ASSERT_MEMORY_XXH64_MESSAGE(expected, actual, len, message)                           UNITY_TEST_ASSERT_MEMORY_XXH64((expected), (actual), (len), __LINE__, (message))
+#define TEST_ASSERT_MEMORY_XXH64_BLOCKS_MESSAGE(expected_digests, actual, len, block_size, message) UNITY_TEST_ASSERT_MEMORY_XXH64_BLOCKS((expected_digests), (actual), (len), (block_size), __LINE__, (message))
+
+//Files (If Enabled)
+#define TEST_ASSERT_EQUAL_FILE_MESSAGE(path, actual, len, message)                                 UNITY_TEST_ASSERT_EQUAL_FILE((path), (actual), (len), __LINE__, (message))
+#define TEST_ASSERT_FILES_EQUAL_MESSAGE(expected_path, actual_path, message)                       UNITY_TEST_ASSERT_FILES_EQUAL((expected_path), (actual_path), __LINE__, (message))
 
 //Floating Point (If Enabled)
 #define TEST_ASSERT_FLOAT_WITHIN_MESSAGE(delta, expected, actual, message)                         UNITY_TEST_ASSERT_FLOAT_WITHIN((delta), (expected), (actual), __LINE__, (message))
@@ -403,6 +710,10 @@ void tearDown(void);
 #define TEST_ASSERT_FLOAT_IS_NOT_NEG_INF_MESSAGE(actual, message)                                  UNITY_TEST_ASSERT_FLOAT_IS_NOT_NEG_INF((actual), __LINE__, (message))
 #define TEST_ASSERT_FLOAT_IS_NOT_NAN_MESSAGE(actual, message)                                      UNITY_TEST_ASSERT_FLOAT_IS_NOT_NAN((actual), __LINE__, (message))
 #define TEST_ASSERT_FLOAT_IS_NOT_DETERMINATE_MESSAGE(actual, message)                              UNITY_TEST_ASSERT_FLOAT_IS_NOT_DETERMINATE((actual), __LINE__, (message))
+#define TEST_ASSERT_FLOAT_WITHIN_ULP_MESSAGE(max_ulps, expected, actual, message)                  UNITY_TEST_ASSERT_FLOAT_WITHIN_ULP((max_ulps), (expected), (actual), __LINE__, (message))
+#define TEST_ASSERT_FLOAT_ARRAY_WITHIN_ULP_MESSAGE(max_ulps, expected, actual, num_elements, message) UNITY_TEST_ASSERT_FLOAT_ARRAY_WITHIN_ULP((max_ulps), (expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_FLOAT_WITHIN_TOLERANCE_MESSAGE(abs_tol, rel_tol, expected, actual, message)    UNITY_TEST_ASSERT_FLOAT_WITHIN_TOLERANCE((abs_tol), (rel_tol), (expected), (actual), __LINE__, (message))
+#define TEST_ASSERT_FLOAT_ARRAY_WITHIN_TOLERANCE_MESSAGE(abs_tol, rel_tol, expected, actual, num_elements, message) UNITY_TEST_ASSERT_FLOAT_ARRAY_WITHIN_TOLERANCE((abs_tol), (rel_tol), (expected), (actual), (num_elements), __LINE__, (message))
 
 //Double (If Enabled)
 #define TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(delta, expected, actual, message)                        UNITY_TEST_ASSERT_DOUBLE_WITHIN((delta), (expected), (actual), __LINE__, (message))
@@ -416,6 +727,10 @@ void tearDown(void);
 #define TEST_ASSERT_DOUBLE_IS_NOT_NEG_INF_MESSAGE(actual, message)                                 UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NEG_INF((actual), __LINE__, (message))
 #define TEST_ASSERT_DOUBLE_IS_NOT_NAN_MESSAGE(actual, message)                                     UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NAN((actual), __LINE__, (message))
 #define TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE_MESSAGE(actual, message)                             UNITY_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE((actual), __LINE__, (message))
+#define TEST_ASSERT_DOUBLE_WITHIN_ULP_MESSAGE(max_ulps, expected, actual, message)                 UNITY_TEST_ASSERT_DOUBLE_WITHIN_ULP((max_ulps), (expected), (actual), __LINE__, (message))
+#define TEST_ASSERT_DOUBLE_ARRAY_WITHIN_ULP_MESSAGE(max_ulps, expected, actual, num_elements, message) UNITY_TEST_ASSERT_DOUBLE_ARRAY_WITHIN_ULP((max_ulps), (expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE_MESSAGE(abs_tol, rel_tol, expected, actual, message)   UNITY_TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE((abs_tol), (rel_tol), (expected), (actual), __LINE__, (message))
+#define TEST_ASSERT_DOUBLE_ARRAY_WITHIN_TOLERANCE_MESSAGE(abs_tol, rel_tol, expected, actual, num_elements, message) UNITY_TEST_ASSERT_DOUBLE_ARRAY_WITHIN_TOLERANCE((abs_tol), (rel_tol), (expected), (actual), (num_elements), __LINE__, (message))
 
 //end of UNITY_FRAMEWORK_H
 #ifdef __cplusplus
@@ -0,0 +1,396 @@
+/* ==========================================
+    Unity Project - A Test Framework for C
+    Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+    [Released under MIT License. Please refer to license.txt for details]
+========================================== */
+
+#ifndef UNITY_FRAMEWORK_HPP
+#define UNITY_FRAMEWORK_HPP
+
+#include "unity.h"
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+//-------------------------------------------------------
+// C++ Front-End
+//-------------------------------------------------------
+// Include this instead of unity.h from C++ (C++11 or later) tests.
+//
+// TEST_ASSERT_EQ(expected, actual) works out how to compare and print its arguments from
+// their types at compile time, so there is no _INT8/_UINT16/... to pick and nothing is
+// narrowed into _U_SINT on the way.  A passing assertion is an inlined comparison.
+//     - integers of any width and signedness (compared by value: -1 never equals 0xFFFFFFFF), bool, enums and pointers
+//     - float and double, equal within UNITY_FLOAT_PRECISION / UNITY_DOUBLE_PRECISION like TEST_ASSERT_EQUAL_FLOAT
+//     - strings: const char*, char arrays, std::string and std::string_view, in any mix
+//     - ranges with begin() and end(): std::array, std::span, std::vector, C arrays, ... compared element by element
+//     - your own types with an operator== and a unity::Formatter specialization to print them:
+//
+//         template <> struct unity::Formatter<Point>
+//         {
+//             static void Print(const Point& p) { UnityPrintNumber(p.x); UnityPrint(","); UnityPrintNumber(p.y); }
+//         };
+
+namespace unity
+{
+
+//-------------------------------------------------------
+// Type Classification
+//-------------------------------------------------------
+
+/// Strings are compared and printed as a pointer and a length, so none has to end in '\0'
+struct String
+{
+    const char* Data;
+    size_t Length;
+};
+
+template <typename T> struct IsString : std::false_type {};
+template <> struct IsString<const char*> : std::true_type {};
+template <> struct IsString<char*> : std::true_type {};
+template <size_t N> struct IsString<char[N]> : std::true_type {};
+template <size_t N> struct IsString<const char[N]> : std::true_type {};
+template <> struct IsString<std::string> : std::true_type {};
+#if __cplusplus >= 201703L
+template <> struct IsString<std::string_view> : std::true_type {};
+#endif
+
+inline String ToString(const char* value) { return String{value, (value == nullptr) ? 0 : std::strlen(value)}; }
+inline String ToString(const std::string& value) { return String{value.data(), value.size()}; }
+#if __cplusplus >= 201703L
+inline String ToString(std::string_view value) { return String{value.data(), value.size()}; }
+#endif
+
+/// Anything std::begin and std::end accept, apart from strings
+template <typename T, typename Enable = void>
+struct IsRange : std::false_type {};
+
+template <typename T>
+struct IsRange<T, decltype((void)std::begin(std::declval<const T&>()), (void)std::end(std::declval<const T&>()))>
+    : std::integral_constant<bool, !IsString<T>::value> {};
+
+//-------------------------------------------------------
+// Formatters
+//-------------------------------------------------------
+
+/// Prints a value in a failure message.  Specialize it for your own types
+template <typename T, typename Enable = void>
+struct Formatter
+{
+    static void Print(const T&)
+    {
+        static_assert(sizeof(T) == 0, "TEST_ASSERT_EQ cannot print this type: specialize unity::Formatter<T> with a static void Print(const T&)");
+    }
+};
+
+template <typename T>
+inline void Print(const T& value)
+{
+    Formatter<T>::Print(value);
+}
+
+template <>
+struct Formatter<bool>
+{
+    static void Print(const bool& value) { UnityPrint(value ? "TRUE" : "FALSE"); }
+};
+
+template <typename T>
+struct Formatter<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
+{
+#ifndef UNITY_SUPPORT_64
+    static_assert(sizeof(T) <= sizeof(_U_UINT), "64-bit integers need UNITY_SUPPORT_64");
+#endif
+    static void Print(const T& value) { PrintBy(value, std::is_signed<T>()); }
+    static void PrintBy(const T& value, std::true_type) { UnityPrintNumber((_U_SINT)value); }
+    static void PrintBy(const T& value, std::false_type) { UnityPrintNumberUnsigned((_U_UINT)value); }
+};
+
+template <typename T>
+struct Formatter<T, typename std::enable_if<std::is_enum<T>::value>::type>
+{
+    static void Print(const T& value) { unity::Print(static_cast<typename std::underlying_type<T>::type>(value)); }
+};
+
+/// Floats print in full when the matching UNITY_*_VERBOSE is defined, and as their raw bits otherwise
+template <typename T>
+struct Formatter<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "TEST_ASSERT_EQ prints float and double only");
+
+    static void Print(const T& value)
+    {
+#ifdef UNITY_FLOAT_VERBOSE
+        if (sizeof(T) == sizeof(_UF)) { UnityPrintFloat((_UF)value); return; }
+#endif
+#ifdef UNITY_DOUBLE_VERBOSE
+        if (sizeof(T) == sizeof(_UD)) { UnityPrintDouble((_UD)value); return; }
+#endif
+        PrintBits(value);
+    }
+    static void PrintBits(const T& value)
+    {
+        typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type bits;
+
+        std::memcpy(&bits, &value, sizeof(T));
+#ifdef UNITY_SUPPORT_64
+        UnityPrintNumberHex((_U_UINT)bits, (char)(sizeof(T) * 2));
+#else
+        if (sizeof(T) > 4)
+        {
+            // a 64-bit pattern printed as its high and low words
+            UnityPrintNumberHex((_U_UINT)(bits >> 16 >> 16), 8);
+            UnityPrint(":");
+        }
+        UnityPrintNumberHex((_U_UINT)(bits & 0xFFFFFFFFu), 8);
+#endif
+    }
+};
+
+template <>
+struct Formatter<std::nullptr_t>
+{
+    static void Print(const std::nullptr_t&) { UnityPrint(UnityStrNull); }
+};
+
+template <typename T>
+struct Formatter<T, typename std::enable_if<std::is_pointer<T>::value && !IsString<T>::value>::type>
+{
+    static void Print(const T& value)
+    {
+        if (value == nullptr)
+            UnityPrint(UnityStrNull);
+        else
+            UnityPrintNumberHex((_U_UINT)(_UP)value, (char)(sizeof(_UP) * 2));
+    }
+};
+
+template <>
+struct Formatter<String>
+{
+    static void Print(const String& value)
+    {
+        if (value.Data == nullptr)
+        {
+            UnityPrint(UnityStrNull);
+            return;
+        }
+        UnityPrint("'");
+        UnityPrintLen(value.Data, (_UU32)value.Length);
+        UnityPrint("'");
+    }
+};
+
+template <typename T>
+struct Formatter<T, typename std::enable_if<IsString<T>::value>::type>
+{
+    static void Print(const T& value) { unity::Print(ToString(value)); }
+};
+
+template <typename T>
+struct Formatter<T, typename std::enable_if<IsRange<T>::value>::type>
+{
+    static void Print(const T& value)
+    {
+        size_t count = 0;
+        UnityPrint("{");
+        for (auto it = std::begin(value); it != std::end(value); ++it, ++count)
+        {
+            if (count == 8)
+            {
+                UnityPrint(", ...");
+                break;
+            }
+            if (count > 0)
+                UnityPrint(", ");
+            unity::Print(*it);
+        }
+        UnityPrint("}");
+    }
+};
+
+//-------------------------------------------------------
+// Comparisons
+//-------------------------------------------------------
+
+enum class Kind { Integer, Floating, String, Range, Other };
+
+template <typename T>
+struct KindOf : std::integral_constant<Kind,
+    IsString<T>::value ? Kind::String :
+    IsRange<T>::value ? Kind::Range :
+    (std::is_integral<T>::value || std::is_enum<T>::value) ? Kind::Integer :
+    std::is_floating_point<T>::value ? Kind::Floating : Kind::Other> {};
+
+template <Kind K> using KindTag = std::integral_constant<Kind, K>;
+
+/// The relative tolerance TEST_ASSERT_EQUAL_FLOAT and _DOUBLE use
+template <typename F>
+struct Precision
+{
+    static_assert(sizeof(F) == 0, "TEST_ASSERT_EQ on float needs UNITY_INCLUDE_FLOAT, and on double UNITY_INCLUDE_DOUBLE");
+    static F Value() { return F(0); }
+};
+#ifdef UNITY_FLOAT_PRECISION
+template <> struct Precision<float> { static float Value() { return (float)UNITY_FLOAT_PRECISION; } };
+#endif
+#ifdef UNITY_DOUBLE_PRECISION
+template <> struct Precision<double> { static double Value() { return (double)UNITY_DOUBLE_PRECISION; } };
+#endif
+
+template <typename T>
+inline bool IsNegative(const T& value, std::true_type) { return value < T(0); }
+template <typename T>
+inline bool IsNegative(const T&, std::false_type) { return false; }
+
+template <typename E, typename A>
+inline bool Equal(const E& expected, const A& actual);
+
+template <typename E, typename A>
+inline bool EqualAs(const E& expected, const A& actual, KindTag<Kind::Integer>, KindTag<Kind::Integer>)
+{
+    const bool negative = IsNegative(expected, std::is_signed<E>());
+    if (negative != IsNegative(actual, std::is_signed<A>()))
+        return false;
+    if (negative)
+        return (intmax_t)expected == (intmax_t)actual;
+    return (uintmax_t)expected == (uintmax_t)actual;
+}
+
+template <typename E, typename A, Kind K>
+inline bool EqualAs(const E& expected, const A& actual, KindTag<Kind::Floating>, KindTag<K>)
+{
+    // compare in the type of the floating point side (actual when both are)
+    typedef typename std::conditional<std::is_floating_point<A>::value, A, E>::type F;
+    const F e = (F)expected;
+    const F a = (F)actual;
+    const F tolerance = (e < 0) ? -(e * Precision<F>::Value()) : (e * Precision<F>::Value());
+
+    if (e == a)
+        return true;
+    // false for NaN
+    return ((a - e) <= tolerance) && ((e - a) <= tolerance);
+}
+
+template <typename E, typename A>
+inline bool EqualAs(const E& expected, const A& actual, KindTag<Kind::String>, KindTag<Kind::String>)
+{
+    const String e = ToString(expected);
+    const String a = ToString(actual);
+
+    if ((e.Data == nullptr) || (a.Data == nullptr))
+        return e.Data == a.Data;
+    return (e.Length == a.Length) && (std::memcmp(e.Data, a.Data, e.Length) == 0);
+}
+
+template <typename E, typename A>
+inline bool EqualAs(const E& expected, const A& actual, KindTag<Kind::Range>, KindTag<Kind::Range>)
+{
+    auto e = std::begin(expected);
+    auto a = std::begin(actual);
+
+    for (; (e != std::end(expected)) && (a != std::end(actual)); ++e, ++a)
+    {
+        if (!unity::Equal(*e, *a))
+            return false;
+    }
+    return (e == std::end(expected)) && (a == std::end(actual));
+}
+
+template <typename E, typename A, Kind KE, Kind KA>
+inline bool EqualAs(const E& expected, const A& actual, KindTag<KE>, KindTag<KA>)
+{
+    return expected == actual;
+}
+
+template <typename E, typename A>
+inline bool Equal(const E& expected, const A& actual)
+{
+    // floats are compared with the tolerance of whichever side is floating point
+    return EqualAs(expected, actual,
+                   KindTag<(KindOf<A>::value == Kind::Floating) ? Kind::Floating : KindOf<E>::value>(),
+                   KindTag<(KindOf<A>::value == Kind::Floating) ? KindOf<E>::value : KindOf<A>::value>());
+}
+
+//-------------------------------------------------------
+// Failure Messages
+//-------------------------------------------------------
+
+template <typename E, typename A>
+inline void PrintExpectedAndActual(const E& expected, const A& actual)
+{
+    UnityPrint(UnityStrExpected);
+    unity::Print(expected);
+    UnityPrint(UnityStrWas);
+    unity::Print(actual);
+}
+
+template <typename R>
+inline size_t RangeSize(const R& range)
+{
+    return (size_t)std::distance(std::begin(range), std::end(range));
+}
+
+/// Names the first element that differs, or the sizes when one range is a prefix of the other
+template <typename E, typename A>
+inline void PrintDifference(const E& expected, const A& actual, std::true_type)
+{
+    auto e = std::begin(expected);
+    auto a = std::begin(actual);
+    size_t index = 0;
+
+    for (; (e != std::end(expected)) && (a != std::end(actual)); ++e, ++a, ++index)
+    {
+        if (!unity::Equal(*e, *a))
+        {
+            UnityPrint(UnityStrElement);
+            UnityPrintNumberUnsigned((_U_UINT)index);
+            PrintExpectedAndActual(*e, *a);
+            return;
+        }
+    }
+    UnityPrint(UnityStrExpected);
+    UnityPrintNumberUnsigned((_U_UINT)RangeSize(expected));
+    UnityPrint(" Elements");
+    UnityPrint(UnityStrWas);
+    UnityPrintNumberUnsigned((_U_UINT)RangeSize(actual));
+}
+
+template <typename E, typename A>
+inline void PrintDifference(const E& expected, const A& actual, std::false_type)
+{
+    PrintExpectedAndActual(expected, actual);
+}
+
+//-------------------------------------------------------
+// Assertions
+//-------------------------------------------------------
+
+/// Returns non-zero when the test should return: the values differ, or the test had already failed or been ignored
+template <typename E, typename A>
+inline UNITY_BOOL AssertEqual(const E& expected, const A& actual, const char* msg, const UNITY_LINE_TYPE line)
+{
+    if (UNITY_CURRENT_TEST_ENDED())
+        return 1;
+    UNITY_COUNT_ASSERTION();
+    if (unity::Equal(expected, actual))
+        return 0;
+
+    UnityTestResultsFailBegin(line);
+    PrintDifference(expected, actual, std::integral_constant<bool, IsRange<E>::value && IsRange<A>::value>());
+    return UnityTestResultsFailEnd(msg);
+}
+
+} // namespace unity
+
+#define TEST_ASSERT_EQ(expected, actual)                                                           if (unity::AssertEqual((expected), (actual), NULL, (UNITY_LINE_TYPE)__LINE__) != 0) return;
+#define TEST_ASSERT_EQ_MESSAGE(expected, actual, message)                                          if (unity::AssertEqual((expected), (actual), (message), (UNITY_LINE_TYPE)__LINE__) != 0) return;
+
+#endif
@@ -176,6 +176,17 @@ typedef _US64 _U_SINT;
   #define UNITY_PTR_ATTRIBUTE
 #endif
 
+//-------------------------------------------------------
+// Generic Selection
+//-------------------------------------------------------
+
+//C11 compilers pick the assertion for TEST_ASSERT_EQUAL and TEST_ASSERT_EQUAL_ARRAY from the argument type with _Generic
+#if !defined(UNITY_SUPPORT_GENERIC) && !defined(UNITY_EXCLUDE_GENERIC) && !defined(__cplusplus)
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define UNITY_SUPPORT_GENERIC
+#endif
+#endif
+
 //-------------------------------------------------------
 // Float Support
 //-------------------------------------------------------
@@ -240,6 +251,273 @@ extern int UNITY_OUTPUT_CHAR(int);
 #define UNITY_OUTPUT_COMPLETE()
 #endif
 
+//UNITY_OUTPUT_BLOCK(buffer, length) is optional.  When defined, formatted numbers are
+//handed to it whole instead of one UNITY_OUTPUT_CHAR call per digit
+
+//-------------------------------------------------------
+// Execution Time
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_EXEC_TIME
+#ifndef UNITY_CLOCK_MS
+//Default to a monotonic wall clock where the platform has one (POSIX clock_gettime), else to the
+//standard library clock(), which counts processor time.  Either way the count wraps only at 32 bits
+#include <time.h>
+#define UNITY_CLOCK_MS_DEFAULT
+#define UNITY_CLOCK_MS() UnityClockMs()
+_UU32 UnityClockMs(void);
+#endif
+#endif
+
+//-------------------------------------------------------
+// JUnit XML Output
+//-------------------------------------------------------
+
+#ifdef UNITY_OUTPUT_JUNIT
+
+#ifndef UNITY_JUNIT_MESSAGE_LENGTH
+#define UNITY_JUNIT_MESSAGE_LENGTH (256)
+#endif
+
+#ifndef UNITY_JUNIT_OUTPUT_CHAR
+//Default to writing the report into UNITY_JUNIT_FILE through stdio
+#ifndef UNITY_JUNIT_FILE
+#define UNITY_JUNIT_FILE "report.xml"
+#endif
+#define UNITY_JUNIT_OUTPUT_STDIO
+#define UNITY_JUNIT_OUTPUT_CHAR(a)    UnityJUnitFilePutChar(a)
+#define UNITY_JUNIT_OUTPUT_START()    UnityJUnitFileOpen()
+#define UNITY_JUNIT_OUTPUT_COMPLETE() UnityJUnitFileClose()
+#else
+//If defined as something else, make sure we declare it here so it's ready for use
+extern int UNITY_JUNIT_OUTPUT_CHAR(int);
+#endif
+
+#ifndef UNITY_JUNIT_OUTPUT_START
+#define UNITY_JUNIT_OUTPUT_START()
+#endif
+
+#ifndef UNITY_JUNIT_OUTPUT_COMPLETE
+#define UNITY_JUNIT_OUTPUT_COMPLETE()
+#endif
+
+#endif  // UNITY_OUTPUT_JUNIT
+
+//-------------------------------------------------------
+// Memory Diff
+//-------------------------------------------------------
+
+#ifdef UNITY_MEMORY_DIFF
+#ifndef UNITY_MEMORY_DIFF_WINDOW
+#define UNITY_MEMORY_DIFF_WINDOW (32)
+#endif
+#if (UNITY_MEMORY_DIFF_WINDOW < 16) || (UNITY_MEMORY_DIFF_WINDOW > 64)
+#error "UNITY_MEMORY_DIFF_WINDOW must be between 16 and 64 bytes"
+#endif
+//Bytes shown on each line, for both expected and actual
+#define UNITY_MEMORY_DIFF_ROW (8)
+#endif
+
+//-------------------------------------------------------
+// Data File Tests
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_DATA_FILE
+//Tables are opened (and mapped) like golden files
+#ifndef UNITY_INCLUDE_FILE
+#define UNITY_INCLUDE_FILE
+#endif
+//Failing rows a TEST_DATA_FILE reports before it stops running rows
+#ifndef UNITY_DATA_FAILURE_LIMIT
+#define UNITY_DATA_FAILURE_LIMIT (16)
+#endif
+//Largest row in bytes when tables are read through stdio instead of mapped
+#ifndef UNITY_DATA_ROW_MAX
+#define UNITY_DATA_ROW_MAX (256)
+#endif
+#endif
+
+//-------------------------------------------------------
+// Golden Files
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_FILE
+//Map golden files into memory where we know how, and read them through stdio otherwise
+#if defined(__linux__) && !defined(UNITY_FILE_NO_MMAP) && !defined(UNITY_FILE_MMAP)
+#define UNITY_FILE_MMAP
+#endif
+//Bytes read at a time when files are read through stdio
+#ifndef UNITY_FILE_BLOCK_SIZE
+#define UNITY_FILE_BLOCK_SIZE (256)
+#endif
+#ifndef UNITY_UPDATE_GOLDEN_ENV
+#define UNITY_UPDATE_GOLDEN_ENV "UNITY_UPDATE_GOLDEN"
+#endif
+#endif
+
+//-------------------------------------------------------
+// Unordered Arrays
+//-------------------------------------------------------
+
+//Missing and extra elements listed for each side before the rest are only counted
+#ifndef UNITY_UNORDERED_REPORT_LIMIT
+#define UNITY_UNORDERED_REPORT_LIMIT (8)
+#endif
+
+//UNITY_SCRATCH_SIZE (bytes) is left undefined: with no arena to sort in, the comparisons are O(n^2)
+
+//-------------------------------------------------------
+// Array Predicates
+//-------------------------------------------------------
+
+//Elements checked together before looking for the one that failed
+#ifndef UNITY_SCAN_BLOCK
+#define UNITY_SCAN_BLOCK (64)
+#endif
+
+//-------------------------------------------------------
+// Property-Based Tests
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_PROPERTY
+//Cases TEST_PROPERTY tries before it passes
+#ifndef UNITY_PROPERTY_ITERATIONS
+#define UNITY_PROPERTY_ITERATIONS (100)
+#endif
+
+//Seed of the first case.  UnitySetPropertySeed changes it at run time
+#ifndef UNITY_PROPERTY_SEED
+#define UNITY_PROPERTY_SEED (0x2545F491UL)
+#endif
+
+//Random choices remembered per case for shrinking (two arrays of 4 byte entries)
+#ifndef UNITY_PROPERTY_MAX_CHOICES
+#define UNITY_PROPERTY_MAX_CHOICES (256)
+#endif
+
+//Replays a failing case may use while it is shrunk
+#ifndef UNITY_PROPERTY_SHRINK_LIMIT
+#define UNITY_PROPERTY_SHRINK_LIMIT (2000)
+#endif
+#endif
+
+//-------------------------------------------------------
+// Mismatch Reporting
+//-------------------------------------------------------
+
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+#ifndef UNITY_MISMATCH_REPORT_LIMIT
+#define UNITY_MISMATCH_REPORT_LIMIT (8)
+#endif
+//Bytes compared with one memcmp when looking for the next difference
+#ifndef UNITY_MISMATCH_BLOCK_SIZE
+#define UNITY_MISMATCH_BLOCK_SIZE (64)
+#endif
+#endif
+
+//-------------------------------------------------------
+// Concurrent Tests
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_CONCURRENT
+//Threads report their failures through the thread-safe core
+#ifndef UNITY_THREAD_SAFE
+#define UNITY_THREAD_SAFE
+#endif
+//Most threads one TEST_CONCURRENT can start
+#ifndef UNITY_CONCURRENT_MAX_THREADS
+#define UNITY_CONCURRENT_MAX_THREADS (64)
+#endif
+//Define UNITY_CLOCK_US() to time the threads with something other than the POSIX monotonic clock.  It may wrap
+//Tells the core a thread is spinning while it waits for the others to start
+#ifndef UNITY_CPU_PAUSE
+#if defined(__i386__) || defined(__x86_64__)
+#define UNITY_CPU_PAUSE() __builtin_ia32_pause()
+#elif defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
+#define UNITY_CPU_PAUSE() __asm__ __volatile__("yield")
+#else
+#define UNITY_CPU_PAUSE()
+#endif
+#endif
+#endif
+
+//-------------------------------------------------------
+// Interleaved Tests
+//-------------------------------------------------------
+
+#ifdef UNITY_INCLUDE_INTERLEAVE
+//Threads report their failures through the thread-safe core
+#ifndef UNITY_THREAD_SAFE
+#define UNITY_THREAD_SAFE
+#endif
+//Most threads one schedule can spawn
+#ifndef UNITY_INTERLEAVE_MAX_THREADS
+#define UNITY_INTERLEAVE_MAX_THREADS (8)
+#endif
+#if (UNITY_INTERLEAVE_MAX_THREADS < 1) || (UNITY_INTERLEAVE_MAX_THREADS > 255)
+#error "UNITY_INTERLEAVE_MAX_THREADS must be between 1 and 255"
+#endif
+//Turns one schedule may hand out before it fails as stuck (three arrays of 1 byte entries)
+#ifndef UNITY_INTERLEAVE_MAX_STEPS
+#define UNITY_INTERLEAVE_MAX_STEPS (1000)
+#endif
+//Times one TEST_INTERLEAVED_ALL schedule may depart from round robin order.  Spinning on UNITY_YIELD() ends within that many turns of its own, so keep it well under UNITY_INTERLEAVE_MAX_STEPS
+#ifndef UNITY_INTERLEAVE_MAX_PREEMPTIONS
+#define UNITY_INTERLEAVE_MAX_PREEMPTIONS (3)
+#endif
+//Schedules TEST_INTERLEAVED_ALL runs before it passes without having tried every order
+#ifndef UNITY_INTERLEAVE_MAX_SCHEDULES
+#define UNITY_INTERLEAVE_MAX_SCHEDULES (100000)
+#endif
+//Seed of the first random schedule.  UnitySetInterleaveSeed changes it at run time
+#ifndef UNITY_INTERLEAVE_SEED
+#define UNITY_INTERLEAVE_SEED (0x6A09E667UL)
+#endif
+#endif
+
+//-------------------------------------------------------
+// Thread Safety
+//-------------------------------------------------------
+
+#ifdef UNITY_THREAD_SAFE
+//Atomic operations on the counters and flags in Unity.  The defaults are the GCC / Clang builtins
+#ifndef UNITY_ATOMIC_ADD
+#define UNITY_ATOMIC_ADD(var, n)            __atomic_fetch_add(&(var), (n), __ATOMIC_RELAXED)
+#endif
+#ifndef UNITY_ATOMIC_LOAD
+#define UNITY_ATOMIC_LOAD(var)              __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#endif
+#ifndef UNITY_ATOMIC_STORE
+#define UNITY_ATOMIC_STORE(var, value)      __atomic_store_n(&(var), (value), __ATOMIC_RELEASE)
+#endif
+//Sets var to desired and returns non-zero if it still held expected; otherwise loads var into expected
+#ifndef UNITY_ATOMIC_CAS
+#define UNITY_ATOMIC_CAS(var, expected, desired) __atomic_compare_exchange_n(&(var), &(expected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+#endif
+#ifndef UNITY_THREAD_LOCAL
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define UNITY_THREAD_LOCAL _Thread_local
+#else
+#define UNITY_THREAD_LOCAL __thread
+#endif
+#endif
+//Lines of output other threads can have waiting for the main thread to print them (a power of two)
+#ifndef UNITY_OUTPUT_QUEUE_SIZE
+#define UNITY_OUTPUT_QUEUE_SIZE (64)
+#endif
+//Longest line another thread can print; the rest of a longer line is cut off
+#ifndef UNITY_OUTPUT_RECORD_LENGTH
+#define UNITY_OUTPUT_RECORD_LENGTH (256)
+#endif
+#else
+#define UNITY_ATOMIC_ADD(var, n)            ((var) += (n))
+#define UNITY_ATOMIC_LOAD(var)              (var)
+#define UNITY_ATOMIC_STORE(var, value)      ((var) = (value))
+//With one thread, data kept per thread is ordinary static data
+#undef  UNITY_THREAD_LOCAL
+#define UNITY_THREAD_LOCAL
+#endif
+
 //-------------------------------------------------------
 // Footprint
 //-------------------------------------------------------
@@ -248,6 +526,14 @@ extern int UNITY_OUTPUT_CHAR(int);
 #define UNITY_LINE_TYPE _U_UINT
 #endif
 
+#ifdef UNITY_COUNTER_64
+#ifndef UNITY_SUPPORT_64
+#error "You've Specified 64-bit counters without enabling 64-bit Support. Define UNITY_SUPPORT_64"
+#endif
+#undef  UNITY_COUNTER_TYPE
+#define UNITY_COUNTER_TYPE _UU64
+#endif
+
 #ifndef UNITY_COUNTER_TYPE
 #define UNITY_COUNTER_TYPE _U_UINT
 #endif
@@ -336,6 +622,14 @@ typedef enum _UNITY_FLOAT_TRAIT_T
 } UNITY_FLOAT_TRAIT_T;
 #endif  // defined(UNITY_INCLUDE_FLOAT) || defined(UNITY_INCLUDE_DOUBLE)
 
+#ifdef UNITY_INCLUDE_DIGEST
+typedef enum _UNITY_DIGEST_T
+{
+    UNITY_DIGEST_CRC32 = 0,
+    UNITY_DIGEST_XXH64
+} UNITY_DIGEST_T;
+#endif
+
 typedef unsigned char UNITY_BOOL;
 #define UNITY_TRUE (!0)
 #define UNITY_FALSE (0)
@@ -355,6 +649,24 @@ struct _Unity
     UNITY_COUNTER_TYPE CurrentTestFailed;
     UNITY_COUNTER_TYPE CurrentTestIgnored;
     UNITY_COUNTER_TYPE NumberOfAssertions;
+    const char* CurrentSubtestName;
+    UNITY_COUNTER_TYPE CurrentTestSubtests;
+    UNITY_COUNTER_TYPE CurrentTestSubtestFailures;
+    UNITY_COUNTER_TYPE CurrentTestSubtestIgnores;
+    UNITY_COUNTER_TYPE CurrentTestOuterFailed;
+    UNITY_COUNTER_TYPE CurrentTestOuterIgnored;
+    UNITY_COUNTER_TYPE NumberOfSubtests;
+    UNITY_COUNTER_TYPE SubtestFailures;
+    UNITY_COUNTER_TYPE SubtestIgnores;
+#ifdef UNITY_INCLUDE_ASSERTION_STATS
+    UNITY_COUNTER_TYPE CurrentTestFirstAssertion;
+#endif
+#ifdef UNITY_INCLUDE_EXEC_TIME
+    _UU32 CurrentTestStartTime;
+#ifdef UNITY_INCLUDE_ASSERTION_STATS
+    _UU32 StartTime;
+#endif
+#endif
 };
 
 extern struct _Unity Unity;
@@ -370,12 +682,82 @@ void UnitySetContext(const char* filename, unity_void_fn up, unity_void_fn down)
 void UnityConcludeTest(void);
 void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum);
 void UnityTestResultsBegin(const char* file, const UNITY_LINE_TYPE line);
+void UnityTestResultsFailBegin(const UNITY_LINE_TYPE line);
+UNITY_BOOL UnityTestResultsFailEnd(const char* msg);
+void UnitySubtestBegin(const char* name);
+void UnitySubtestEnd(void);
+
+//Assertions count themselves and check whether the test has already ended through these, so they are atomic when UNITY_THREAD_SAFE
+#define UNITY_COUNT_ASSERTION()     UNITY_ATOMIC_ADD(Unity.NumberOfAssertions, 1)
+#define UNITY_CURRENT_TEST_ENDED()  ((UNITY_ATOMIC_LOAD(Unity.CurrentTestFailed) != 0) || (UNITY_ATOMIC_LOAD(Unity.CurrentTestIgnored) != 0))
+
+#ifdef UNITY_THREAD_SAFE
+//-------------------------------------------------------
+// Thread Safety
+//-------------------------------------------------------
+
+void UnitySetThreadName(const char* name);
+void UnitySetThreadIndex(_UU32 index);
+_UU32 UnityThreadIndex(void);
+UNITY_BOOL UnityThreadFailed(void);
+void UnityFlushThreadOutput(void);
+#endif
+
+#ifdef UNITY_INCLUDE_PROPERTY
+//-------------------------------------------------------
+// Property-Based Tests
+//-------------------------------------------------------
+
+void UnityRunProperty(UnityTestFunction property, const _UU32 iterations, const UNITY_LINE_TYPE line);
+void UnitySetPropertySeed(const _UU32 seed);
+void UnityPropertyReject(void);
+_U_SINT UnityGenInt(const _U_SINT low, const _U_SINT high, const UNITY_LINE_TYPE line);
+_U_UINT UnityGenUInt(const _U_UINT low, const _U_UINT high, const UNITY_LINE_TYPE line);
+_UU32 UnityGenChoice(const _UU32 count, const UNITY_LINE_TYPE line);
+_UU32 UnityGenBytes(void* buffer, const _UU32 min_length, const _UU32 max_length, const UNITY_LINE_TYPE line);
+_UU32 UnityGenString(char* buffer, const _UU32 size, const char* alphabet, const UNITY_LINE_TYPE line);
+#ifdef UNITY_INCLUDE_FLOAT
+_UF UnityGenFloat(const _UF low, const _UF high, const UNITY_LINE_TYPE line);
+#endif
+#endif
+
+#ifdef UNITY_INCLUDE_DATA_FILE
+//-------------------------------------------------------
+// Data File Tests
+//-------------------------------------------------------
+
+void UnityRunDataFile(UnityTestFunction row_test, const char* path, const UNITY_LINE_TYPE line);
+UNITY_PTR_ATTRIBUTE const void* UnityDataRow(const _UU32 row_size, const UNITY_LINE_TYPE line);
+_UU32 UnityDataRowIndex(void);
+#endif
+
+#ifdef UNITY_INCLUDE_CONCURRENT
+//-------------------------------------------------------
+// Concurrent Tests
+//-------------------------------------------------------
+
+void UnityRunConcurrent(UnityTestFunction body, const _UU32 threads, const _UU32 iterations, const UNITY_BOOL pinned, const UNITY_LINE_TYPE line);
+_UU32 UnityConcurrentIteration(void);
+#endif
+
+#ifdef UNITY_INCLUDE_INTERLEAVE
+//-------------------------------------------------------
+// Interleaved Tests
+//-------------------------------------------------------
+
+void UnityRunInterleaved(UnityTestFunction body, const _UU32 schedules, const UNITY_LINE_TYPE line);
+void UnitySetInterleaveSeed(const _UU32 seed);
+void UnityInterleaveSpawn(UnityTestFunction function, const UNITY_LINE_TYPE line);
+void UnityInterleaveJoin(const UNITY_LINE_TYPE line);
+void UnityInterleaveYield(void);
+#endif
 
 //-------------------------------------------------------
 // Test Output
 //-------------------------------------------------------
 
 void UnityPrint(const char* string);
+void UnityPrintLen(const char* string, const _UU32 length);
 void UnityPrintMask(const _U_UINT mask, const _U_UINT number);
 void UnityPrintNumberByStyle(const _U_SINT number, const UNITY_DISPLAY_STYLE_T style);
 void UnityPrintNumber(const _U_SINT number);
@@ -458,6 +840,66 @@ UNITY_BOOL UnityAssertEqualIntArray(UNITY_PTR_ATTRIBUTE const void* expected,
                               const UNITY_LINE_TYPE lineNumber,
                               const UNITY_DISPLAY_STYLE_T style);
 
+UNITY_BOOL UnityAssertEqualIntArray8(UNITY_PTR_ATTRIBUTE const void* expected,
+                                     UNITY_PTR_ATTRIBUTE const void* actual,
+                                     const _UU32 num_elements,
+                                     const char* msg,
+                                     const UNITY_LINE_TYPE lineNumber,
+                                     const UNITY_DISPLAY_STYLE_T style);
+
+UNITY_BOOL UnityAssertEqualIntArray16(UNITY_PTR_ATTRIBUTE const void* expected,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber,
+                                      const UNITY_DISPLAY_STYLE_T style);
+
+UNITY_BOOL UnityAssertEqualIntArray32(UNITY_PTR_ATTRIBUTE const void* expected,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber,
+                                      const UNITY_DISPLAY_STYLE_T style);
+
+#ifdef UNITY_SUPPORT_64
+UNITY_BOOL UnityAssertEqualIntArray64(UNITY_PTR_ATTRIBUTE const void* expected,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber,
+                                      const UNITY_DISPLAY_STYLE_T style);
+#endif
+
+UNITY_BOOL UnityAssertEqualIntArrayUnordered(UNITY_PTR_ATTRIBUTE const void* expected,
+                                             UNITY_PTR_ATTRIBUTE const void* actual,
+                                             const _UU32 num_elements,
+                                             const char* msg,
+                                             const UNITY_LINE_TYPE lineNumber,
+                                             const UNITY_DISPLAY_STYLE_T style);
+
+UNITY_BOOL UnityAssertEqualMemoryUnordered(UNITY_PTR_ATTRIBUTE const void* expected,
+                                           UNITY_PTR_ATTRIBUTE const void* actual,
+                                           const _UU32 length,
+                                           const _UU32 num_elements,
+                                           const char* msg,
+                                           const UNITY_LINE_TYPE lineNumber);
+
+void UnitySetScratch(void* buffer, const _UU32 size);
+
+UNITY_BOOL UnityAssertEachWithinRange(const _U_SINT low,
+                                      const _U_SINT high,
+                                      UNITY_PTR_ATTRIBUTE const void* actual,
+                                      const _UU32 num_elements,
+                                      const char* msg,
+                                      const UNITY_LINE_TYPE lineNumber,
+                                      const UNITY_DISPLAY_STYLE_T style);
+
+UNITY_BOOL UnityAssertArraySorted(UNITY_PTR_ATTRIBUTE const void* actual,
+                                  const _UU32 num_elements,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber,
+                                  const UNITY_DISPLAY_STYLE_T style);
+
 UNITY_BOOL UnityAssertBits(const _U_SINT mask,
                      const _U_SINT expected,
                      const _U_SINT actual,
@@ -516,6 +958,34 @@ UNITY_BOOL UnityAssertFloatSpecial(const _UF actual,
                              const char* msg,
                              const UNITY_LINE_TYPE lineNumber,
                              const UNITY_FLOAT_TRAIT_T style);
+
+UNITY_BOOL UnityAssertFloatsWithinUlp(const _UU32 max_ulps,
+                                    const _UF expected,
+                                    const _UF actual,
+                                    const char* msg,
+                                    const UNITY_LINE_TYPE lineNumber);
+
+UNITY_BOOL UnityAssertFloatArrayWithinUlp(const _UU32 max_ulps,
+                                        UNITY_PTR_ATTRIBUTE const _UF* expected,
+                                        UNITY_PTR_ATTRIBUTE const _UF* actual,
+                                        const _UU32 num_elements,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber);
+
+UNITY_BOOL UnityAssertFloatsWithinTolerance(const _UF abs_tol,
+                                          const _UF rel_tol,
+                                          const _UF expected,
+                                          const _UF actual,
+                                          const char* msg,
+                                          const UNITY_LINE_TYPE lineNumber);
+
+UNITY_BOOL UnityAssertFloatArrayWithinTolerance(const _UF abs_tol,
+                                              const _UF rel_tol,
+                                              UNITY_PTR_ATTRIBUTE const _UF* expected,
+                                              UNITY_PTR_ATTRIBUTE const _UF* actual,
+                                              const _UU32 num_elements,
+                                              const char* msg,
+                                              const UNITY_LINE_TYPE lineNumber);
 #endif  // defined(UNITY_INCLUDE_FLOAT)
 
 #if defined(UNITY_INCLUDE_DOUBLE)
@@ -535,15 +1005,145 @@ UNITY_BOOL UnityAssertDoubleSpecial(const _UD actual,
                               const char* msg,
                               const UNITY_LINE_TYPE lineNumber,
                               const UNITY_FLOAT_TRAIT_T style);
+
+#ifdef UNITY_SUPPORT_64
+UNITY_BOOL UnityAssertDoublesWithinUlp(const _UU64 max_ulps,
+                                    const _UD expected,
+                                    const _UD actual,
+                                    const char* msg,
+                                    const UNITY_LINE_TYPE lineNumber);
+
+UNITY_BOOL UnityAssertDoubleArrayWithinUlp(const _UU64 max_ulps,
+                                        UNITY_PTR_ATTRIBUTE const _UD* expected,
+                                        UNITY_PTR_ATTRIBUTE const _UD* actual,
+                                        const _UU32 num_elements,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber);
+#endif
+
+UNITY_BOOL UnityAssertDoublesWithinTolerance(const _UD abs_tol,
+                                          const _UD rel_tol,
+                                          const _UD expected,
+                                          const _UD actual,
+                                          const char* msg,
+                                          const UNITY_LINE_TYPE lineNumber);
+
+UNITY_BOOL UnityAssertDoubleArrayWithinTolerance(const _UD abs_tol,
+                                              const _UD rel_tol,
+                                              UNITY_PTR_ATTRIBUTE const _UD* expected,
+                                              UNITY_PTR_ATTRIBUTE const _UD* actual,
+                                              const _UU32 num_elements,
+                                              const char* msg,
+                                              const UNITY_LINE_TYPE lineNumber);
 #endif  // defined(UNITY_INCLUDE_DOUBLE)
 
+#ifdef UNITY_INCLUDE_FILE
+UNITY_BOOL UnityAssertEqualFile(const char* path,
+                                UNITY_PTR_ATTRIBUTE const void* actual,
+                                const _UU32 length,
+                                const char* msg,
+                                const UNITY_LINE_TYPE lineNumber);
+
+UNITY_BOOL UnityAssertFilesEqual(const char* expected_path,
+                                 const char* actual_path,
+                                 const char* msg,
+                                 const UNITY_LINE_TYPE lineNumber);
+#endif  // defined(UNITY_INCLUDE_FILE)
+
+#ifdef UNITY_INCLUDE_DIGEST
+_UU32 UnityCrc32(UNITY_PTR_ATTRIBUTE const void* data, const _UU32 length);
+#ifdef UNITY_SUPPORT_64
+_UU64 UnityXxh64(UNITY_PTR_ATTRIBUTE const void* data, const _UU32 length);
+#endif
+
+UNITY_BOOL UnityAssertMemoryDigest(const _U_UINT expected,
+                                   UNITY_PTR_ATTRIBUTE const void* actual,
+                                   const _UU32 length,
+                                   const char* msg,
+                                   const UNITY_LINE_TYPE lineNumber,
+                                   const UNITY_DIGEST_T digest);
+
+UNITY_BOOL UnityAssertMemoryDigestBlocks(UNITY_PTR_ATTRIBUTE const void* expected,
+                                         UNITY_PTR_ATTRIBUTE const void* actual,
+                                         const _UU32 length,
+                                         const _UU32 block_size,
+                                         const char* msg,
+                                         const UNITY_LINE_TYPE lineNumber,
+                                         const UNITY_DIGEST_T digest);
+#endif  // defined(UNITY_INCLUDE_DIGEST)
+
+#ifdef UNITY_SUPPORT_GENERIC
+//Selected by TEST_ASSERT_EQUAL and TEST_ASSERT_EQUAL_ARRAY, so they all take a display style
+UNITY_BOOL UnityAssertEqualGenericNumber(const _U_SINT expected,
+                                         const _U_SINT actual,
+                                         const char* msg,
+                                         const UNITY_LINE_TYPE lineNumber,
+                                         const UNITY_DISPLAY_STYLE_T style);
+
+UNITY_BOOL UnityAssertEqualGenericPointer(UNITY_PTR_ATTRIBUTE const void* expected,
+                                          UNITY_PTR_ATTRIBUTE const void* actual,
+                                          const char* msg,
+                                          const UNITY_LINE_TYPE lineNumber,
+                                          const UNITY_DISPLAY_STYLE_T style);
+
+UNITY_BOOL UnityAssertEqualGenericString(const char* expected,
+                                         const char* actual,
+                                         const char* msg,
+                                         const UNITY_LINE_TYPE lineNumber,
+                                         const UNITY_DISPLAY_STYLE_T style);
+
+UNITY_BOOL UnityAssertEqualGenericStringArray(UNITY_PTR_ATTRIBUTE const void* expected,
+                                              UNITY_PTR_ATTRIBUTE const void* actual,
+                                              const _UU32 num_elements,
+                                              const char* msg,
+                                              const UNITY_LINE_TYPE lineNumber,
+                                              const UNITY_DISPLAY_STYLE_T style);
+
+#ifdef UNITY_INCLUDE_FLOAT
+UNITY_BOOL UnityAssertEqualGenericFloat(const _UF expected,
+                                        const _UF actual,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber,
+                                        const UNITY_DISPLAY_STYLE_T style);
+
+UNITY_BOOL UnityAssertEqualGenericFloatArray(UNITY_PTR_ATTRIBUTE const void* expected,
+                                             UNITY_PTR_ATTRIBUTE const void* actual,
+                                             const _UU32 num_elements,
+                                             const char* msg,
+                                             const UNITY_LINE_TYPE lineNumber,
+                                             const UNITY_DISPLAY_STYLE_T style);
+#endif
+
+#ifdef UNITY_INCLUDE_DOUBLE
+UNITY_BOOL UnityAssertEqualGenericDouble(const _UD expected,
+                                         const _UD actual,
+                                         const char* msg,
+                                         const UNITY_LINE_TYPE lineNumber,
+                                         const UNITY_DISPLAY_STYLE_T style);
+
+UNITY_BOOL UnityAssertEqualGenericDoubleArray(UNITY_PTR_ATTRIBUTE const void* expected,
+                                              UNITY_PTR_ATTRIBUTE const void* actual,
+                                              const _UU32 num_elements,
+                                              const char* msg,
+                                              const UNITY_LINE_TYPE lineNumber,
+                                              const UNITY_DISPLAY_STYLE_T style);
+#endif
+#endif  // defined(UNITY_SUPPORT_GENERIC)
+
 //-------------------------------------------------------
 // Error Strings We Might Need
 //-------------------------------------------------------
 
+extern const char UnityStrExpected[];
+extern const char UnityStrWas[];
+extern const char UnityStrElement[];
+extern const char UnityStrNull[];
 extern const char UnityStrErrFloat[];
 extern const char UnityStrErrDouble[];
 extern const char UnityStrErr64[];
+extern const char UnityStrErrDigest[];
+extern const char UnityStrErrFile[];
+extern const char UnityStrErrGeneric[];
 
 //-------------------------------------------------------
 // Basic Fail and Ignore
@@ -556,7 +1156,7 @@ extern const char UnityStrErr64[];
 // Test Asserts
 //-------------------------------------------------------
 
-#define UNITY_TEST_ASSERT(condition, line, message)                                              { Unity.NumberOfAssertions++; if (condition) {} else {UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), (message));} }
+#define UNITY_TEST_ASSERT(condition, line, message)                                              { UNITY_COUNT_ASSERTION(); if (condition) {} else {UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), (message));} }
 #define UNITY_TEST_ASSERT_NULL(pointer, line, message)                                           UNITY_TEST_ASSERT(((pointer) == NULL),  (UNITY_LINE_TYPE)(line), (message))
 #define UNITY_TEST_ASSERT_NOT_NULL(pointer, line, message)                                       UNITY_TEST_ASSERT(((pointer) != NULL),  (UNITY_LINE_TYPE)(line), (message))
 
@@ -664,6 +1264,51 @@ extern const char UnityStrErr64[];
 #define UNITY_TEST_ASSERT_EQUAL_PTR_ARRAY(expected, actual, num_elements, line, message)         if (UnityAssertEqualIntArray((UNITY_PTR_ATTRIBUTE const void*)(_UP*)(expected), (const void*)(_UP*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_POINTER) != 0) return;
 #define UNITY_TEST_ASSERT_EQUAL_STRING_ARRAY(expected, actual, num_elements, line, message)      if (UnityAssertEqualStringArray((const char**)(expected), (const char**)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
 #define UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY(expected, actual, len, num_elements, line, message) if (UnityAssertEqualMemory((UNITY_PTR_ATTRIBUTE void*)(expected), (UNITY_PTR_ATTRIBUTE void*)(actual), (_UU32)(len), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_INT_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_INT8_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_INT16_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_INT32_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_UINT_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_UINT8_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_UINT16_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_UINT32_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY_UNORDERED(expected, actual, len, num_elements, line, message) if (UnityAssertEqualMemoryUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(len), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_INT(expected, actual, num_elements, line, message)          if (UnityAssertEachWithinRange((_U_SINT)(expected), (_U_SINT)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_INT_WITHIN_RANGE(low, high, actual, num_elements, line, message)  if (UnityAssertEachWithinRange((_U_SINT)(low), (_U_SINT)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT) != 0) return;
+#define UNITY_TEST_ASSERT_INT_ARRAY_SORTED(actual, num_elements, line, message)                  if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_INT8(expected, actual, num_elements, line, message)         if (UnityAssertEachWithinRange((_U_SINT)(expected), (_U_SINT)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_INT8_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(low), (_U_SINT)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8) != 0) return;
+#define UNITY_TEST_ASSERT_INT8_ARRAY_SORTED(actual, num_elements, line, message)                 if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_INT16(expected, actual, num_elements, line, message)        if (UnityAssertEachWithinRange((_U_SINT)(expected), (_U_SINT)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_INT16_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(low), (_U_SINT)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16) != 0) return;
+#define UNITY_TEST_ASSERT_INT16_ARRAY_SORTED(actual, num_elements, line, message)                if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_INT32(expected, actual, num_elements, line, message)        if (UnityAssertEachWithinRange((_U_SINT)(expected), (_U_SINT)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_INT32_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(low), (_U_SINT)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32) != 0) return;
+#define UNITY_TEST_ASSERT_INT32_ARRAY_SORTED(actual, num_elements, line, message)                if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_UINT(expected, actual, num_elements, line, message)         if (UnityAssertEachWithinRange((_U_SINT)(_U_UINT)(expected), (_U_SINT)(_U_UINT)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_UINT_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(_U_UINT)(low), (_U_SINT)(_U_UINT)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT) != 0) return;
+#define UNITY_TEST_ASSERT_UINT_ARRAY_SORTED(actual, num_elements, line, message)                 if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_UINT8(expected, actual, num_elements, line, message)        if (UnityAssertEachWithinRange((_U_SINT)(_UU8)(expected), (_U_SINT)(_UU8)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_UINT8_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(_UU8)(low), (_U_SINT)(_UU8)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8) != 0) return;
+#define UNITY_TEST_ASSERT_UINT8_ARRAY_SORTED(actual, num_elements, line, message)                if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_UINT16(expected, actual, num_elements, line, message)       if (UnityAssertEachWithinRange((_U_SINT)(_UU16)(expected), (_U_SINT)(_UU16)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_UINT16_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(_UU16)(low), (_U_SINT)(_UU16)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16) != 0) return;
+#define UNITY_TEST_ASSERT_UINT16_ARRAY_SORTED(actual, num_elements, line, message)               if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_UINT32(expected, actual, num_elements, line, message)       if (UnityAssertEachWithinRange((_U_SINT)(_UU32)(expected), (_U_SINT)(_UU32)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_UINT32_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(_UU32)(low), (_U_SINT)(_UU32)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32) != 0) return;
+#define UNITY_TEST_ASSERT_UINT32_ARRAY_SORTED(actual, num_elements, line, message)               if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_HEX8(expected, actual, num_elements, line, message)         if (UnityAssertEachWithinRange((_U_SINT)(_UU8)(expected), (_U_SINT)(_UU8)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_HEX8_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(_UU8)(low), (_U_SINT)(_UU8)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8) != 0) return;
+#define UNITY_TEST_ASSERT_HEX8_ARRAY_SORTED(actual, num_elements, line, message)                 if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_HEX16(expected, actual, num_elements, line, message)        if (UnityAssertEachWithinRange((_U_SINT)(_UU16)(expected), (_U_SINT)(_UU16)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_HEX16_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(_UU16)(low), (_U_SINT)(_UU16)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16) != 0) return;
+#define UNITY_TEST_ASSERT_HEX16_ARRAY_SORTED(actual, num_elements, line, message)                if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_HEX32(expected, actual, num_elements, line, message)        if (UnityAssertEachWithinRange((_U_SINT)(_UU32)(expected), (_U_SINT)(_UU32)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_HEX32_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(_UU32)(low), (_U_SINT)(_UU32)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32) != 0) return;
+#define UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED(actual, num_elements, line, message)                if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32) != 0) return;
 
 #ifdef UNITY_SUPPORT_64
 #define UNITY_TEST_ASSERT_EQUAL_INT64(expected, actual, line, message)                           if (UnityAssertEqualNumber((_U_SINT)(expected), (_U_SINT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64) != 0) return;
@@ -684,6 +1329,18 @@ extern const char UnityStrErr64[];
 #define UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY(expected, actual, num_elements, line, message)       if (UnityAssertEqualIntArray((UNITY_PTR_ATTRIBUTE const _U_SINT*)(expected), (UNITY_PTR_ATTRIBUTE const _U_SINT*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64) != 0) return;
 #define UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, actual, num_elements, line, message)      if (UnityAssertEqualIntArray((UNITY_PTR_ATTRIBUTE const _U_SINT*)(expected), (UNITY_PTR_ATTRIBUTE const _U_SINT*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64) != 0) return;
 #define UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY(expected, actual, num_elements, line, message)       if (UnityAssertEqualIntArray((UNITY_PTR_ATTRIBUTE const _U_SINT*)(expected), (UNITY_PTR_ATTRIBUTE const _U_SINT*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY_UNORDERED(expected, actual, num_elements, line, message) if (UnityAssertEqualIntArrayUnordered((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_INT64(expected, actual, num_elements, line, message)        if (UnityAssertEachWithinRange((_U_SINT)(expected), (_U_SINT)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_INT64_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(low), (_U_SINT)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64) != 0) return;
+#define UNITY_TEST_ASSERT_INT64_ARRAY_SORTED(actual, num_elements, line, message)                if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_UINT64(expected, actual, num_elements, line, message)       if (UnityAssertEachWithinRange((_U_SINT)(_UU64)(expected), (_U_SINT)(_UU64)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_UINT64_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(_UU64)(low), (_U_SINT)(_UU64)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64) != 0) return;
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_SORTED(actual, num_elements, line, message)               if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_EQUAL_HEX64(expected, actual, num_elements, line, message)        if (UnityAssertEachWithinRange((_U_SINT)(_UU64)(expected), (_U_SINT)(_UU64)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64) != 0) return;
+#define UNITY_TEST_ASSERT_EACH_HEX64_WITHIN_RANGE(low, high, actual, num_elements, line, message) if (UnityAssertEachWithinRange((_U_SINT)(_UU64)(low), (_U_SINT)(_UU64)(high), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64) != 0) return;
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_SORTED(actual, num_elements, line, message)                if (UnityAssertArraySorted((UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64) != 0) return;
 #define UNITY_TEST_ASSERT_INT64_WITHIN(delta, expected, actual, line, message)                   if (UnityAssertNumbersWithin((delta), (_U_SINT)(expected), (_U_SINT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64) != 0) return;
 #define UNITY_TEST_ASSERT_UINT64_WITHIN(delta, expected, actual, line, message)                  if (UnityAssertNumbersWithin((delta), (_U_SINT)(expected), (_U_SINT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64) != 0) return;
 #define UNITY_TEST_ASSERT_HEX64_WITHIN(delta, expected, actual, line, message)                   if (UnityAssertNumbersWithin((delta), (_U_SINT)(expected), (_U_SINT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64) != 0) return;
@@ -706,6 +1363,18 @@ extern const char UnityStrErr64[];
 #define UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY(expected, actual, num_elements, line, message)       UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
 #define UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, actual, num_elements, line, message)      UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
 #define UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY(expected, actual, num_elements, line, message)       UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY_UNORDERED(expected, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY_UNORDERED(expected, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY_UNORDERED(expected, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EACH_EQUAL_INT64(expected, actual, num_elements, line, message)        UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EACH_INT64_WITHIN_RANGE(low, high, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_SORTED(actual, num_elements, line, message)                UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EACH_EQUAL_UINT64(expected, actual, num_elements, line, message)       UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EACH_UINT64_WITHIN_RANGE(low, high, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_SORTED(actual, num_elements, line, message)               UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EACH_EQUAL_HEX64(expected, actual, num_elements, line, message)        UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EACH_HEX64_WITHIN_RANGE(low, high, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_SORTED(actual, num_elements, line, message)                UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
 #define UNITY_TEST_ASSERT_INT64_WITHIN(delta, expected, actual, line, message)                   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
 #define UNITY_TEST_ASSERT_UINT64_WITHIN(delta, expected, actual, line, message)                  UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
 #define UNITY_TEST_ASSERT_HEX64_WITHIN(delta, expected, actual, line, message)                   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
@@ -723,6 +1392,10 @@ extern const char UnityStrErr64[];
 #define UNITY_TEST_ASSERT_FLOAT_IS_NOT_NEG_INF(actual, line, message)                            if (UnityAssertFloatSpecial((_UF)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_NOT_NEG_INF) != 0) return;
 #define UNITY_TEST_ASSERT_FLOAT_IS_NOT_NAN(actual, line, message)                                if (UnityAssertFloatSpecial((_UF)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_NOT_NAN) != 0) return;
 #define UNITY_TEST_ASSERT_FLOAT_IS_NOT_DETERMINATE(actual, line, message)                        if (UnityAssertFloatSpecial((_UF)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_NOT_DET) != 0) return;
+#define UNITY_TEST_ASSERT_FLOAT_WITHIN_ULP(max_ulps, expected, actual, line, message)            if (UnityAssertFloatsWithinUlp((_UU32)(max_ulps), (_UF)(expected), (_UF)(actual), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#define UNITY_TEST_ASSERT_FLOAT_ARRAY_WITHIN_ULP(max_ulps, expected, actual, num_elements, line, message) if (UnityAssertFloatArrayWithinUlp((_UU32)(max_ulps), (UNITY_PTR_ATTRIBUTE const _UF*)(expected), (UNITY_PTR_ATTRIBUTE const _UF*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#define UNITY_TEST_ASSERT_FLOAT_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, line, message) if (UnityAssertFloatsWithinTolerance((_UF)(abs_tol), (_UF)(rel_tol), (_UF)(expected), (_UF)(actual), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#define UNITY_TEST_ASSERT_FLOAT_ARRAY_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, num_elements, line, message) if (UnityAssertFloatArrayWithinTolerance((_UF)(abs_tol), (_UF)(rel_tol), (UNITY_PTR_ATTRIBUTE const _UF*)(expected), (UNITY_PTR_ATTRIBUTE const _UF*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
 #else   // defined(UNITY_INCLUDE_FLOAT)
 #define UNITY_TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual, line, message)                   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
 #define UNITY_TEST_ASSERT_EQUAL_FLOAT(expected, actual, line, message)                           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
@@ -735,6 +1408,10 @@ extern const char UnityStrErr64[];
 #define UNITY_TEST_ASSERT_FLOAT_IS_NOT_NEG_INF(actual, line, message)                            UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
 #define UNITY_TEST_ASSERT_FLOAT_IS_NOT_NAN(actual, line, message)                                UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
 #define UNITY_TEST_ASSERT_FLOAT_IS_NOT_DETERMINATE(actual, line, message)                        UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
+#define UNITY_TEST_ASSERT_FLOAT_WITHIN_ULP(max_ulps, expected, actual, line, message)            UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
+#define UNITY_TEST_ASSERT_FLOAT_ARRAY_WITHIN_ULP(max_ulps, expected, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
+#define UNITY_TEST_ASSERT_FLOAT_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
+#define UNITY_TEST_ASSERT_FLOAT_ARRAY_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
 #endif  // defined(UNITY_INCLUDE_FLOAT)
 
 #if defined(UNITY_INCLUDE_DOUBLE)
@@ -749,6 +1426,15 @@ extern const char UnityStrErr64[];
 #define UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NEG_INF(actual, line, message)                           if (UnityAssertDoubleSpecial((_UD)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_NOT_NEG_INF) != 0) return;
 #define UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NAN(actual, line, message)                               if (UnityAssertDoubleSpecial((_UD)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_NOT_NAN) != 0) return;
 #define UNITY_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE(actual, line, message)                       if (UnityAssertDoubleSpecial((_UD)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_NOT_DET) != 0) return;
+#ifdef UNITY_SUPPORT_64
+#define UNITY_TEST_ASSERT_DOUBLE_WITHIN_ULP(max_ulps, expected, actual, line, message)           if (UnityAssertDoublesWithinUlp((_UU64)(max_ulps), (_UD)(expected), (_UD)(actual), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#define UNITY_TEST_ASSERT_DOUBLE_ARRAY_WITHIN_ULP(max_ulps, expected, actual, num_elements, line, message) if (UnityAssertDoubleArrayWithinUlp((_UU64)(max_ulps), (UNITY_PTR_ATTRIBUTE const _UD*)(expected), (UNITY_PTR_ATTRIBUTE const _UD*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#else
+#define UNITY_TEST_ASSERT_DOUBLE_WITHIN_ULP(max_ulps, expected, actual, line, message)           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_DOUBLE_ARRAY_WITHIN_ULP(max_ulps, expected, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#endif
+#define UNITY_TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, line, message) if (UnityAssertDoublesWithinTolerance((_UD)(abs_tol), (_UD)(rel_tol), (_UD)(expected), (_UD)(actual), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#define UNITY_TEST_ASSERT_DOUBLE_ARRAY_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, num_elements, line, message) if (UnityAssertDoubleArrayWithinTolerance((_UD)(abs_tol), (_UD)(rel_tol), (UNITY_PTR_ATTRIBUTE const _UD*)(expected), (UNITY_PTR_ATTRIBUTE const _UD*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
 #else   // defined(UNITY_INCLUDE_DOUBLE)
 #define UNITY_TEST_ASSERT_DOUBLE_WITHIN(delta, expected, actual, line, message)                  UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
 #define UNITY_TEST_ASSERT_EQUAL_DOUBLE(expected, actual, line, message)                          UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
@@ -761,6 +1447,115 @@ extern const char UnityStrErr64[];
 #define UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NEG_INF(actual, line, message)                           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
 #define UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NAN(actual, line, message)                               UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
 #define UNITY_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE(actual, line, message)                       UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
+#define UNITY_TEST_ASSERT_DOUBLE_WITHIN_ULP(max_ulps, expected, actual, line, message)           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
+#define UNITY_TEST_ASSERT_DOUBLE_ARRAY_WITHIN_ULP(max_ulps, expected, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
+#define UNITY_TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
+#define UNITY_TEST_ASSERT_DOUBLE_ARRAY_WITHIN_TOLERANCE(abs_tol, rel_tol, expected, actual, num_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
 #endif  // defined(UNITY_INCLUDE_DOUBLE)
 
+#ifdef UNITY_INCLUDE_DIGEST
+#define UNITY_TEST_ASSERT_MEMORY_CRC32(expected, actual, len, line, message)                     if (UnityAssertMemoryDigest((_U_UINT)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(len), (message), (UNITY_LINE_TYPE)(line), UNITY_DIGEST_CRC32) != 0) return;
+#define UNITY_TEST_ASSERT_MEMORY_CRC32_BLOCKS(expected, actual, len, block_size, line, message)  if (UnityAssertMemoryDigestBlocks((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(len), (_UU32)(block_size), (message), (UNITY_LINE_TYPE)(line), UNITY_DIGEST_CRC32) != 0) return;
+#ifdef UNITY_SUPPORT_64
+#define UNITY_TEST_ASSERT_MEMORY_XXH64(expected, actual, len, line, message)                     if (UnityAssertMemoryDigest((_U_UINT)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(len), (message), (UNITY_LINE_TYPE)(line), UNITY_DIGEST_XXH64) != 0) return;
+#define UNITY_TEST_ASSERT_MEMORY_XXH64_BLOCKS(expected, actual, len, block_size, line, message)  if (UnityAssertMemoryDigestBlocks((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(len), (_UU32)(block_size), (message), (UNITY_LINE_TYPE)(line), UNITY_DIGEST_XXH64) != 0) return;
+#else
+#define UNITY_TEST_ASSERT_MEMORY_XXH64(expected, actual, len, line, message)                     UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_MEMORY_XXH64_BLOCKS(expected, actual, len, block_size, line, message)  UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#endif
+#else
+#define UNITY_TEST_ASSERT_MEMORY_CRC32(expected, actual, len, line, message)                     UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDigest)
+#define UNITY_TEST_ASSERT_MEMORY_CRC32_BLOCKS(expected, actual, len, block_size, line, message)  UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDigest)
+#define UNITY_TEST_ASSERT_MEMORY_XXH64(expected, actual, len, line, message)                     UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDigest)
+#define UNITY_TEST_ASSERT_MEMORY_XXH64_BLOCKS(expected, actual, len, block_size, line, message)  UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDigest)
+#endif  // defined(UNITY_INCLUDE_DIGEST)
+
+#ifdef UNITY_INCLUDE_FILE
+#define UNITY_TEST_ASSERT_EQUAL_FILE(path, actual, len, line, message)                           if (UnityAssertEqualFile((path), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(len), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#define UNITY_TEST_ASSERT_FILES_EQUAL(expected_path, actual_path, line, message)                 if (UnityAssertFilesEqual((expected_path), (actual_path), (message), (UNITY_LINE_TYPE)(line)) != 0) return;
+#else
+#define UNITY_TEST_ASSERT_EQUAL_FILE(path, actual, len, line, message)                           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFile)
+#define UNITY_TEST_ASSERT_FILES_EQUAL(expected_path, actual_path, line, message)                 UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFile)
+#endif  // defined(UNITY_INCLUDE_FILE)
+
+#ifdef UNITY_SUPPORT_GENERIC
+//The display style of a value, from its type.  Enums get the style of the int they promote to, pointers (and the rest) UNITY_DISPLAY_STYLE_POINTER
+#define UNITY_GENERIC_SIGNED(type)      ((UNITY_DISPLAY_STYLE_T)(sizeof(type) + UNITY_DISPLAY_RANGE_INT))
+#define UNITY_GENERIC_UNSIGNED(type)    ((UNITY_DISPLAY_STYLE_T)(sizeof(type) + UNITY_DISPLAY_RANGE_UINT))
+#define UNITY_GENERIC_PROMOTED(value)   (1 ? (value) : 0)
+#ifdef UNITY_SUPPORT_64
+#define UNITY_GENERIC_STYLES_64         long long: UNITY_GENERIC_SIGNED(long long), unsigned long long: UNITY_GENERIC_UNSIGNED(unsigned long long),
+#define UNITY_GENERIC_NUMBERS_64        long long: UnityAssertEqualGenericNumber, unsigned long long: UnityAssertEqualGenericNumber,
+#else
+#define UNITY_GENERIC_STYLES_64
+#define UNITY_GENERIC_NUMBERS_64
+#endif
+#ifdef UNITY_INCLUDE_FLOAT
+#define UNITY_GENERIC_FLOAT             float: UnityAssertEqualGenericFloat,
+#define UNITY_GENERIC_FLOAT_ARRAY       float: UnityAssertEqualGenericFloatArray,
+#else
+//Left to the integer loops a float array would be compared bit for bit, so it goes to a function that takes no arguments and the call does not compile
+UNITY_BOOL UnityGenericFloatArrayNeedsUNITY_INCLUDE_FLOAT(void);
+#define UNITY_GENERIC_FLOAT
+#define UNITY_GENERIC_FLOAT_ARRAY       float: UnityGenericFloatArrayNeedsUNITY_INCLUDE_FLOAT,
+#endif
+#ifdef UNITY_INCLUDE_DOUBLE
+#define UNITY_GENERIC_DOUBLE            double: UnityAssertEqualGenericDouble,
+#define UNITY_GENERIC_DOUBLE_ARRAY      double: UnityAssertEqualGenericDoubleArray,
+#else
+UNITY_BOOL UnityGenericDoubleArrayNeedsUNITY_INCLUDE_DOUBLE(void);
+#define UNITY_GENERIC_DOUBLE
+#define UNITY_GENERIC_DOUBLE_ARRAY      double: UnityGenericDoubleArrayNeedsUNITY_INCLUDE_DOUBLE,
+#endif
+
+#define UNITY_GENERIC_STYLE(value) _Generic((value),                                                   \
+    char:               (((char)-1 < 0) ? UNITY_GENERIC_SIGNED(char) : UNITY_GENERIC_UNSIGNED(char)), \
+    signed char:        UNITY_GENERIC_SIGNED(signed char),                                            \
+    unsigned char:      UNITY_GENERIC_UNSIGNED(unsigned char),                                        \
+    short:              UNITY_GENERIC_SIGNED(short),                                                  \
+    unsigned short:     UNITY_GENERIC_UNSIGNED(unsigned short),                                       \
+    int:                UNITY_GENERIC_SIGNED(int),                                                    \
+    unsigned int:       UNITY_GENERIC_UNSIGNED(unsigned int),                                         \
+    long:               UNITY_GENERIC_SIGNED(long),                                                   \
+    unsigned long:      UNITY_GENERIC_UNSIGNED(unsigned long),                                        \
+    UNITY_GENERIC_STYLES_64                                                                           \
+    _Bool:              UNITY_GENERIC_UNSIGNED(_Bool),                                                \
+    default:            _Generic(UNITY_GENERIC_PROMOTED(value),                                       \
+                            int:          UNITY_GENERIC_SIGNED(int),                                  \
+                            unsigned int: UNITY_GENERIC_UNSIGNED(unsigned int),                       \
+                            default:      UNITY_DISPLAY_STYLE_POINTER))
+
+//The assertion for a value, from its type after promotion (so enums, chars and shorts compare as numbers)
+#define UNITY_GENERIC_EQUAL(value) _Generic(UNITY_GENERIC_PROMOTED(value),                             \
+    int:                UnityAssertEqualGenericNumber,                                                \
+    unsigned int:       UnityAssertEqualGenericNumber,                                                \
+    long:               UnityAssertEqualGenericNumber,                                                \
+    unsigned long:      UnityAssertEqualGenericNumber,                                                \
+    UNITY_GENERIC_NUMBERS_64                                                                          \
+    UNITY_GENERIC_FLOAT                                                                               \
+    UNITY_GENERIC_DOUBLE                                                                              \
+    char*:              UnityAssertEqualGenericString,                                                \
+    const char*:        UnityAssertEqualGenericString,                                                \
+    default:            UnityAssertEqualGenericPointer)
+
+//The array assertion, from the type of one element.  Integer and pointer elements go straight to the loop for their width
+#if defined(UNITY_SUPPORT_64)
+#define UNITY_GENERIC_INT_ARRAY(element) ((sizeof(element) == 1) ? UnityAssertEqualIntArray8 : (sizeof(element) == 2) ? UnityAssertEqualIntArray16 : (sizeof(element) == 4) ? UnityAssertEqualIntArray32 : UnityAssertEqualIntArray64)
+#else
+#define UNITY_GENERIC_INT_ARRAY(element) ((sizeof(element) == 1) ? UnityAssertEqualIntArray8 : (sizeof(element) == 2) ? UnityAssertEqualIntArray16 : UnityAssertEqualIntArray32)
+#endif
+#define UNITY_GENERIC_EQUAL_ARRAY(element) _Generic(UNITY_GENERIC_PROMOTED(element),                   \
+    UNITY_GENERIC_FLOAT_ARRAY                                                                         \
+    UNITY_GENERIC_DOUBLE_ARRAY                                                                        \
+    char*:              UnityAssertEqualGenericStringArray,                                           \
+    const char*:        UnityAssertEqualGenericStringArray,                                           \
+    default:            UNITY_GENERIC_INT_ARRAY(element))
+
+#define UNITY_TEST_ASSERT_EQUAL(expected, actual, line, message)                                 if (UNITY_GENERIC_EQUAL(actual)((expected), (actual), (message), (UNITY_LINE_TYPE)(line), UNITY_GENERIC_STYLE(actual)) != 0) return;
+#define UNITY_TEST_ASSERT_EQUAL_ARRAY(expected, actual, num_elements, line, message)             if (UNITY_GENERIC_EQUAL_ARRAY((actual)[0])((UNITY_PTR_ATTRIBUTE const void*)(expected), (UNITY_PTR_ATTRIBUTE const void*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_GENERIC_STYLE((actual)[0])) != 0) return;
+#else
+#define UNITY_TEST_ASSERT_EQUAL(expected, actual, line, message)                                 UNITY_TEST_ASSERT_EQUAL_INT((expected), (actual), (line), (message))
+#define UNITY_TEST_ASSERT_EQUAL_ARRAY(expected, actual, num_elements, line, message)             UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrGeneric)
+#endif  // defined(UNITY_SUPPORT_GENERIC)
+
 #endif
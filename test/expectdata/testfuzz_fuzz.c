@@ -0,0 +1,160 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=============CLRWDT macro for XC8 only=============
+#if defined(__XC8)
+#define ClearWDT() CLRWDT()
+#else   // defined(__XC8)
+#define ClearWDT()
+#endif  // defined(__XC8)
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      if (Unity.setUp) \
+      { \
+        Unity.setUp(); \
+      } \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    if (Unity.tearDown) \
+    { \
+      Unity.tearDown(); \
+    } \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#if defined(__XC8)
+#include <xc.h>
+#else   // defined(__XC8)
+#include <setjmp.h>
+#endif  // defined(__XC8)
+#include <stdio.h>
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ParserAcceptsAnEmptyString(void);
+extern void test_ParserNeverOverruns(const unsigned char* data, size_t size);
+extern void test_ParserIgnoresTrailingBytes(const unsigned char* data, size_t size);
+
+
+//=======Test Reset Option=====
+void resetTest()
+{
+  if (Unity.tearDown)
+  {
+    Unity.tearDown();
+  }
+  if (Unity.setUp)
+  {
+    Unity.setUp();
+  }
+}
+
+//=======Fuzz Test Runner=====
+#define RUN_FUZZ_TEST(TestFunc, TestLineNum, TestName, Data, Size) \
+{ \
+  Unity.CurrentTestName = TestName; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      if (Unity.setUp) \
+      { \
+        Unity.setUp(); \
+      } \
+      TestFunc(Data, Size); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    if (Unity.tearDown) \
+    { \
+      Unity.tearDown(); \
+    } \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Fuzz Corpus=====
+#if !defined(UNITY_FUZZ)
+static const unsigned char test_ParserNeverOverruns_corpus0[] = {
+  0x47, 0x45, 0x54,
+};
+static const unsigned char test_ParserNeverOverruns_corpus1[] = {
+  0x00, 0xFF, 0x10, 0x20,
+};
+#endif  // !defined(UNITY_FUZZ)
+
+//=======Fuzzer Entry Point=====
+#if defined(UNITY_FUZZ)
+#include <stdlib.h>
+#ifndef UNITY_FUZZ_TARGET
+#define UNITY_FUZZ_TARGET test_ParserNeverOverruns
+#endif
+#define UNITY_FUZZ_NAME(TestFunc) UNITY_FUZZ_NAME_(TestFunc)
+#define UNITY_FUZZ_NAME_(TestFunc) #TestFunc
+int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size);
+int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size)
+{
+  static int started = 0;
+  if (!started)
+  {
+    UnityBegin("test/testdata/testfuzz.c",setUp,tearDown);
+    Unity.CurrentTestName = UNITY_FUZZ_NAME(UNITY_FUZZ_TARGET);
+    started = 1;
+  }
+  if (Unity.setUp)
+  {
+    Unity.setUp();
+  }
+  UNITY_FUZZ_TARGET(data, size);
+  if (!TEST_IS_IGNORED)
+  {
+    if (Unity.tearDown)
+    {
+      Unity.tearDown();
+    }
+  }
+  if (Unity.CurrentTestFailed)
+  {
+    UNITY_OUTPUT_COMPLETE();
+    fflush(stdout);
+    abort();
+  }
+  Unity.CurrentTestIgnored = 0;
+  return 0;
+}
+#endif  // defined(UNITY_FUZZ)
+
+
+//=======MAIN=====
+#if !defined(UNITY_FUZZ)
+#if defined(__XC8)
+void main(void)
+#else   // defined(__XC8)
+int main(void)
+#endif  // defined(__XC8)
+{
+  UnityBegin("test/testdata/testfuzz.c",setUp,tearDown);
+  RUN_TEST(test_ParserAcceptsAnEmptyString, 16);
+  RUN_FUZZ_TEST(test_ParserNeverOverruns, 21, "test_ParserNeverOverruns(seed1)", test_ParserNeverOverruns_corpus0, 3);
+  RUN_FUZZ_TEST(test_ParserNeverOverruns, 21, "test_ParserNeverOverruns(seed2)", test_ParserNeverOverruns_corpus1, 4);
+  RUN_FUZZ_TEST(test_ParserIgnoresTrailingBytes, 26, "test_ParserIgnoresTrailingBytes", (const unsigned char*)"", 0);
+
+#if defined(__XC8)
+  (UnityEnd());
+#else   // defined(__XC8)
+  return (UnityEnd());
+#endif  // defined(__XC8)
+}
+#endif  // !defined(UNITY_FUZZ)
@@ -0,0 +1,58 @@
+# ==========================================
+#   Unity Project - A Test Framework for C
+#   Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+#   [Released under MIT License. Please refer to license.txt for details]
+# ==========================================
+
+ruby_version = RUBY_VERSION.split('.')
+if (ruby_version[1].to_i == 9) and (ruby_version[2].to_i > 1)
+  require 'rubygems'
+  gem 'test-unit'
+end
+require 'test/unit'
+require './auto/csv_to_table.rb'
+
+TABLE_CSV = 'test/testdata/table.csv'
+TABLE_OUT = 'build/table'
+
+class TestCsvToTable < Test::Unit::TestCase
+  def setup
+  end
+
+  def teardown
+  end
+
+  # Reads the rows back with the offsets a C compiler gives the generated struct
+  def test_ShouldRoundTripACsvFile
+    UnityTableConverter.new(TABLE_CSV).write_table(TABLE_OUT + '.bin')
+    table = File.binread(TABLE_OUT + '.bin')
+
+    magic, count, row_size, first_row = table.unpack('a4L<3')
+    assert_equal('UDT1', magic)
+    assert_equal(3, count)
+    assert_equal(32, row_size)
+    assert_equal(0, first_row % 8)
+    assert_equal(File.read(TABLE_CSV).lines.first.strip, table[16, first_row - 16].unpack('Z*').first)
+    assert_equal(first_row + count * row_size, table.bytesize)
+
+    rows = (0...count).map { |i| table[first_row + i * row_size, row_size].unpack('S<cx5EL<a5') }
+    assert_equal([1, -1, 0.5, 16, "one\0\0"], rows[0])
+    assert_equal([65535, 127, -Float::INFINITY, 4294967295, 'three'], rows[1])
+    assert_equal([0, -128], rows[2][0, 2])
+    assert(rows[2][2].nan?)
+    assert_equal([0, "\0" * 5], rows[2][3, 2])
+  end
+
+  def test_ShouldWriteTheMatchingStruct
+    UnityTableConverter.new(TABLE_CSV).write_header(TABLE_OUT + '.h', 'table_row')
+    header = File.read(TABLE_OUT + '.h')
+    assert_match(/typedef struct table_row\n\{\n    uint16_t id;\n    int8_t offset;\n    double scale;\n    uint32_t count;\n    char label\[5\];\n\} table_row_t;/, header)
+  end
+
+  def test_ShouldRejectValuesThatDoNotFit
+    File.open(TABLE_OUT + '.csv', 'w') { |file| file.puts('small:u8', '256') }
+    error = assert_raise(RuntimeError) { UnityTableConverter.new(TABLE_OUT + '.csv').write_table(TABLE_OUT + '.bin') }
+    assert_match(/Line 2: 256 does not fit in u8/, error.message)
+  end
+
+end
@@ -14,6 +14,7 @@ require './auto/generate_test_runner.rb'
 
 TEST_FILE = 'test/testdata/testsample.c'
 TEST_MOCK = 'test/testdata/mocksample.c'
+TEST_FUZZ = 'test/testdata/testfuzz.c'
 OUT_FILE  = 'build/testsample_'
 EXP_FILE  = 'test/expectdata/testsample_'
 
@@ -91,4 +92,11 @@ class TestGenerateTestRunner < Test::Unit::TestCase
     end
   end
   
+  def test_ShouldGenerateARunnerThatReplaysFuzzCorpus
+    UnityTestRunnerGenerator.new(:fuzz_corpus => 'test/testdata/corpus').run(TEST_FUZZ, 'build/testfuzz_fuzz.c')
+    expected = File.read('test/expectdata/testfuzz_fuzz.c').gsub(/\r\n/,"\n")
+    actual   = File.read('build/testfuzz_fuzz.c').gsub(/\r\n/,"\n")
+    assert_equal(expected, actual, "Generated File Sub-Test 'fuzz' Failed")
+  end
+  
 end
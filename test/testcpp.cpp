@@ -0,0 +1,250 @@
+/* ==========================================
+    Unity Project - A Test Framework for C
+    Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+    [Released under MIT License. Please refer to license.txt for details]
+========================================== */
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Build with -DUNITY_OUTPUT_CHAR=putcharSpy to let the tests below check what Unity prints
+#ifdef UNITY_OUTPUT_CHAR
+#define USING_OUTPUT_SPY
+#endif
+
+#include "unity.hpp"
+
+#define EXPECT_ABORT_BEGIN \
+    if (TEST_PROTECT())    \
+    {
+
+#define VERIFY_FAILS_END                                                       \
+    }                                                                          \
+    Unity.CurrentTestFailed = (Unity.CurrentTestFailed == 1) ? 0 : 1;          \
+    if (Unity.CurrentTestFailed == 1) {                                        \
+      SetToOneMeanWeAlreadyCheckedThisGuy = 1;                                 \
+      UnityPrint("[[[[ Previous Test Should Have Failed But Did Not ]]]]");    \
+      UNITY_OUTPUT_CHAR('\n');                                                 \
+    }
+
+int SetToOneMeanWeAlreadyCheckedThisGuy;
+
+void setUp(void)
+{
+  SetToOneMeanWeAlreadyCheckedThisGuy = 0;
+}
+
+void tearDown(void)
+{
+  if ((SetToOneMeanWeAlreadyCheckedThisGuy == 0) && (Unity.CurrentTestFailed > 0))
+  {
+    UnityPrint("[[[[ Previous Test Should Have Passed But Did Not ]]]]");
+    UNITY_OUTPUT_CHAR('\n');
+  }
+}
+
+#define SPY_BUFFER_MAX 256
+
+#ifdef USING_OUTPUT_SPY
+static char putcharSpyBuffer[SPY_BUFFER_MAX];
+static int putcharSpyLength;
+static int putcharSpyEnabled;
+
+// while enabled, output is kept instead of printed
+static void startPutcharSpy(void)
+{
+    putcharSpyLength = 0;
+    putcharSpyBuffer[0] = 0;
+    putcharSpyEnabled = 1;
+}
+
+static void endPutcharSpy(void)
+{
+    putcharSpyEnabled = 0;
+}
+
+// declared with C linkage by unity.h, since unity.c calls it
+int putcharSpy(int c)
+{
+    if (!putcharSpyEnabled)
+        return putchar(c);
+    if (putcharSpyLength < (SPY_BUFFER_MAX - 1))
+    {
+        putcharSpyBuffer[putcharSpyLength++] = (char)c;
+        putcharSpyBuffer[putcharSpyLength] = 0;
+    }
+    return c;
+}
+
+// the failure message does not contain the expected text
+static int messageLacks(const char* expected)
+{
+    return strstr(putcharSpyBuffer, expected) == NULL;
+}
+#else
+static void startPutcharSpy(void) {}
+static void endPutcharSpy(void) {}
+static int messageLacks(const char*) { return 0; }
+#endif
+
+struct Point
+{
+    int x;
+    int y;
+};
+
+static bool operator==(const Point& a, const Point& b) { return (a.x == b.x) && (a.y == b.y); }
+
+template <>
+struct unity::Formatter<Point>
+{
+    static void Print(const Point& p) { UnityPrintNumber(p.x); UnityPrint(","); UnityPrintNumber(p.y); }
+};
+
+enum class Colour : unsigned char { Red = 1, Green = 2 };
+
+void testEqIntegersOfAnyWidthAndSignedness(void)
+{
+    const signed char small = -5;
+    const unsigned short unsignedShort = 65535u;
+
+    TEST_ASSERT_EQ(5, 5u);
+    TEST_ASSERT_EQ(-5, small);
+    TEST_ASSERT_EQ(65535, unsignedShort);
+    TEST_ASSERT_EQ((unsigned char)200, 200LL);
+    TEST_ASSERT_EQ(true, true);
+    TEST_ASSERT_EQ(Colour::Green, Colour::Green);
+}
+
+void testEqIntegersCompareByValue(void)
+{
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    unity::AssertEqual(-1, 0xFFFFFFFFu, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+    TEST_ASSERT_FALSE(messageLacks(" Expected -1 Was 4294967295"));
+#ifdef UNITY_SUPPORT_64
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    unity::AssertEqual((long long)-1, ~0ull, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+    TEST_ASSERT_FALSE(messageLacks(" Expected -1 Was 18446744073709551615"));
+#endif
+}
+
+void testEqFloatsWithinPrecision(void)
+{
+#ifndef UNITY_INCLUDE_FLOAT
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_EQ(1.0f, 1.000001f);
+    TEST_ASSERT_EQ(3, 3.0f);
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    unity::AssertEqual(1.0f, 1.001f, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+#endif
+}
+
+void testEqDoublesWithinPrecision(void)
+{
+#ifndef UNITY_INCLUDE_DOUBLE
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_EQ(-2.5, -2.50000000000001);
+    TEST_ASSERT_EQ(3.0, 3);
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    unity::AssertEqual(-2.5, -2.5000001, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+#endif
+}
+
+void testEqStringsInAnyMix(void)
+{
+    const char text[] = "unity";
+    const std::string copy("unity");
+
+    TEST_ASSERT_EQ("unity", copy);
+    TEST_ASSERT_EQ(copy, text);
+    TEST_ASSERT_EQ(std::string("a\0b", 3), std::string("a\0b", 3));
+#if __cplusplus >= 201703L
+    TEST_ASSERT_EQ(std::string_view("unity framework", 5), text);
+#endif
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    unity::AssertEqual(copy, "unify", NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+    TEST_ASSERT_FALSE(messageLacks(" Expected 'unity' Was 'unify'"));
+}
+
+void testEqNullStrings(void)
+{
+    const char* nothing = nullptr;
+
+    TEST_ASSERT_EQ(nothing, nothing);
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    unity::AssertEqual(nothing, "", NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+}
+
+void testEqRangesElementByElement(void)
+{
+    const int array[] = {1, 2, 3};
+    const std::array<long, 3> fixed = {{1, 2, 3}};
+    const std::vector<unsigned> growing = {1, 2, 3};
+
+    TEST_ASSERT_EQ(array, fixed);
+    TEST_ASSERT_EQ(fixed, growing);
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    unity::AssertEqual(growing, std::vector<int>{1, 2, 4}, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+    TEST_ASSERT_FALSE(messageLacks(" Element 2 Expected 3 Was 4"));
+}
+
+void testEqRangesOfDifferentSizes(void)
+{
+    const std::vector<int> shorter = {1, 2};
+    const std::vector<int> longer = {1, 2, 3};
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    unity::AssertEqual(shorter, longer, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+    TEST_ASSERT_FALSE(messageLacks(" Expected 2 Elements Was 3"));
+}
+
+void testEqUserTypeWithFormatter(void)
+{
+    const Point here = {3, -4};
+    const Point there = {3, 4};
+
+    TEST_ASSERT_EQ(here, (Point{3, -4}));
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    unity::AssertEqual(here, there, "points", __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+    TEST_ASSERT_FALSE(messageLacks(" Expected 3,-4 Was 3,4"));
+    TEST_ASSERT_FALSE(messageLacks("points"));
+}
@@ -0,0 +1,31 @@
+// This is just a sample test file to be used to test the generator script with fuzz tests
+#ifndef TEST_FUZZ_SAMPLE_H
+#define TEST_FUZZ_SAMPLE_H
+
+#include "unity.h"
+#include "parser.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_ParserAcceptsAnEmptyString(void)
+{
+    TEST_ASSERT_EQUAL(0, ParseLength((const unsigned char*)"", 0));
+}
+
+TEST_FUZZ(test_ParserNeverOverruns, data, size)
+{
+    TEST_ASSERT(ParseLength(data, size) <= size);
+}
+
+TEST_FUZZ(test_ParserIgnoresTrailingBytes, data, size)
+{
+    ParseLength(data, size);
+}
+
+#endif //TEST_FUZZ_SAMPLE_H
@@ -9,6 +9,10 @@
 
 #define TEST_CASE(...)
 
+// passthroughs for builds that route output through testunity.c's spies
+int putcharSpy(int c) { return putchar(c); }
+int junitPutcharSpy(int c) { return c; }
+
 #define EXPECT_ABORT_BEGIN \
     if (TEST_PROTECT())    \
     {
@@ -4,14 +4,36 @@
     [Released under MIT License. Please refer to license.txt for details]
 ========================================== */
 
+#if (defined(UNITY_INCLUDE_FILE) || defined(UNITY_INCLUDE_CONCURRENT)) && defined(__unix__) && !defined(_POSIX_C_SOURCE)
+// setenv and unsetenv, to turn on UNITY_UPDATE_GOLDEN for a single test, and sched_yield
+#define _POSIX_C_SOURCE 200112L
+#endif
 #include <setjmp.h>
+#include <string.h>
+#include <float.h>
+#ifdef UNITY_INCLUDE_FILE
+#include <stdlib.h>
+#endif
+#ifdef UNITY_INCLUDE_CONCURRENT
+#include <sched.h>
+#endif
+
+// Build with -DUNITY_OUTPUT_CHAR=putcharSpy (and -DUNITY_JUNIT_OUTPUT_CHAR=junitPutcharSpy
+// with UNITY_OUTPUT_JUNIT) to let the tests below check what Unity prints
+#ifdef UNITY_OUTPUT_CHAR
+#define USING_OUTPUT_SPY
+#endif
+#if defined(UNITY_OUTPUT_JUNIT) && defined(UNITY_JUNIT_OUTPUT_CHAR)
+#define USING_JUNIT_SPY
+#endif
+
 #include "unity.h"
 
 // Dividing by these constants produces +/- infinity.
 // The rationale is given in UnityAssertFloatIsInf's body.
-static const _UF f_zero = 0.0f;
+static const _UF f_zero_test = 0.0f;
 #ifndef UNITY_EXCLUDE_DOUBLE
-static const _UD d_zero = 0.0;
+static const _UD d_zero_test = 0.0;
 #endif
 
 #define EXPECT_ABORT_BEGIN \
@@ -55,7 +77,68 @@ void tearDown(void)
     UnityPrint("[[[[ Previous Test Should Have Passed But Did Not ]]]]");
     UNITY_OUTPUT_CHAR('\n');
   }
+#ifdef UNITY_INCLUDE_FILE
+  remove("testunity_golden.txt");
+#endif
+}
+
+#define SPY_BUFFER_MAX 1024
+
+#ifdef USING_OUTPUT_SPY
+static char putcharSpyBuffer[SPY_BUFFER_MAX];
+static int putcharSpyLength;
+static int putcharSpyEnabled;
+
+// while enabled, output is kept instead of printed
+void startPutcharSpy(void)
+{
+    putcharSpyLength = 0;
+    putcharSpyBuffer[0] = 0;
+    putcharSpyEnabled = 1;
+}
+
+void endPutcharSpy(void)
+{
+    putcharSpyEnabled = 0;
+}
+
+const char* getBufferPutcharSpy(void)
+{
+    return putcharSpyBuffer;
+}
+
+int putcharSpy(int c)
+{
+    if (!putcharSpyEnabled)
+        return putchar(c);
+    if (putcharSpyLength < (SPY_BUFFER_MAX - 1))
+    {
+        putcharSpyBuffer[putcharSpyLength++] = (char)c;
+        putcharSpyBuffer[putcharSpyLength] = 0;
+    }
+    return c;
+}
+#else
+void startPutcharSpy(void) {}
+void endPutcharSpy(void) {}
+#endif
+
+#ifdef USING_JUNIT_SPY
+static char junitSpyBuffer[SPY_BUFFER_MAX];
+static int junitSpyLength;
+static int junitSpyEnabled;
+
+// the report is only kept while a test is looking at it
+int junitPutcharSpy(int c)
+{
+    if (junitSpyEnabled && (junitSpyLength < (SPY_BUFFER_MAX - 1)))
+    {
+        junitSpyBuffer[junitSpyLength++] = (char)c;
+        junitSpyBuffer[junitSpyLength] = 0;
+    }
+    return c;
 }
+#endif
 
 void testUnitySizeInitializationReminder(void)
 {
@@ -1482,6 +1565,319 @@ void testNotEqualMemory4(void)
     VERIFY_FAILS_END
 }
 
+void testNotEqualMemoryManyMismatches(void)
+{
+    unsigned char p0[200];
+    unsigned char p1[200];
+    int i;
+
+    for (i = 0; i < 200; i++)
+    {
+        p0[i] = (unsigned char)i;
+        p1[i] = (unsigned char)(((i % 7) == 0) ? ~i : i);
+    }
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualMemory(p0, p1, 200, 1, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+#if defined(UNITY_REPORT_ALL_MISMATCHES) && defined(USING_OUTPUT_SPY)
+    // every seventh byte differs: 29 single-byte ranges, only the first 8 are listed
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(),
+        " Byte 0 Expected 0x00 Was 0xFF Mismatched At 0, 7, 14, 21, 28, 35, 42, 49, ... Total 29"));
+#endif
+}
+
+void testNotEqualMemoryOnlyLastByte(void)
+{
+    unsigned char p0[200] = {0};
+    unsigned char p1[200] = {0};
+
+    p1[199] = 1;
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualMemory(p0, p1, 200, 1, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+#if defined(UNITY_REPORT_ALL_MISMATCHES) && defined(USING_OUTPUT_SPY)
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " Byte 199 Expected 0x00 Was 0x01 Mismatched At 199 Total 1"));
+    TEST_ASSERT_NULL(strstr(getBufferPutcharSpy(), ", ..."));
+#endif
+}
+
+void testNotEqualIntArraysAllMismatches(void)
+{
+    int p0[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+    int p1[] = {1, 9, 9, 4, 0, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+    int p2[] = {0, 2, 0, 4, 0, 6, 0, 8, 0, 10, 0, 12, 0, 14, 0, 16, 0, 18, 0, 20};
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualIntArray(p0, p1, 20, NULL, __LINE__, UNITY_DISPLAY_STYLE_INT);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+#if defined(UNITY_REPORT_ALL_MISMATCHES) && defined(USING_OUTPUT_SPY)
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " Element 1 Expected 2 Was 9 Mismatched At 1-2, 4 Total 3"));
+    TEST_ASSERT_NULL(strstr(getBufferPutcharSpy(), ", ..."));
+#endif
+
+    // ranges past the eighth are only counted
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualIntArray(p0, p2, 20, NULL, __LINE__, UNITY_DISPLAY_STYLE_INT);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+#if defined(UNITY_REPORT_ALL_MISMATCHES) && defined(USING_OUTPUT_SPY)
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(),
+        " Element 0 Expected 1 Was 0 Mismatched At 0, 2, 4, 6, 8, 10, 12, 14, ... Total 10"));
+#endif
+}
+
+void testNotEqualMemoryPrintsDiffWindow(void)
+{
+#if !defined(UNITY_MEMORY_DIFF) || !defined(USING_OUTPUT_SPY)
+    TEST_IGNORE();
+#else
+    unsigned char p0[64];
+    unsigned char p1[64];
+    int i;
+
+    for (i = 0; i < 64; i++)
+    {
+        p0[i] = (unsigned char)('0' + i);
+        p1[i] = p0[i];
+    }
+    p1[40] = 'x';
+    p1[43] = 0;
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualMemory(p0, p1, 64, 1, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+    // the rows around byte 40, whole rows only, with both differences marked
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(),
+        "\n    Offset      Expected                  Actual"
+        "\n    0x00000018  48 49 4A 4B 4C 4D 4E 4F   48 49 4A 4B 4C 4D 4E 4F  |HIJKLMNO|HIJKLMNO|"
+        "\n    0x00000020  50 51 52 53 54 55 56 57   50 51 52 53 54 55 56 57  |PQRSTUVW|PQRSTUVW|"
+        "\n    0x00000028 *58 59 5A*5B 5C 5D 5E 5F  *78 59 5A*00 5C 5D 5E 5F  |XYZ[\\]^_|xYZ.\\]^_|"
+        "\n    0x00000030  60 61 62 63 64 65 66 67   60 61 62 63 64 65 66 67  |`abcdefg|`abcdefg|"));
+    TEST_ASSERT_NULL(strstr(getBufferPutcharSpy(), "0x00000010 "));
+    TEST_ASSERT_NULL(strstr(getBufferPutcharSpy(), "0x00000038 "));
+#endif
+}
+
+void testNotEqualMemoryDiffPadsLastRow(void)
+{
+#if !defined(UNITY_MEMORY_DIFF) || !defined(USING_OUTPUT_SPY)
+    TEST_IGNORE();
+#else
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualMemory("0123456789", "012345678X", 10, 1, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(),
+        "\n    0x00000000  30 31 32 33 34 35 36 37   30 31 32 33 34 35 36 37  |01234567|01234567|"
+        "\n    0x00000008  38*39                     38*58                    |89      |8X      |"));
+#endif
+}
+
+void testMemoryCrc32(void)
+{
+#ifndef UNITY_INCLUDE_DIGEST
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_MEMORY_CRC32(0xCBF43926, "123456789", 9);
+    TEST_ASSERT_MEMORY_CRC32(0x00000000, "", 0);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, UnityCrc32("123456789", 9));
+#endif
+}
+
+void testMemoryCrc32Mismatch(void)
+{
+#ifndef UNITY_INCLUDE_DIGEST
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityAssertMemoryDigest(0xCBF43926, "123456780", 9, NULL, __LINE__, UNITY_DIGEST_CRC32);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testMemoryCrc32Blocks(void)
+{
+#ifndef UNITY_INCLUDE_DIGEST
+    TEST_IGNORE();
+#else
+    unsigned char p0[100];
+    _UU32 digests[4];
+    int i;
+
+    for (i = 0; i < 100; i++)
+        p0[i] = (unsigned char)(i * 3);
+    for (i = 0; i < 4; i++)
+        digests[i] = UnityCrc32(&p0[i * 32], (i == 3) ? 4 : 32);
+
+    TEST_ASSERT_MEMORY_CRC32_BLOCKS(digests, p0, 100, 32);
+
+    p0[99] = 0;
+    EXPECT_ABORT_BEGIN
+    UnityAssertMemoryDigestBlocks(digests, p0, 100, 32, NULL, __LINE__, UNITY_DIGEST_CRC32);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testMemoryXxh64(void)
+{
+#if !defined(UNITY_INCLUDE_DIGEST) || !defined(UNITY_SUPPORT_64)
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_MEMORY_XXH64(0xEF46DB3751D8E999, "", 0);
+    TEST_ASSERT_MEMORY_XXH64(0x44BC2CF5AD770999, "abc", 3);
+    TEST_ASSERT_MEMORY_XXH64(0xFBCEA83C8A378BF1, "Nobody inspects the spammish repetition", 39);
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertMemoryDigest(0x44BC2CF5AD770999, "abd", 3, NULL, __LINE__, UNITY_DIGEST_XXH64);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testEqualFile(void)
+{
+#ifndef UNITY_INCLUDE_FILE
+    TEST_IGNORE();
+#else
+    const char golden[] = "golden file contents";
+    FILE* file = fopen("testunity_golden.txt", "wb");
+
+    TEST_ASSERT_NOT_NULL(file);
+    fwrite(golden, 1, sizeof(golden), file);
+    fclose(file);
+
+    TEST_ASSERT_EQUAL_FILE("testunity_golden.txt", golden, sizeof(golden));
+    TEST_ASSERT_FILES_EQUAL("testunity_golden.txt", "testunity_golden.txt");
+#endif
+}
+
+void testUpdateGoldenLeavesFileComparedWithItself(void)
+{
+#if !defined(UNITY_INCLUDE_FILE) || !defined(__unix__)
+    TEST_IGNORE();
+#else
+    const char golden[] = "golden file contents";
+    FILE* file = fopen("testunity_golden.txt", "wb");
+    UNITY_BOOL failed;
+
+    TEST_ASSERT_NOT_NULL(file);
+    fwrite(golden, 1, sizeof(golden), file);
+    fclose(file);
+
+    setenv(UNITY_UPDATE_GOLDEN_ENV, "1", 1);
+    failed = UnityAssertFilesEqual("testunity_golden.txt", "testunity_golden.txt", NULL, __LINE__);
+    unsetenv(UNITY_UPDATE_GOLDEN_ENV);
+
+    TEST_ASSERT_FALSE(failed);
+    TEST_ASSERT_EQUAL_FILE("testunity_golden.txt", golden, sizeof(golden));
+#endif
+}
+
+void testNotEqualFile(void)
+{
+#ifndef UNITY_INCLUDE_FILE
+    TEST_IGNORE();
+#else
+    const char golden[] = "golden file contents";
+    const char actual[] = "golden file CONTENTS";
+    FILE* file = fopen("testunity_golden.txt", "wb");
+
+    TEST_ASSERT_NOT_NULL(file);
+    fwrite(golden, 1, sizeof(golden), file);
+    fclose(file);
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualFile("testunity_golden.txt", actual, sizeof(actual), NULL, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testNotEqualFileReportsMismatches(void)
+{
+#if !defined(UNITY_INCLUDE_FILE) || !defined(USING_OUTPUT_SPY)
+    TEST_IGNORE();
+#else
+    unsigned char golden[300];
+    unsigned char actual[300];
+    FILE* file = fopen("testunity_golden.txt", "wb");
+    int i;
+
+    for (i = 0; i < 300; i++)
+    {
+        golden[i] = (unsigned char)('A' + (i % 26));
+        actual[i] = golden[i];
+    }
+    actual[10] = '#';
+    actual[290] = '#';
+
+    TEST_ASSERT_NOT_NULL(file);
+    fwrite(golden, 1, sizeof(golden), file);
+    fclose(file);
+
+    // the second difference is past the first block when the file is read through stdio
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualFile("testunity_golden.txt", actual, sizeof(actual), NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " Byte 10 Expected 0x4B Was 0x23"));
+#ifdef UNITY_REPORT_ALL_MISMATCHES
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " Was 0x23 Mismatched At 10, 290 Total 2"));
+#endif
+#ifdef UNITY_MEMORY_DIFF
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(),
+        "\n    0x00000008  49 4A*4B 4C 4D 4E 4F 50   49 4A*23 4C 4D 4E 4F 50  |IJKLMNOP|IJ#LMNOP|"));
+#endif
+#endif
+}
+
+void testNotEqualFileSize(void)
+{
+#ifndef UNITY_INCLUDE_FILE
+    TEST_IGNORE();
+#else
+    const char golden[] = "golden file contents";
+    FILE* file = fopen("testunity_golden.txt", "wb");
+
+    TEST_ASSERT_NOT_NULL(file);
+    fwrite(golden, 1, sizeof(golden), file);
+    fclose(file);
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualFile("testunity_golden.txt", golden, sizeof(golden) - 1, NULL, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testEqualFileMissing(void)
+{
+#ifndef UNITY_INCLUDE_FILE
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityAssertFilesEqual("testunity_no_such_file.txt", "testunity_no_such_file.txt", NULL, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
 void testEqualIntArrays(void)
 {
     int p0[] = {1, 8, 987, -2};
@@ -1546,6 +1942,106 @@ void testNotEqualIntArrays3(void)
     VERIFY_FAILS_END
 }
 
+void testEqualIntArraysUnordered(void)
+{
+    int p0[] = {1, 8, 987, -2, 8};
+    int p1[] = {8, -2, 1, 8, 987};
+    unsigned short p2[] = {65535u, 0u, 7u};
+    unsigned short p3[] = {7u, 65535u, 0u};
+
+    TEST_ASSERT_EQUAL_INT_ARRAY_UNORDERED(p0, p0, 5);
+    TEST_ASSERT_EQUAL_INT_ARRAY_UNORDERED(p0, p1, 5);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY_UNORDERED(p2, p3, 3);
+}
+
+void testEqualIntArraysUnorderedWithScratch(void)
+{
+    _UU32 scratch[10];
+    int p0[] = {1, 8, 987, -2, 8};
+    int p1[] = {8, -2, 1, 8, 987};
+    int p2[] = {8, -2, 1, 1, 987};
+
+    UNITY_BOOL equal;
+
+    // give the scratch back before anything can return from the test
+    UnitySetScratch(scratch, sizeof(scratch));
+    equal = (UnityAssertEqualIntArrayUnordered(p0, p1, 5, NULL, __LINE__, UNITY_DISPLAY_STYLE_INT) == 0);
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualIntArrayUnordered(p0, p2, 5, NULL, __LINE__, UNITY_DISPLAY_STYLE_INT);
+    UnitySetScratch(NULL, 0);
+    VERIFY_FAILS_END
+    TEST_ASSERT_TRUE(equal);
+}
+
+void testNotEqualIntArraysUnorderedRepeats(void)
+{
+    int p0[] = {1, 2, 3, 3};
+    int p1[] = {3, 2, 1, 1};
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualIntArrayUnordered(p0, p1, 4, NULL, __LINE__, UNITY_DISPLAY_STYLE_INT);
+    VERIFY_FAILS_END
+}
+
+void testEachEqualHex8(void)
+{
+    unsigned char p0[] = {0xAA, 0xAA, 0xAA, 0xAA};
+    unsigned char p1[] = {0xAA, 0xAA, 0xAB, 0xAA};
+
+    TEST_ASSERT_EACH_EQUAL_HEX8(0xAA, p0, 4);
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertEachWithinRange(0xAA, 0xAA, p1, 4, NULL, __LINE__, UNITY_DISPLAY_STYLE_HEX8);
+    VERIFY_FAILS_END
+}
+
+void testEachInt32WithinRange(void)
+{
+    _US32 p0[] = {-5, 0, 5, 10};
+    _US32 p1[] = {-5, 0, 11, 10};
+
+    TEST_ASSERT_EACH_INT32_WITHIN_RANGE(-5, 10, p0, 4);
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertEachWithinRange(-5, 10, p1, 4, NULL, __LINE__, UNITY_DISPLAY_STYLE_INT32);
+    VERIFY_FAILS_END
+}
+
+void testEachUint16WithinRangeIsUnsigned(void)
+{
+    unsigned short p0[] = {1, 65535u};
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertEachWithinRange(0, 100, p0, 2, NULL, __LINE__, UNITY_DISPLAY_STYLE_UINT16);
+    VERIFY_FAILS_END
+}
+
+void testIntArraySorted(void)
+{
+    int p0[] = {-3, -3, 0, 8, 987};
+    int p1[] = {-3, 0, 8, 7, 987};
+
+    TEST_ASSERT_INT_ARRAY_SORTED(p0, 5);
+    TEST_ASSERT_INT_ARRAY_SORTED(p0, 1);
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertArraySorted(p1, 5, NULL, __LINE__, UNITY_DISPLAY_STYLE_INT);
+    VERIFY_FAILS_END
+}
+
+void testEqualMemoryArraysUnordered(void)
+{
+    char p0[] = "abcdefgh";
+    char p1[] = "efghabcd";
+    char p2[] = "efghabce";
+
+    TEST_ASSERT_EQUAL_MEMORY_ARRAY_UNORDERED(p0, p1, 4, 2);
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertEqualMemoryUnordered(p0, p2, 4, 2, NULL, __LINE__);
+    VERIFY_FAILS_END
+}
+
 void testEqualPtrArrays(void)
 {
     char A = 1;
@@ -2139,8 +2635,73 @@ void testIgnoredAndThenFailInTearDown(void)
     TEST_IGNORE();
 }
 
+#ifdef USING_OUTPUT_SPY
+static const char* printNumberToSpy(const _U_SINT number)
+{
+    startPutcharSpy();
+    UnityPrintNumber(number);
+    endPutcharSpy();
+    return getBufferPutcharSpy();
+}
+
+static const char* printUnsignedToSpy(const _U_UINT number)
+{
+    startPutcharSpy();
+    UnityPrintNumberUnsigned(number);
+    endPutcharSpy();
+    return getBufferPutcharSpy();
+}
+#endif
+
+void testPrintNumbers(void)
+{
+#ifndef USING_OUTPUT_SPY
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_EQUAL_STRING("0", printNumberToSpy(0));
+    TEST_ASSERT_EQUAL_STRING("7", printNumberToSpy(7));
+    TEST_ASSERT_EQUAL_STRING("-7", printNumberToSpy(-7));
+
+    // each side of every place where one more pair of digits is needed
+    TEST_ASSERT_EQUAL_STRING("9", printNumberToSpy(9));
+    TEST_ASSERT_EQUAL_STRING("10", printNumberToSpy(10));
+    TEST_ASSERT_EQUAL_STRING("99", printNumberToSpy(99));
+    TEST_ASSERT_EQUAL_STRING("100", printNumberToSpy(100));
+    TEST_ASSERT_EQUAL_STRING("999", printNumberToSpy(999));
+    TEST_ASSERT_EQUAL_STRING("1000", printNumberToSpy(1000));
+    TEST_ASSERT_EQUAL_STRING("-9999", printNumberToSpy(-9999));
+    TEST_ASSERT_EQUAL_STRING("-10000", printNumberToSpy(-10000));
+    TEST_ASSERT_EQUAL_STRING("99999999", printNumberToSpy(99999999));
+    TEST_ASSERT_EQUAL_STRING("100000000", printNumberToSpy(100000000));
+    TEST_ASSERT_EQUAL_STRING("999999999", printNumberToSpy(999999999));
+    TEST_ASSERT_EQUAL_STRING("1000000000", printNumberToSpy(1000000000));
+
+    TEST_ASSERT_EQUAL_STRING("2147483647", printNumberToSpy(2147483647));
+    TEST_ASSERT_EQUAL_STRING("-2147483648", printNumberToSpy((_US32)0x80000000));
+    TEST_ASSERT_EQUAL_STRING("4294967295", printUnsignedToSpy(0xFFFFFFFF));
+#endif
+}
+
 // ===================== THESE TEST WILL RUN IF YOUR CONFIG INCLUDES 64 BIT SUPPORT ==================
 
+void testPrintNumbers64(void)
+{
+#if !defined(UNITY_SUPPORT_64) || !defined(USING_OUTPUT_SPY)
+    TEST_IGNORE();
+#else
+    // past 32 bits the value is split into 8-digit chunks, which keep their leading zeros
+    TEST_ASSERT_EQUAL_STRING("4294967296", printUnsignedToSpy(0x100000000));
+    TEST_ASSERT_EQUAL_STRING("100000000000000001", printUnsignedToSpy(100000000000000001));
+    TEST_ASSERT_EQUAL_STRING("9999999999999999999", printUnsignedToSpy(9999999999999999999u));
+    TEST_ASSERT_EQUAL_STRING("10000000000000000000", printUnsignedToSpy(10000000000000000000u));
+    TEST_ASSERT_EQUAL_STRING("18446744073709551615", printUnsignedToSpy(0xFFFFFFFFFFFFFFFF));
+
+    TEST_ASSERT_EQUAL_STRING("9223372036854775807", printNumberToSpy(0x7FFFFFFFFFFFFFFF));
+    TEST_ASSERT_EQUAL_STRING("-9223372036854775808", printNumberToSpy((_US64)0x8000000000000000));
+    TEST_ASSERT_EQUAL_STRING("-100000000", printNumberToSpy(-100000000));
+#endif
+}
+
 void testEqualHex64s(void)
 {
 #ifndef UNITY_SUPPORT_64
@@ -2549,7 +3110,7 @@ void testFloatsNotEqualActualNaN(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_FLOAT(85.963f, 0.0f / f_zero);
+    TEST_ASSERT_EQUAL_FLOAT(85.963f, 0.0f / f_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2560,7 +3121,7 @@ void testFloatsNotEqualExpectedNaN(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_FLOAT(0.0f / f_zero, 85.963f);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f / f_zero_test, 85.963f);
     VERIFY_FAILS_END
 #endif
 }
@@ -2571,7 +3132,7 @@ void testFloatsNotEqualBothNaN(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_FLOAT(0.0f / f_zero, 0.0f / f_zero);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f / f_zero_test, 0.0f / f_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2582,7 +3143,7 @@ void testFloatsNotEqualInfNaN(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_FLOAT(1.0f / f_zero, 0.0f / f_zero);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f / f_zero_test, 0.0f / f_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2593,7 +3154,7 @@ void testFloatsNotEqualNaNInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_FLOAT(0.0f / f_zero, 1.0f / f_zero);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f / f_zero_test, 1.0f / f_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2604,7 +3165,7 @@ void testFloatsNotEqualActualInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_FLOAT(321.642f, 1.0f / f_zero);
+    TEST_ASSERT_EQUAL_FLOAT(321.642f, 1.0f / f_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2615,7 +3176,7 @@ void testFloatsNotEqualExpectedInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_FLOAT(1.0f / f_zero, 321.642f);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f / f_zero_test, 321.642f);
     VERIFY_FAILS_END
 #endif
 }
@@ -2626,7 +3187,7 @@ void testFloatsNotEqualBothInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_FLOAT(1.0f / f_zero, 1.0f / f_zero);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f / f_zero_test, 1.0f / f_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2637,7 +3198,7 @@ void testFloatsNotEqualPlusMinusInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_FLOAT(1.0f / f_zero, -1.0f / f_zero);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f / f_zero_test, -1.0f / f_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2647,8 +3208,8 @@ void testFloatIsInf(void)
 #ifdef UNITY_EXCLUDE_FLOAT
     TEST_IGNORE();
 #else
-    TEST_ASSERT_FLOAT_IS_INF(2.0f / f_zero);
-    TEST_ASSERT_FLOAT_IS_NEG_INF(-3.0f / f_zero);
+    TEST_ASSERT_FLOAT_IS_INF(2.0f / f_zero_test);
+    TEST_ASSERT_FLOAT_IS_NEG_INF(-3.0f / f_zero_test);
 #endif
 }
 
@@ -2679,7 +3240,7 @@ void testFloatIsNan(void)
 #ifdef UNITY_EXCLUDE_FLOAT
     TEST_IGNORE();
 #else
-    TEST_ASSERT_FLOAT_IS_NAN(0.0f / f_zero);
+    TEST_ASSERT_FLOAT_IS_NAN(0.0f / f_zero_test);
 #endif
 }
 
@@ -2700,7 +3261,7 @@ void testFloatInfIsNotNan(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_FLOAT_IS_NAN(1.0f / f_zero);
+    TEST_ASSERT_FLOAT_IS_NAN(1.0f / f_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2711,7 +3272,7 @@ void testFloatNanIsNotInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_FLOAT_IS_INF(0.0f / f_zero);
+    TEST_ASSERT_FLOAT_IS_INF(0.0f / f_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2851,8 +3412,8 @@ void testNotEqualFloatArraysNaN(void)
 #ifdef UNITY_EXCLUDE_FLOAT
     TEST_IGNORE();
 #else
-    float p0[] = {1.0f, 0.0f / f_zero, 25.4f, 0.253f};
-    float p1[] = {1.0f, 0.0f / f_zero, 25.4f, 0.253f};
+    float p0[] = {1.0f, 0.0f / f_zero_test, 25.4f, 0.253f};
+    float p1[] = {1.0f, 0.0f / f_zero_test, 25.4f, 0.253f};
 
     EXPECT_ABORT_BEGIN
     TEST_ASSERT_EQUAL_FLOAT_ARRAY(p0, p1, 4);
@@ -2865,8 +3426,8 @@ void testNotEqualFloatArraysInf(void)
 #ifdef UNITY_EXCLUDE_FLOAT
     TEST_IGNORE();
 #else
-    float p0[] = {1.0f, 1.0f / f_zero, 25.4f, 0.253f};
-    float p1[] = {1.0f, 1.0f / f_zero, 25.4f, 0.253f};
+    float p0[] = {1.0f, 1.0f / f_zero_test, 25.4f, 0.253f};
+    float p1[] = {1.0f, 1.0f / f_zero_test, 25.4f, 0.253f};
 
     EXPECT_ABORT_BEGIN
     TEST_ASSERT_EQUAL_FLOAT_ARRAY(p0, p1, 4);
@@ -2874,9 +3435,121 @@ void testNotEqualFloatArraysInf(void)
 #endif
 }
 
-// ===================== THESE TEST WILL RUN IF YOUR CONFIG INCLUDES DOUBLE SUPPORT ==================
-
-void testDoublesWithinDelta(void)
+void testFloatsWithinUlp(void)
+{
+#ifdef UNITY_EXCLUDE_FLOAT
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_FLOAT_WITHIN_ULP(0, 1.0f, 1.0f);
+    TEST_ASSERT_FLOAT_WITHIN_ULP(1, 0.0f, -0.0f);
+    TEST_ASSERT_FLOAT_WITHIN_ULP(4, 1.0f, 1.0000004f);
+#endif
+}
+
+void testFloatsNotWithinUlp(void)
+{
+#ifdef UNITY_EXCLUDE_FLOAT
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityAssertFloatsWithinUlp(1, 1.0f, 1.0000005f, NULL, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testNotEqualFloatArraysWithinUlpNaN(void)
+{
+#ifdef UNITY_EXCLUDE_FLOAT
+    TEST_IGNORE();
+#else
+    float p0[] = {1.0f, 8.0f, 25.4f, 0.253f};
+    float p1[] = {1.0f, 0.0f / f_zero_test, 25.4f, 0.253f};
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertFloatArrayWithinUlp(1000, p0, p1, 4, NULL, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testFloatArraysWithinTolerance(void)
+{
+#ifdef UNITY_EXCLUDE_FLOAT
+    TEST_IGNORE();
+#else
+    float p0[] = {0.0f, 1.0f, 1000.0f};
+    float p1[] = {0.00001f, 1.0005f, 1000.5f};
+    float p2[] = {1.0f / f_zero_test, -1.0f / f_zero_test};
+
+    TEST_ASSERT_FLOAT_ARRAY_WITHIN_TOLERANCE(0.0001f, 0.001f, p0, p1, 3);
+    TEST_ASSERT_FLOAT_ARRAY_WITHIN_TOLERANCE(0.0001f, 0.001f, p2, p2, 2);
+#endif
+}
+
+void testNotEqualFloatArraysWithinTolerance(void)
+{
+#ifdef UNITY_EXCLUDE_FLOAT
+    TEST_IGNORE();
+#else
+    float p0[] = {0.0f, 1.0f, 1000.0f, 10.0f};
+    float p1[] = {0.001f, 1.0005f, 1000.5f, 10.5f};
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UnityAssertFloatArrayWithinTolerance(0.0001f, 0.001f, p0, p1, 4, NULL, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+#ifdef USING_OUTPUT_SPY
+    // elements 0 and 3 fail, and 3 is further outside its tolerance
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " Worst Element 3"));
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " Failed 2 Of 4"));
+#endif
+#endif
+}
+
+#if defined(USING_OUTPUT_SPY) && defined(UNITY_FLOAT_VERBOSE)
+static const char* printFloatToSpy(const _UF number)
+{
+    startPutcharSpy();
+    UnityPrintFloat(number);
+    endPutcharSpy();
+    return getBufferPutcharSpy();
+}
+#endif
+
+void testPrintFloatShortestRoundTrip(void)
+{
+#if !defined(USING_OUTPUT_SPY) || !defined(UNITY_FLOAT_VERBOSE) || !defined(UNITY_SUPPORT_64)
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_EQUAL_STRING("0.0", printFloatToSpy(0.0f));
+    TEST_ASSERT_EQUAL_STRING("-0.0", printFloatToSpy(-0.0f));
+    TEST_ASSERT_EQUAL_STRING("1.0", printFloatToSpy(1.0f));
+    TEST_ASSERT_EQUAL_STRING("0.1", printFloatToSpy(0.1f));
+    TEST_ASSERT_EQUAL_STRING("123456.7", printFloatToSpy(123456.7f));
+
+    // powers of ten on both sides of the switch to exponent notation
+    TEST_ASSERT_EQUAL_STRING("0.0001", printFloatToSpy(1e-4f));
+    TEST_ASSERT_EQUAL_STRING("1e-05", printFloatToSpy(1e-5f));
+    TEST_ASSERT_EQUAL_STRING("10000000000.0", printFloatToSpy(1e10f));
+    TEST_ASSERT_EQUAL_STRING("1e+16", printFloatToSpy(1e16f));
+    TEST_ASSERT_EQUAL_STRING("1e+17", printFloatToSpy(1e17f));
+
+    // the smallest normal, a subnormal, the smallest subnormal and the largest value
+    TEST_ASSERT_EQUAL_STRING("1.1754944e-38", printFloatToSpy(FLT_MIN));
+    TEST_ASSERT_EQUAL_STRING("1.469368e-39", printFloatToSpy(FLT_MIN / 8.0f));
+    TEST_ASSERT_EQUAL_STRING("1e-45", printFloatToSpy(1.4e-45f));
+    TEST_ASSERT_EQUAL_STRING("3.4028235e+38", printFloatToSpy(FLT_MAX));
+
+    TEST_ASSERT_EQUAL_STRING("Infinity", printFloatToSpy(1.0f / f_zero_test));
+    TEST_ASSERT_EQUAL_STRING("-Infinity", printFloatToSpy(-1.0f / f_zero_test));
+    TEST_ASSERT_EQUAL_STRING("NaN", printFloatToSpy(0.0f / f_zero_test));
+#endif
+}
+
+// ===================== THESE TEST WILL RUN IF YOUR CONFIG INCLUDES DOUBLE SUPPORT ==================
+
+void testDoublesWithinDelta(void)
 {
 #ifdef UNITY_EXCLUDE_DOUBLE
     TEST_IGNORE();
@@ -2951,7 +3624,7 @@ void testDoublesNotEqualActualNaN(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_DOUBLE(85.963, 0.0 / d_zero);
+    TEST_ASSERT_EQUAL_DOUBLE(85.963, 0.0 / d_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2962,7 +3635,7 @@ void testDoublesNotEqualExpectedNaN(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_DOUBLE(0.0 / d_zero, 85.963);
+    TEST_ASSERT_EQUAL_DOUBLE(0.0 / d_zero_test, 85.963);
     VERIFY_FAILS_END
 #endif
 }
@@ -2973,7 +3646,7 @@ void testDoublesNotEqualBothNaN(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_DOUBLE(0.0 / d_zero, 0.0 / d_zero);
+    TEST_ASSERT_EQUAL_DOUBLE(0.0 / d_zero_test, 0.0 / d_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2984,7 +3657,7 @@ void testDoublesNotEqualInfNaN(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_DOUBLE(1.0 / d_zero, 0.0 / d_zero);
+    TEST_ASSERT_EQUAL_DOUBLE(1.0 / d_zero_test, 0.0 / d_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -2995,7 +3668,7 @@ void testDoublesNotEqualNaNInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_DOUBLE(0.0 / d_zero, 1.0 / d_zero);
+    TEST_ASSERT_EQUAL_DOUBLE(0.0 / d_zero_test, 1.0 / d_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -3006,7 +3679,7 @@ void testDoublesNotEqualActualInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_DOUBLE(321.642, 1.0 / d_zero);
+    TEST_ASSERT_EQUAL_DOUBLE(321.642, 1.0 / d_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -3017,7 +3690,7 @@ void testDoublesNotEqualExpectedInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_DOUBLE(1.0 / d_zero, 321.642);
+    TEST_ASSERT_EQUAL_DOUBLE(1.0 / d_zero_test, 321.642);
     VERIFY_FAILS_END
 #endif
 }
@@ -3028,7 +3701,7 @@ void testDoublesNotEqualBothInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_DOUBLE(1.0 / d_zero, 1.0 / d_zero);
+    TEST_ASSERT_EQUAL_DOUBLE(1.0 / d_zero_test, 1.0 / d_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -3039,7 +3712,7 @@ void testDoublesNotEqualPlusMinusInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_DOUBLE(1.0 / d_zero, -1.0 / d_zero);
+    TEST_ASSERT_EQUAL_DOUBLE(1.0 / d_zero_test, -1.0 / d_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -3049,8 +3722,8 @@ void testDoubleIsInf(void)
 #ifdef UNITY_EXCLUDE_DOUBLE
     TEST_IGNORE();
 #else
-    TEST_ASSERT_DOUBLE_IS_INF(2.0 / d_zero);
-    TEST_ASSERT_DOUBLE_IS_NEG_INF(-3.0 / d_zero);
+    TEST_ASSERT_DOUBLE_IS_INF(2.0 / d_zero_test);
+    TEST_ASSERT_DOUBLE_IS_NEG_INF(-3.0 / d_zero_test);
 #endif
 }
 
@@ -3081,7 +3754,7 @@ void testDoubleIsNan(void)
 #ifdef UNITY_EXCLUDE_DOUBLE
     TEST_IGNORE();
 #else
-    TEST_ASSERT_DOUBLE_IS_NAN(0.0 / d_zero);
+    TEST_ASSERT_DOUBLE_IS_NAN(0.0 / d_zero_test);
 #endif
 }
 
@@ -3102,7 +3775,7 @@ void testDoubleInfIsNotNan(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_DOUBLE_IS_NAN(1.0 / d_zero);
+    TEST_ASSERT_DOUBLE_IS_NAN(1.0 / d_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -3113,7 +3786,7 @@ void testDoubleNanIsNotInf(void)
     TEST_IGNORE();
 #else
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_DOUBLE_IS_INF(0.0 / d_zero);
+    TEST_ASSERT_DOUBLE_IS_INF(0.0 / d_zero_test);
     VERIFY_FAILS_END
 #endif
 }
@@ -3253,8 +3926,8 @@ void testNotEqualDoubleArraysNaN(void)
 #ifdef UNITY_EXCLUDE_DOUBLE
     TEST_IGNORE();
 #else
-    double p0[] = {1.0, 0.0 / d_zero, 25.4, 0.253};
-    double p1[] = {1.0, 0.0 / d_zero, 25.4, 0.253};
+    double p0[] = {1.0, 0.0 / d_zero_test, 25.4, 0.253};
+    double p1[] = {1.0, 0.0 / d_zero_test, 25.4, 0.253};
 
     EXPECT_ABORT_BEGIN
     TEST_ASSERT_EQUAL_DOUBLE_ARRAY(p0, p1, 4);
@@ -3267,11 +3940,818 @@ void testNotEqualDoubleArraysInf(void)
 #ifdef UNITY_EXCLUDE_DOUBLE
     TEST_IGNORE();
 #else
-    double p0[] = {1.0, 1.0 / d_zero, 25.4, 0.253};
-    double p1[] = {1.0, 1.0 / d_zero, 25.4, 0.253};
+    double p0[] = {1.0, 1.0 / d_zero_test, 25.4, 0.253};
+    double p1[] = {1.0, 1.0 / d_zero_test, 25.4, 0.253};
 
     EXPECT_ABORT_BEGIN
     TEST_ASSERT_EQUAL_DOUBLE_ARRAY(p0, p1, 4);
     VERIFY_FAILS_END
 #endif
 }
+
+void testDoublesWithinUlp(void)
+{
+#if defined(UNITY_EXCLUDE_DOUBLE) || !defined(UNITY_SUPPORT_64)
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_DOUBLE_WITHIN_ULP(0, 1.0, 1.0);
+    TEST_ASSERT_DOUBLE_WITHIN_ULP(1, 0.0, -0.0);
+    TEST_ASSERT_DOUBLE_WITHIN_ULP(5, 1.0, 1.000000000000001);
+#endif
+}
+
+void testNotEqualDoubleArraysWithinUlp(void)
+{
+#if defined(UNITY_EXCLUDE_DOUBLE) || !defined(UNITY_SUPPORT_64)
+    TEST_IGNORE();
+#else
+    double p0[] = {1.0, 8.0, 25.4, 0.253};
+    double p1[] = {1.0, 8.0, 25.400001, 0.253};
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertDoubleArrayWithinUlp(1000, p0, p1, 4, NULL, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testDoublesWithinTolerance(void)
+{
+#ifdef UNITY_EXCLUDE_DOUBLE
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE(1e-12, 1e-9, 0.0, 1e-13);
+    TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE(1e-12, 1e-9, 1e6, 1e6 + 1e-4);
+    TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE(1e-12, 1e-9, 1.0 / d_zero_test, 1.0 / d_zero_test);
+    TEST_ASSERT_DOUBLE_WITHIN_TOLERANCE(1e-12, 1e-9, -1.0 / d_zero_test, -1.0 / d_zero_test);
+#endif
+}
+
+void testDoublesNotWithinToleranceInf(void)
+{
+#ifdef UNITY_EXCLUDE_DOUBLE
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityAssertDoublesWithinTolerance(1e-12, 1e-9, 1.0, 1.0 / d_zero_test, NULL, __LINE__);
+    VERIFY_FAILS_END
+
+    EXPECT_ABORT_BEGIN
+    UnityAssertDoublesWithinTolerance(1e-12, 1e-9, 1.0 / d_zero_test, -1.0 / d_zero_test, NULL, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+#if defined(USING_OUTPUT_SPY) && defined(UNITY_DOUBLE_VERBOSE)
+static const char* printDoubleToSpy(const _UD number)
+{
+    startPutcharSpy();
+    UnityPrintDouble(number);
+    endPutcharSpy();
+    return getBufferPutcharSpy();
+}
+#endif
+
+void testPrintDoubleShortestRoundTrip(void)
+{
+#if !defined(USING_OUTPUT_SPY) || !defined(UNITY_DOUBLE_VERBOSE) || !defined(UNITY_SUPPORT_64)
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_EQUAL_STRING("0.0", printDoubleToSpy(0.0));
+    TEST_ASSERT_EQUAL_STRING("-0.0", printDoubleToSpy(-0.0));
+    TEST_ASSERT_EQUAL_STRING("1.0", printDoubleToSpy(1.0));
+    TEST_ASSERT_EQUAL_STRING("0.1", printDoubleToSpy(0.1));
+
+    // powers of ten on both sides of the switch to exponent notation
+    TEST_ASSERT_EQUAL_STRING("0.0001", printDoubleToSpy(1e-4));
+    TEST_ASSERT_EQUAL_STRING("1e-05", printDoubleToSpy(1e-5));
+    TEST_ASSERT_EQUAL_STRING("1000000000000000.0", printDoubleToSpy(1e15));
+    TEST_ASSERT_EQUAL_STRING("1e+16", printDoubleToSpy(1e16));
+    TEST_ASSERT_EQUAL_STRING("1e+22", printDoubleToSpy(1e22));
+
+    // the smallest normal, a subnormal, the smallest subnormal and the largest value
+    TEST_ASSERT_EQUAL_STRING("2.2250738585072014e-308", printDoubleToSpy(DBL_MIN));
+    TEST_ASSERT_EQUAL_STRING("1.390671161567e-309", printDoubleToSpy(DBL_MIN / 16.0));
+    TEST_ASSERT_EQUAL_STRING("5e-324", printDoubleToSpy(4.9e-324));
+    TEST_ASSERT_EQUAL_STRING("1.7976931348623157e+308", printDoubleToSpy(DBL_MAX));
+
+    TEST_ASSERT_EQUAL_STRING("Infinity", printDoubleToSpy(1.0 / d_zero_test));
+    TEST_ASSERT_EQUAL_STRING("-Infinity", printDoubleToSpy(-1.0 / d_zero_test));
+    TEST_ASSERT_EQUAL_STRING("NaN", printDoubleToSpy(0.0 / d_zero_test));
+#endif
+}
+
+// ===================== THESE TEST WILL RUN IF YOUR CONFIG INCLUDES PROPERTY SUPPORT ==================
+
+#ifdef UNITY_INCLUDE_PROPERTY
+static _U_SINT PropertyLastA;
+static _U_SINT PropertyLastB;
+
+static void propertyAddCommutes(void)
+{
+    _U_SINT a = TEST_GEN_INT(-1000, 1000);
+    _U_SINT b = TEST_GEN_INT(-1000, 1000);
+
+    TEST_ASSERT_EQUAL_INT(a + b, b + a);
+}
+
+static void propertySumIsSmall(void)
+{
+    PropertyLastA = TEST_GEN_INT(-100000, 100000);
+    PropertyLastB = TEST_GEN_INT(-100000, 100000);
+
+    TEST_ASSERT_TRUE(PropertyLastA + PropertyLastB < 1234);
+}
+
+static void propertySumIsUnderAThousand(void)
+{
+    PropertyLastA = TEST_GEN_INT(-100000, 100000);
+    PropertyLastB = TEST_GEN_INT(-100000, 100000);
+
+    TEST_ASSERT_TRUE(PropertyLastA + PropertyLastB < 1000);
+}
+
+static void propertyAssumesTooMuch(void)
+{
+    _U_SINT x = TEST_GEN_INT(0, 10);
+
+    TEST_ASSUME(x > 100);
+    TEST_ASSERT_TRUE(x > 100);
+}
+
+static void propertyStringHasNoX(void)
+{
+    char text[16];
+    int i;
+
+    TEST_GEN_STRING(text, sizeof(text));
+    TEST_ASSUME(text[0] != 'y');
+    for (i = 0; text[i] != '\0'; i++)
+    {
+        TEST_ASSERT_NOT_EQUAL('x', text[i]);
+    }
+}
+#endif
+
+void testPropertyPasses(void)
+{
+#ifndef UNITY_INCLUDE_PROPERTY
+    TEST_IGNORE();
+#else
+    UnityRunProperty(propertyAddCommutes, 200, __LINE__);
+#endif
+}
+
+void testPropertyFalsifiedIsShrunk(void)
+{
+#ifndef UNITY_INCLUDE_PROPERTY
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityRunProperty(propertySumIsSmall, 1000, __LINE__);
+    VERIFY_FAILS_END
+
+    // the final replay is the smallest counterexample
+    TEST_ASSERT_EQUAL_INT(1234, PropertyLastA);
+    TEST_ASSERT_EQUAL_INT(0, PropertyLastB);
+#endif
+}
+
+void testPropertyShrinksAcrossSigns(void)
+{
+#ifndef UNITY_INCLUDE_PROPERTY
+    TEST_IGNORE();
+#else
+    _UU32 seed;
+
+    // negative values are not simpler than the positive ones past them, whatever the seed
+    for (seed = 0; seed < 4; seed++)
+    {
+        UnitySetPropertySeed(seed);
+        startPutcharSpy();
+        EXPECT_ABORT_BEGIN
+        UnityRunProperty(propertySumIsUnderAThousand, 1000, __LINE__);
+        endPutcharSpy();
+        VERIFY_FAILS_END
+        UnitySetPropertySeed(UNITY_PROPERTY_SEED);
+
+        TEST_ASSERT_EQUAL_INT(1000, PropertyLastA);
+        TEST_ASSERT_EQUAL_INT(0, PropertyLastB);
+#ifdef USING_OUTPUT_SPY
+        TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), "Given 1000"));
+#endif
+    }
+#endif
+}
+
+void testPropertyFailsWhenEveryCaseIsDiscarded(void)
+{
+#ifndef UNITY_INCLUDE_PROPERTY
+    TEST_IGNORE();
+#else
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UnityRunProperty(propertyAssumesTooMuch, 50, __LINE__);
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+#ifdef USING_OUTPUT_SPY
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " All 50 Cases Discarded By TEST_ASSUME"));
+#endif
+#endif
+}
+
+void testPropertyStringFalsified(void)
+{
+#ifndef UNITY_INCLUDE_PROPERTY
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityRunProperty(propertyStringHasNoX, 1000, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+// ===================== THESE TEST WILL RUN IF YOUR CONFIG INCLUDES DATA FILE SUPPORT ==================
+
+#ifdef UNITY_INCLUDE_DATA_FILE
+static _UU32 DataRowsSeen;
+
+// three rows of one little-endian _UU32 each: 0, 10 and 20
+static void writeDataTable(void)
+{
+    const unsigned char table[] = { 'U', 'D', 'T', '1', 3, 0, 0, 0, 4, 0, 0, 0, 16, 0, 0, 0,
+                                    0, 0, 0, 0, 10, 0, 0, 0, 20, 0, 0, 0 };
+    FILE* file = fopen("testunity_table.bin", "wb");
+
+    TEST_ASSERT_NOT_NULL(file);
+    fwrite(table, 1, sizeof(table), file);
+    fclose(file);
+}
+
+static void dataRowIsTenTimesIndex(void)
+{
+    TEST_DATA_ROW(_UU32, row);
+
+    DataRowsSeen++;
+    TEST_ASSERT_EQUAL_UINT32(TEST_DATA_ROW_INDEX() * 10, *row);
+}
+
+static void dataRowIsNotTwenty(void)
+{
+    TEST_DATA_ROW(_UU32, row);
+
+    DataRowsSeen++;
+    TEST_ASSERT_NOT_EQUAL(20, *row);
+}
+
+static void dataRowIsByte(void)
+{
+    TEST_DATA_ROW(unsigned char, row);
+
+    DataRowsSeen++;
+}
+#endif
+
+void testDataFileRunsEveryRow(void)
+{
+#ifndef UNITY_INCLUDE_DATA_FILE
+    TEST_IGNORE();
+#else
+    writeDataTable();
+    DataRowsSeen = 0;
+    UnityRunDataFile(dataRowIsTenTimesIndex, "testunity_table.bin", __LINE__);
+    remove("testunity_table.bin");
+    TEST_ASSERT_EQUAL_UINT32(3, DataRowsSeen);
+#endif
+}
+
+void testDataFileFailingRow(void)
+{
+#ifndef UNITY_INCLUDE_DATA_FILE
+    TEST_IGNORE();
+#else
+    writeDataTable();
+    DataRowsSeen = 0;
+    EXPECT_ABORT_BEGIN
+    UnityRunDataFile(dataRowIsNotTwenty, "testunity_table.bin", __LINE__);
+    VERIFY_FAILS_END
+    remove("testunity_table.bin");
+    TEST_ASSERT_EQUAL_UINT32(3, DataRowsSeen);
+#endif
+}
+
+void testDataFileRowSizeMismatch(void)
+{
+#ifndef UNITY_INCLUDE_DATA_FILE
+    TEST_IGNORE();
+#else
+    writeDataTable();
+    DataRowsSeen = 0;
+    EXPECT_ABORT_BEGIN
+    UnityRunDataFile(dataRowIsByte, "testunity_table.bin", __LINE__);
+    VERIFY_FAILS_END
+    remove("testunity_table.bin");
+    TEST_ASSERT_EQUAL_UINT32(0, DataRowsSeen);
+#endif
+}
+
+void testDataFileMissing(void)
+{
+#ifndef UNITY_INCLUDE_DATA_FILE
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityRunDataFile(dataRowIsTenTimesIndex, "testunity_no_such_table.bin", __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+// ===================== SUBTESTS ==================
+
+static void checkEven(int value)
+{
+    TEST_ASSERT_EQUAL_INT(0, value % 2);
+}
+
+static void skipOdd(int value)
+{
+    if (value % 2 != 0)
+    {
+        TEST_IGNORE();
+    }
+}
+
+void testSubtestsAllPass(void)
+{
+    int i;
+
+    for (i = 0; i < 10; i += 2)
+    {
+        UNITY_SUBTEST(NULL)
+        {
+            checkEven(i);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, Unity.CurrentTestSubtests);
+    TEST_ASSERT_EQUAL_UINT32(0, Unity.CurrentTestSubtestFailures);
+}
+
+void testSubtestsContinueAfterFailure(void)
+{
+    int i;
+    int ran = 0;
+
+    for (i = 0; i < 6; i++)
+    {
+        UNITY_SUBTEST("sweep")
+        {
+            checkEven(i);
+            ran++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(6, ran);
+    TEST_ASSERT_EQUAL_UINT32(6, Unity.CurrentTestSubtests);
+    TEST_ASSERT_EQUAL_UINT32(3, Unity.CurrentTestSubtestFailures);
+
+    // the failures were expected, so do not let them fail this test
+    Unity.SubtestFailures -= Unity.CurrentTestSubtestFailures;
+    Unity.CurrentTestSubtestFailures = 0;
+}
+
+void testSubtestsKeepAFailureFromBeforeThem(void)
+{
+    EXPECT_ABORT_BEGIN
+    checkEven(1);
+    UNITY_SUBTEST("after")
+    {
+        checkEven(2);
+    }
+    VERIFY_FAILS_END
+    TEST_ASSERT_EQUAL_UINT32(1, Unity.CurrentTestSubtests);
+    TEST_ASSERT_EQUAL_UINT32(0, Unity.CurrentTestSubtestFailures);
+}
+
+void testSubtestsCountIgnoredOnes(void)
+{
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        UNITY_SUBTEST(NULL)
+        {
+            skipOdd(i);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(4, Unity.CurrentTestSubtests);
+    TEST_ASSERT_EQUAL_UINT32(2, Unity.CurrentTestSubtestIgnores);
+    TEST_ASSERT_EQUAL_UINT32(0, Unity.CurrentTestSubtestFailures);
+    TEST_ASSERT_EQUAL_UINT32(0, Unity.CurrentTestIgnored);
+}
+
+// ===================== GENERIC ASSERTIONS ==================
+
+void testGenericEqualPicksByType(void)
+{
+#ifndef UNITY_SUPPORT_GENERIC
+    TEST_IGNORE();
+#else
+    _UU8 u8 = 200;
+    _US16 s16 = -5;
+    unsigned int u = 0xFFFFFFFFu;
+    const char* str = "foo";
+    int value = 0;
+    int* ptr = &value;
+
+    TEST_ASSERT_EQUAL(200, u8);
+    TEST_ASSERT_EQUAL(-5, s16);
+    TEST_ASSERT_EQUAL(0xFFFFFFFFu, u);
+    TEST_ASSERT_EQUAL("foo", str);
+    TEST_ASSERT_EQUAL(&value, ptr);
+#ifdef UNITY_SUPPORT_64
+    {
+        _UU64 u64 = 0xFFFFFFFFFFFFFFFFull;
+        TEST_ASSERT_EQUAL(0xFFFFFFFFFFFFFFFFull, u64);
+    }
+#endif
+#endif
+}
+
+void testGenericEqualComparesByValue(void)
+{
+#ifndef UNITY_SUPPORT_GENERIC
+    TEST_IGNORE();
+#else
+    _UU8 u8 = 0;
+
+    // 256 would pass if it were narrowed to the type of actual
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UNITY_GENERIC_EQUAL(u8)(256, u8, NULL, __LINE__, UNITY_GENERIC_STYLE(u8));
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+#ifdef USING_OUTPUT_SPY
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " Expected 256 Was 0"));
+#endif
+#endif
+}
+
+void testGenericNotEqualStrings(void)
+{
+#ifndef UNITY_SUPPORT_GENERIC
+    TEST_IGNORE();
+#else
+    const char* str = "foo";
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UNITY_GENERIC_EQUAL(str)("bar", str, NULL, __LINE__, UNITY_GENERIC_STYLE(str));
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+#ifdef USING_OUTPUT_SPY
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " Expected 'bar' Was 'foo'"));
+#endif
+#endif
+}
+
+void testGenericEqualArrays(void)
+{
+#ifndef UNITY_SUPPORT_GENERIC
+    TEST_IGNORE();
+#else
+    _UU8 p8[] = {1, 8, 117, 3};
+    _US16 p16[] = {1, -8, 987, -2};
+    _UU32 p32[] = {1, 8, 987, 0xFFFFFFFFu};
+    const char* strings[] = {"foo", "boo"};
+
+    TEST_ASSERT_EQUAL_ARRAY(p8, p8, 4);
+    TEST_ASSERT_EQUAL_ARRAY(p16, p16, 4);
+    TEST_ASSERT_EQUAL_ARRAY(p32, p32, 4);
+    TEST_ASSERT_EQUAL_ARRAY(strings, strings, 2);
+#endif
+}
+
+void testGenericNotEqualArrays(void)
+{
+#ifndef UNITY_SUPPORT_GENERIC
+    TEST_IGNORE();
+#else
+    _US16 p0[] = {1, -8, 987, -2};
+    _US16 p1[] = {1, -8, 987, 2};
+
+    startPutcharSpy();
+    EXPECT_ABORT_BEGIN
+    UNITY_GENERIC_EQUAL_ARRAY(p1[0])(p0, p1, 4, NULL, __LINE__, UNITY_GENERIC_STYLE(p1[0]));
+    endPutcharSpy();
+    VERIFY_FAILS_END
+
+#ifdef USING_OUTPUT_SPY
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), " Element 3 Expected -2 Was 2"));
+#endif
+#endif
+}
+
+// ===================== THESE TEST WILL RUN IF YOUR CONFIG INCLUDES CONCURRENT TEST SUPPORT ==================
+
+#ifdef UNITY_INCLUDE_CONCURRENT
+static _UU32 ConcurrentCalls;
+static _UU32 ConcurrentThreadsSeen;
+
+static void concurrentCountCalls(void)
+{
+    UNITY_ATOMIC_ADD(ConcurrentCalls, 1);
+    if (TEST_ITERATION_INDEX() == 0)
+    {
+        UNITY_ATOMIC_ADD(ConcurrentThreadsSeen, 1u << TEST_THREAD_INDEX());
+    }
+}
+
+// thread 2 fails on its first call, but only once the other threads have made all of theirs
+static void concurrentThreadTwoFails(void)
+{
+    UNITY_ATOMIC_ADD(ConcurrentCalls, 1);
+    if (TEST_THREAD_INDEX() == 2)
+    {
+        while (UNITY_ATOMIC_LOAD(ConcurrentCalls) < (3 * 1000 + 1))
+        {
+            sched_yield();
+        }
+    }
+    TEST_ASSERT_FALSE(TEST_THREAD_INDEX() == 2);
+}
+
+// every thread sorts its own values at once, in the UNITY_SCRATCH_SIZE arena or in a buffer it lends
+static void concurrentUnorderedArrays(void)
+{
+    int expected[64];
+    int actual[64];
+    _UU32 i;
+#ifndef UNITY_SCRATCH_SIZE
+    _UU32 scratch[2 * 64];
+
+    UnitySetScratch(scratch, sizeof(scratch));
+#endif
+    for (i = 0; i < 64; i++)
+    {
+        expected[i] = (int)(TEST_THREAD_INDEX() * 1000 + (i * 37) % 64);
+        actual[63 - i] = expected[i];
+    }
+    UnityAssertEqualIntArrayUnordered(expected, actual, 64, NULL, __LINE__, UNITY_DISPLAY_STYLE_INT);
+#ifndef UNITY_SCRATCH_SIZE
+    UnitySetScratch(NULL, 0);
+#endif
+}
+#endif
+
+void testConcurrentRunsEveryIterationOnEveryThread(void)
+{
+#ifndef UNITY_INCLUDE_CONCURRENT
+    TEST_IGNORE();
+#else
+    ConcurrentCalls = 0;
+    ConcurrentThreadsSeen = 0;
+    UnityRunConcurrent(concurrentCountCalls, 4, 1000, 0, __LINE__);
+    TEST_ASSERT_EQUAL_UINT32(4000, ConcurrentCalls);
+    TEST_ASSERT_EQUAL_HEX32(0xF, ConcurrentThreadsSeen);
+#endif
+}
+
+void testConcurrentFailingThread(void)
+{
+#ifndef UNITY_INCLUDE_CONCURRENT
+    TEST_IGNORE();
+#else
+    ConcurrentCalls = 0;
+    EXPECT_ABORT_BEGIN
+    UnityRunConcurrent(concurrentThreadTwoFails, 4, 1000, 0, __LINE__);
+    VERIFY_FAILS_END
+    // the failing thread stopped after its first call
+    TEST_ASSERT_EQUAL_UINT32(3 * 1000 + 1, ConcurrentCalls);
+#endif
+}
+
+void testConcurrentUnorderedArrays(void)
+{
+#ifndef UNITY_INCLUDE_CONCURRENT
+    TEST_IGNORE();
+#else
+    UnityRunConcurrent(concurrentUnorderedArrays, 4, 200, 0, __LINE__);
+#endif
+}
+
+void testConcurrentNeedsThreads(void)
+{
+#ifndef UNITY_INCLUDE_CONCURRENT
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityRunConcurrent(concurrentCountCalls, 0, 1, 0, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+// ===================== THESE TEST WILL RUN IF YOUR CONFIG INCLUDES INTERLEAVED TEST SUPPORT ==================
+
+#ifdef UNITY_INCLUDE_INTERLEAVE
+static int InterleaveCounter;
+static _UU32 InterleaveSchedules;
+
+static void interleaveIncrementRacy(void)
+{
+    int value = InterleaveCounter;
+
+    UNITY_YIELD();
+    InterleaveCounter = value + 1;
+}
+
+static void interleaveIncrement(void)
+{
+    UNITY_YIELD();
+    InterleaveCounter++;
+    UNITY_YIELD();
+}
+
+static void interleaveTwoRacyThreads(void)
+{
+    InterleaveCounter = 0;
+    UNITY_SPAWN(interleaveIncrementRacy);
+    UNITY_SPAWN(interleaveIncrementRacy);
+    UNITY_JOIN();
+    TEST_ASSERT_EQUAL_INT(2, InterleaveCounter);
+}
+
+static void interleaveTwoThreads(void)
+{
+    InterleaveSchedules++;
+    InterleaveCounter = 0;
+    UNITY_SPAWN(interleaveIncrement);
+    UNITY_SPAWN(interleaveIncrement);
+    UNITY_JOIN();
+    TEST_ASSERT_EQUAL_INT(2, InterleaveCounter);
+}
+
+static int InterleaveStage;
+static int InterleaveStageSeen;
+
+static void interleaveStages(void)
+{
+    InterleaveStage = 1;
+    UNITY_YIELD();
+    InterleaveStage = 2;
+    UNITY_YIELD();
+    InterleaveStage = 3;
+}
+
+static void interleaveReadStage(void)
+{
+    InterleaveStageSeen = InterleaveStage;
+}
+
+// the reader only sees stage 3 if the other thread keeps the turn at both of its yields
+static void interleaveStageNeverThree(void)
+{
+    InterleaveStage = 0;
+    InterleaveStageSeen = 0;
+    UNITY_SPAWN(interleaveStages);
+    UNITY_SPAWN(interleaveReadStage);
+    UNITY_JOIN();
+    TEST_ASSERT_TRUE(InterleaveStageSeen != 3);
+}
+
+static void interleaveWaitForStage(void)
+{
+    while (InterleaveStage == 0)
+    {
+        UNITY_YIELD();
+    }
+}
+
+static void interleaveSetStage(void)
+{
+    UNITY_YIELD();
+    InterleaveStage = 1;
+}
+
+static void interleaveSpinningThread(void)
+{
+    InterleaveSchedules++;
+    InterleaveStage = 0;
+    UNITY_SPAWN(interleaveWaitForStage);
+    UNITY_SPAWN(interleaveSetStage);
+    UNITY_JOIN();
+    TEST_ASSERT_EQUAL_INT(1, InterleaveStage);
+}
+#endif
+
+void testInterleavedAllFindsLostUpdate(void)
+{
+#ifndef UNITY_INCLUDE_INTERLEAVE
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityRunInterleaved(interleaveTwoRacyThreads, 0, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testInterleavedRandomFindsLostUpdate(void)
+{
+#ifndef UNITY_INCLUDE_INTERLEAVE
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityRunInterleaved(interleaveTwoRacyThreads, 100, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testInterleavedAllRunsEveryOrder(void)
+{
+#ifndef UNITY_INCLUDE_INTERLEAVE
+    TEST_IGNORE();
+#else
+    InterleaveSchedules = 0;
+    UnityRunInterleaved(interleaveTwoThreads, 0, __LINE__);
+    TEST_ASSERT_TRUE(InterleaveSchedules > 1);
+    TEST_ASSERT_TRUE(InterleaveSchedules < UNITY_INTERLEAVE_MAX_SCHEDULES);
+#endif
+}
+
+void testInterleavedAllLetsAThreadKeepTheTurn(void)
+{
+#ifndef UNITY_INCLUDE_INTERLEAVE
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    UnityRunInterleaved(interleaveStageNeverThree, 0, __LINE__);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testInterleavedAllEndsWithASpinningThread(void)
+{
+#ifndef UNITY_INCLUDE_INTERLEAVE
+    TEST_IGNORE();
+#else
+    InterleaveSchedules = 0;
+    UnityRunInterleaved(interleaveSpinningThread, 0, __LINE__);
+    TEST_ASSERT_TRUE(InterleaveSchedules > 1);
+    TEST_ASSERT_TRUE(InterleaveSchedules < UNITY_INTERLEAVE_MAX_SCHEDULES);
+#endif
+}
+
+void testYieldOutsideInterleavedTest(void)
+{
+    UNITY_YIELD();
+}
+
+// ===================== THESE TEST WILL RUN IF YOUR CONFIG INCLUDES JUNIT OUTPUT ==================
+
+#ifdef USING_JUNIT_SPY
+// conclude a made-up test and keep the <testcase> element it writes
+static void junitConcludeTest(const char* name, const char* failure)
+{
+    const char* testName = Unity.CurrentTestName;
+    UNITY_COUNTER_TYPE failures = Unity.TestFailures;
+
+    startPutcharSpy();
+    Unity.CurrentTestName = name;
+    if (failure != NULL)
+        UnityFail(failure, __LINE__);
+    junitSpyLength = 0;
+    junitSpyBuffer[0] = 0;
+    junitSpyEnabled = 1;
+    UnityConcludeTest();
+    junitSpyEnabled = 0;
+    endPutcharSpy();
+    Unity.CurrentTestName = testName;
+    Unity.TestFailures = failures;
+}
+#endif
+
+void testJUnitReportsPassingTest(void)
+{
+#if !defined(USING_JUNIT_SPY) || !defined(USING_OUTPUT_SPY)
+    TEST_IGNORE();
+#else
+    junitConcludeTest("junitPassing", NULL);
+    TEST_ASSERT_EQUAL_STRING_LEN("  <testcase classname=\"", junitSpyBuffer, 23);
+    TEST_ASSERT_NOT_NULL(strstr(junitSpyBuffer, "testunity.c\" name=\"junitPassing\""));
+    TEST_ASSERT_NULL(strstr(junitSpyBuffer, "<failure"));
+    TEST_ASSERT_EQUAL_STRING("\"/>\n", &junitSpyBuffer[junitSpyLength - 4]);
+#endif
+}
+
+void testJUnitReportsFailureEscaped(void)
+{
+#if !defined(USING_JUNIT_SPY) || !defined(USING_OUTPUT_SPY)
+    TEST_IGNORE();
+#else
+    junitConcludeTest("junit<Failing>", "a < b & \"c\"");
+    TEST_ASSERT_NOT_NULL(strstr(junitSpyBuffer, "\" name=\"junit&lt;Failing&gt;\""));
+    TEST_ASSERT_NOT_NULL(strstr(junitSpyBuffer, "\">\n    <failure type=\"ASSERT FAILED\" message=\""));
+    TEST_ASSERT_NOT_NULL(strstr(junitSpyBuffer, ":junit&lt;Failing&gt;:FAIL: a &lt; b &amp; &quot;c&quot;\"/>\n  </testcase>\n"));
+#endif
+}
+